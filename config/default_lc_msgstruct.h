@@ -284,9 +284,69 @@ typedef struct
 
     uint16 Pad16; /**< \brief Structure padding */
 
-    uint32 APSampleCount;     /**< \brief Total count of Actionpoints sampled */
-    uint32 MonitoredMsgCount; /**< \brief Total count of messages monitored for watchpoints */
-    uint32 RTSExecCount;      /**< \brief Total count of RTS sequences initiated */
+    uint32 APSampleCount;       /**< \brief Total count of Actionpoints sampled */
+    uint32 MonitoredMsgCount;   /**< \brief Total count of messages monitored for watchpoints */
+    uint32 RTSExecCount;        /**< \brief Total count of RTS sequences initiated */
+    uint32 SkippedEvalCount;    /**< \brief Total count of watchpoint evaluations skipped
+                                 *          because the masked data was unchanged
+                                 */
+    uint32 DigestHitCount;      /**< \brief Total count of messages whose watchpoint results
+                                 *          were reused because the digest matched
+                                 */
+    uint32 DigestMissCount;     /**< \brief Total count of digest enabled messages whose
+                                 *          watchpoints had to be evaluated
+                                 */
+    uint16 LastPipeBatch;       /**< \brief Command pipe messages processed in the last wakeup */
+    uint16 PeakPipeBatch;       /**< \brief Most command pipe messages processed in one wakeup,
+                                 *          at most the drain limit plus one
+                                 */
+    uint32 PipeLimitCount;      /**< \brief Total count of wakeups that stopped at the drain
+                                 *          limit with messages possibly left in the
+                                 *          command pipe, a sign the pipe is backing up
+                                 */
+    uint32 APSkipCount;         /**< \brief Total count of actionpoint samples that reused the
+                                 *          previous result because no referenced watchpoint
+                                 *          result changed
+                                 */
+    uint32 ImmediateAPCount;    /**< \brief Total count of immediate actionpoint evaluations */
+    uint32 ImmediateDeferCount; /**< \brief Total count of immediate evaluations left to the
+                                 *          next sample request by the actionpoint's
+                                 *          MaxImmediateEvals
+                                 */
+    uint32 LastRTSLatency;      /**< \brief Microseconds from packet to RTS request for the
+                                 *          last immediate RTS request
+                                 */
+    uint32 PeakRTSLatency;      /**< \brief Longest packet to RTS request time, in
+                                 *          microseconds, of an immediate RTS request
+                                 */
+    uint32 CDSBytesWritten;     /**< \brief Total bytes written to the Critical Data Store */
+    uint32 CDSWritesSkipped;    /**< \brief Total Critical Data Store updates that wrote
+                                 *          nothing because no data changed or the
+                                 *          minimum persist interval had not passed
+                                 */
+    uint32 UnrefMsgCount;       /**< \brief Total count of messages received with a message
+                                 *          ID no watchpoint references
+                                 */
+    uint16 UnrefMsgIDs;         /**< \brief Unreferenced message IDs received since the
+                                 *          watchpoint definition table last took effect
+                                 */
+    uint16 UnrefUnsubscribed;   /**< \brief Unreferenced message IDs unsubscribed from since
+                                 *          the watchpoint definition table last took effect
+                                 */
+    uint16 LastCtrlBatch;       /**< \brief Control pipe messages processed the last time the
+                                 *          control pipe had any
+                                 */
+    uint16 PeakCtrlBatch;       /**< \brief Most control pipe messages processed in one pass,
+                                 *          the deepest the control pipe has been seen to be
+                                 */
+    uint32 CtrlPipeGaps;        /**< \brief Total count of sequence count gaps in the sample
+                                 *          and housekeeping requests, each one or more
+                                 *          requests that never reached LC
+                                 */
+    uint32 MonPipeGaps;         /**< \brief Total count of sequence count gaps in the monitor
+                                 *          packets, each one or more packets that never
+                                 *          reached LC
+                                 */
 } LC_HkTlm_Payload_t;
 
 /**
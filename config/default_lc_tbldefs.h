@@ -67,20 +67,67 @@
     12 /**< \brief 32 bit single precision IEEE-754 floating point number, \
         *          little endian byte order                                \
         */
+#define LC_DATA_WATCH_QWORD_BE  13 /**< \brief 64 bit signed quad word big endian byte order */
+#define LC_DATA_WATCH_QWORD_LE  14 /**< \brief 64 bit signed quad word little endian byte order */
+#define LC_DATA_WATCH_UQWORD_BE 15 /**< \brief 64 bit unsigned quad word big endian byte order */
+#define LC_DATA_WATCH_UQWORD_LE 16 /**< \brief 64 bit unsigned quad word little endian byte order */
+#define LC_DATA_WATCH_DOUBLE_BE                                            \
+    17 /**< \brief 64 bit double precision IEEE-754 floating point number, \
+        *          big endian byte order                                   \
+        */
+#define LC_DATA_WATCH_DOUBLE_LE                                            \
+    18 /**< \brief 64 bit double precision IEEE-754 floating point number, \
+        *          little endian byte order                                \
+        */
 /**\}*/
 
 /**
  * \name Watchpoint Definition Table (WDT) OperatorID Enumerated Types
  * \{
  */
-#define LC_OPER_NONE   0xFF /**< \brief Use for empty entries         */
-#define LC_OPER_LT     1    /**< \brief Less Than (<)                 */
-#define LC_OPER_LE     2    /**< \brief Less Than or Equal To (<=)    */
-#define LC_OPER_NE     3    /**< \brief Not Equal (!=)                */
-#define LC_OPER_EQ     4    /**< \brief Equal (==)                    */
-#define LC_OPER_GE     5    /**< \brief Greater Than or Equal To (>=) */
-#define LC_OPER_GT     6    /**< \brief Greater Than (>)              */
-#define LC_OPER_CUSTOM 7    /**< \brief Use custom function           */
+#define LC_OPER_NONE         0xFF /**< \brief Use for empty entries         */
+#define LC_OPER_LT           1    /**< \brief Less Than (<)                 */
+#define LC_OPER_LE           2    /**< \brief Less Than or Equal To (<=)    */
+#define LC_OPER_NE           3    /**< \brief Not Equal (!=)                */
+#define LC_OPER_EQ           4    /**< \brief Equal (==)                    */
+#define LC_OPER_GE           5    /**< \brief Greater Than or Equal To (>=) */
+#define LC_OPER_GT           6    /**< \brief Greater Than (>)              */
+#define LC_OPER_CUSTOM       7    /**< \brief Use custom function           */
+#define LC_OPER_IN_RANGE     8    /**< \brief ComparisonValue <= data <=
+                                              SecondComparisonValue         */
+#define LC_OPER_OUT_OF_RANGE 9    /**< \brief data < ComparisonValue or
+                                              data > SecondComparisonValue  */
+#define LC_OPER_HYSTERESIS   10   /**< \brief Set at ComparisonValue, clear at
+                                              SecondComparisonValue         */
+/**\}*/
+
+/**
+ * \name Watchpoint Definition Table (WDT) WatchOptions Bits
+ * \{
+ */
+#define LC_WATCH_OPT_NONE        0x00 /**< \brief Evaluate every sample             */
+#define LC_WATCH_OPT_CHANGE_ONLY 0x01 /**< \brief Reuse the previous result while the
+                                                 masked data is unchanged          */
+#define LC_WATCH_OPT_DIGEST      0x02 /**< \brief Reuse the previous results of the
+                                                 message while its watched bytes
+                                                 are unchanged, only applied when
+                                                 every watchpoint on the message
+                                                 sets it, none is #LC_OPER_CUSTOM
+                                                 and the watched bytes span at
+                                                 most #LC_DIGEST_MAX_BYTES         */
+#define LC_WATCH_OPT_MASK        0x03 /**< \brief All defined option bits           */
+/**\}*/
+
+/**
+ * \name Actionpoint Definition Table (ADT) ActionOptions Bits
+ * \{
+ */
+#define LC_ACTION_OPT_NONE      0x00 /**< \brief Evaluate only on sample requests      */
+#define LC_ACTION_OPT_IMMEDIATE 0x01 /**< \brief Also evaluate as soon as a watchpoint
+                                                the equation references changes result,
+                                                up to MaxImmediateEvals times between
+                                                sample requests                        */
+#define LC_ACTION_OPT_MASK      0x01 /**< \brief All defined option bits               */
 /**\}*/
 
 /**
@@ -131,6 +178,8 @@
 #define LC_WDTVAL_ERR_MID      3 /**< \brief Invalid MessageID                 */
 #define LC_WDTVAL_ERR_FPNAN    4 /**< \brief ComparisonValue is NAN float      */
 #define LC_WDTVAL_ERR_FPINF    5 /**< \brief ComparisonValue is infinite float */
+#define LC_WDTVAL_ERR_RANGE    6 /**< \brief Range bounds are out of order     */
+#define LC_WDTVAL_ERR_OPTIONS  7 /**< \brief Undefined WatchOptions bits set    */
 /**\}*/
 
 /**
@@ -143,6 +192,7 @@
 #define LC_ADTVAL_ERR_FAILCNT  3 /**< \brief MaxFailsBeforeRTS is zero         */
 #define LC_ADTVAL_ERR_EVTTYPE  4 /**< \brief Invalid EventType                 */
 #define LC_ADTVAL_ERR_RPN      5 /**< \brief Invalid Reverse Polish Expression */
+#define LC_ADTVAL_ERR_OPTIONS  6 /**< \brief Undefined ActionOptions bits set   */
 /**\}*/
 
 #ifndef LC_OMIT_DEPRECATED
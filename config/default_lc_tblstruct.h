@@ -48,6 +48,10 @@ typedef struct
                                           - AP result transition from pass to fail  */
     uint8  MaxFailPassEvents; /**< \brief Max number of events before filter
                                           - AP result transition from fail to pass  */
+    uint8  ActionOptions;     /**< \brief Evaluation options (bit field), see
+                                          #LC_ACTION_OPT_IMMEDIATE                  */
+    uint8  MaxImmediateEvals; /**< \brief Max number of immediate evaluations
+                                          between actionpoint sample requests       */
     uint16 RTSId;             /**< \brief RTS to request if this AP fails           */
     uint16 MaxFailsBeforeRTS; /**< \brief How may consecutive failures before
                                           an RTS request is issued                  */
@@ -75,7 +79,7 @@ typedef struct
  * A union type provides a way to have many different data types occupy
  * the same memory and legally alias each other.
  *
- * This is used to store the watch data points, as they may be 8, 16, or 32
+ * This is used to store the watch data points, as they may be 8, 16, 32 or 64
  * bits and this is defined in the table / not known until runtime.
  */
 typedef union
@@ -87,7 +91,10 @@ typedef union
     int16  Signed16;
     uint8  Unsigned8;
     int8   Signed8;
-    uint8  RawByte[4];
+    uint64 Unsigned64;
+    int64  Signed64;
+    double Float64;
+    uint8  RawByte[8];
 } LC_MultiType_t;
 
 /**
@@ -95,23 +102,31 @@ typedef union
  */
 typedef struct
 {
-    uint8          DataType;           /**< \brief Watchpoint Data Type (enumerated)     */
-    uint8          OperatorID;         /**< \brief Comparison type (enumerated)          */
-    CFE_SB_MsgId_t MessageID;          /**< \brief Message ID for the message containing
-                                                   the watchpoint                        */
-    uint32         WatchpointOffset;   /**< \brief Byte offset from the beginning of
-                                                   the message (including any headers)
-                                                   to the watchpoint                     */
-    uint32         BitMask;            /**< \brief Value to be masked with watchpoint
-                                                   data prior to comparison              */
-    LC_MultiType_t ComparisonValue;    /**< \brief Value watchpoint data is compared
-                                                   against                               */
-    uint32         ResultAgeWhenStale; /**< \brief Number of LC Sample Actionpoint
-                                                   commands that must be processed after
-                                                   comparison before result goes stale   */
-    uint32         CustomFuncArgument; /**< \brief Data passed to the custom function
-                                                   when Operator_ID is set to
-                                                   #LC_OPER_CUSTOM                       */
+    uint8          DataType;              /**< \brief Watchpoint Data Type (enumerated)     */
+    uint8          OperatorID;            /**< \brief Comparison type (enumerated)          */
+    uint8          WatchOptions;          /**< \brief Evaluation options (bit field), see
+                                                      #LC_WATCH_OPT_CHANGE_ONLY and
+                                                      #LC_WATCH_OPT_DIGEST                  */
+    uint8          Spare;                 /**< \brief Structure padding                     */
+    CFE_SB_MsgId_t MessageID;             /**< \brief Message ID for the message containing
+                                                      the watchpoint                        */
+    uint32         WatchpointOffset;      /**< \brief Byte offset from the beginning of
+                                                      the message (including any headers)
+                                                      to the watchpoint                     */
+    uint32         BitMask;               /**< \brief Value to be masked with watchpoint
+                                                      data prior to comparison              */
+    LC_MultiType_t ComparisonValue;       /**< \brief Value watchpoint data is compared
+                                                      against                               */
+    LC_MultiType_t SecondComparisonValue; /**< \brief Upper bound for #LC_OPER_IN_RANGE
+                                                      and #LC_OPER_OUT_OF_RANGE, clear
+                                                      threshold for #LC_OPER_HYSTERESIS.
+                                                      Unused by other operators.            */
+    uint32         ResultAgeWhenStale;    /**< \brief Number of LC Sample Actionpoint
+                                                      commands that must be processed after
+                                                      comparison before result goes stale   */
+    uint32         CustomFuncArgument;    /**< \brief Data passed to the custom function
+                                                      when Operator_ID is set to
+                                                      #LC_OPER_CUSTOM                       */
 } LC_WDTEntry_t;
 
 /**
@@ -126,6 +141,9 @@ typedef struct
     uint8 Padding[3]; /**< \brief Structure padding */
 
     CFE_TIME_SysTime_t Timestamp; /**< \brief Timstamp when the transition was detected    */
+
+    uint32 ValueUpper; /**< \brief Upper 32 bits of the watchpoint value for
+                                   64 bit data types, zero otherwise         */
 } LC_WRTTransition_t;
 
 /**
@@ -149,6 +167,8 @@ typedef struct
                                                          watchpoint has evaluated to TRUE       */
     uint32             CumulativeTrueCount;  /**< \brief Total number of times this watchpoint
                                                          has evaluated to TRUE                  */
+    uint32             ErrorCount;           /**< \brief Total number of times this watchpoint
+                                                         has evaluated to ERROR                 */
     LC_WRTTransition_t LastFalseToTrue;      /**< \brief Last transition from FALSE to TRUE     */
     LC_WRTTransition_t LastTrueToFalse;      /**< \brief Last transition from TRUE to FALSE     */
 } LC_WRTEntry_t;
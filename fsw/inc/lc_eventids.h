@@ -62,8 +62,8 @@
  *  \par Cause:
  *
  *  This event message is issued when the CFS Limit Checker
- *  is unable to create its command pipe via the #CFE_SB_CreatePipe
- *  API
+ *  is unable to create its command or control pipe via the
+ *  #CFE_SB_CreatePipe API
  */
 #define LC_CR_PIPE_ERR_EID 3
 
@@ -668,7 +668,9 @@
  *
  *  This event message is issued when a software bus message has
  *  been received that isn't a recognized LC message and has no
- *  defined watchpoints referencing it's message ID
+ *  defined watchpoints referencing it's message ID. It is issued for
+ *  the first such message and then once every #LC_UNREF_EVENT_INTERVAL
+ *  messages with the same message ID.
  */
 #define LC_MID_INF_EID 49
 
@@ -681,6 +683,8 @@
  *
  *  This event message is issued whenever an undefined watchpoint data type
  *  identifier is detected
+ *
+ *  \sa #LC_WP_ERR_EVENT_LIMIT, #LC_WP_ERR_EVENT_INTERVAL
  */
 #define LC_WP_DATATYPE_ERR_EID 50
 
@@ -693,6 +697,8 @@
  *
  *  This event message is issued whenever an undefined watchpoint
  *  operator identifier is detected
+ *
+ *  \sa #LC_WP_ERR_EVENT_LIMIT, #LC_WP_ERR_EVENT_INTERVAL
  */
 #define LC_WP_OPERID_ERR_EID 51
 
@@ -706,6 +712,8 @@
  *  This event message is issued when a watchpoint is defined as a float
  *  type, but the extracted value would equate to a floating point
  *  NAN (not-a-number) value
+ *
+ *  \sa #LC_WP_ERR_EVENT_LIMIT, #LC_WP_ERR_EVENT_INTERVAL
  */
 #define LC_WP_NAN_ERR_EID 52
 
@@ -719,6 +727,8 @@
  *  This event message is issued when a watchpoint offset value extends past
  *  the end of the message as reported by the #CFE_MSG_GetSize
  *  function
+ *
+ *  \sa #LC_WP_ERR_EVENT_LIMIT, #LC_WP_ERR_EVENT_INTERVAL
  */
 #define LC_WP_OFFSET_ERR_EID 53
 
@@ -733,7 +743,9 @@
  *  fails for a watchpoint definition table (WDT) load and the error is
  *  a failed floating point check. This error is caused when the data type
  *  for a wachpoint definition is floating point and the comparison value
- *  equates to a floating point NAN (not-a-number) or infinite value.
+ *  equates to a floating point NAN (not-a-number) or infinite value. For
+ *  the range and hysteresis operators the second comparison value is
+ *  checked too, and the event reports whichever value failed.
  */
 #define LC_WDTVAL_FPERR_EID 54
 
@@ -922,6 +934,62 @@
  */
 #define LC_ADT_REGISTER_CRIT_ERR_EID 69
 
+/**
+ * \brief LC Watchpoint Dispatch Index Build Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a collision-free hash of the
+ *  message IDs referenced by a newly loaded watchpoint definition
+ *  table (WDT) could not be found with any of the available seeds.
+ *  Watchpoints are still processed, but each received message is
+ *  matched by a linear search of the referenced message IDs.
+ */
+#define LC_HASH_BUILD_ERR_EID 70
+
+/**
+ * \brief LC CDS Writer Task Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when #LC_CDS_WRITER_TASK is enabled
+ *  but the semaphore or child task used to write the Critical Data
+ *  Store could not be created. The CDS is written by the main task
+ *  instead.
+ */
+#define LC_CDS_WRITER_ERR_EID 71
+
+/**
+ * \brief LC Unreferenced Message ID Unsubscribed Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when LC unsubscribes from a message
+ *  ID that no watchpoint references after receiving
+ *  #LC_UNREF_UNSUB_LIMIT messages with it.
+ */
+#define LC_UNREF_UNSUB_INF_EID 72
+
+/**
+ * \brief LC Unreferenced Message ID Unsubscribe Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_SB_Unsubscribe
+ *  for a message ID that no watchpoint references fails. LC does not
+ *  try to unsubscribe from it again until a new watchpoint definition
+ *  table takes effect.
+ */
+#define LC_UNREF_UNSUB_ERR_EID 73
+
 /**
  * \brief LC Actionpoint Definition Table Base ID
  *
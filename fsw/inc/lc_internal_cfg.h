@@ -59,7 +59,9 @@
  *  \par Description:
  *       Maximum number of messages that will be allowed in the
  *       LC command pipe at one time. Used during initialization
- *       in the call to #CFE_SB_CreatePipe
+ *       in the call to #CFE_SB_CreatePipe. The command pipe carries
+ *       the monitor packets, LC's own commands and requests arrive
+ *       on the control pipe (see #LC_CTRL_PIPE_DEPTH).
  *
  *  \par Limits:
  *       This parameter can't be larger than an unsigned 16 bit
@@ -68,6 +70,60 @@
 #define LC_PIPE_DEPTH         LC_INTERNAL_CFGVAL(PIPE_DEPTH)
 #define DEFAULT_LC_PIPE_DEPTH 12
 
+/**
+ * \brief Command Pipe Drain Limit
+ *
+ *  \par Description:
+ *       Most additional messages read from the LC command pipe,
+ *       without waiting, after each wakeup. The messages are all
+ *       processed before the task pends again, so a burst of
+ *       telemetry is handled in one pass. Zero processes a single
+ *       message per wakeup. The default of one less than
+ *       #LC_PIPE_DEPTH empties a full pipe in one wakeup.
+ *
+ *  \par Limits:
+ *       This parameter must not be less than zero or larger than
+ *       an unsigned 16 bit integer minus one (65534).
+ */
+#define LC_PIPE_DRAIN_LIMIT         LC_INTERNAL_CFGVAL(PIPE_DRAIN_LIMIT)
+#define DEFAULT_LC_PIPE_DRAIN_LIMIT 11
+
+/**
+ * \brief Control Pipe Depth
+ *
+ *  \par Description:
+ *       Maximum number of messages that will be allowed in the
+ *       LC control pipe at one time. The control pipe carries
+ *       ground commands, housekeeping requests and actionpoint
+ *       sample requests, so a burst of monitor packets on the
+ *       command pipe cannot delay or drop them. The main loop
+ *       empties the control pipe before each monitor packet.
+ *
+ *  \par Limits:
+ *       This parameter can't be less than 1 or larger than an
+ *       unsigned 16 bit integer (65535).
+ */
+#define LC_CTRL_PIPE_DEPTH         LC_INTERNAL_CFGVAL(CTRL_PIPE_DEPTH)
+#define DEFAULT_LC_CTRL_PIPE_DEPTH 8
+
+/**
+ * \brief Control Pipe Pend Time
+ *
+ *  \par Description:
+ *       Milliseconds the main loop pends on the command pipe for
+ *       a monitor packet before checking the control pipe again.
+ *       This is the longest a control message waits while no
+ *       monitor packets arrive, each idle wakeup costs one poll
+ *       of the control pipe. While monitor packets arrive a
+ *       control message waits at most one packet.
+ *
+ *  \par Limits:
+ *       This parameter must not be less than 1 or larger than
+ *       the 1000 millisecond maintenance wakeup, #LC_SB_TIMEOUT.
+ */
+#define LC_CTRL_PIPE_PEND_TIME         LC_INTERNAL_CFGVAL(CTRL_PIPE_PEND_TIME)
+#define DEFAULT_LC_CTRL_PIPE_PEND_TIME 10
+
 /**
  * \brief LC state after power-on reset
  *
@@ -182,6 +238,218 @@
 #define LC_FLOAT_TOLERANCE         LC_INTERNAL_CFGVAL(FLOAT_TOLERANCE)
 #define DEFAULT_LC_FLOAT_TOLERANCE (1.0e-25)
 
+/**
+ * \brief Minimum Watchpoint Batch
+ *
+ *  \par Description:
+ *       Smallest run of watchpoints on the same message, with the
+ *       same data type and operator, that is evaluated as a batch
+ *       rather than one watchpoint at a time. Batches are compared
+ *       with SIMD instructions when the target provides them.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1. Values larger than the
+ *       number of watchpoints on any one message disable batching.
+ */
+#define LC_WATCH_BATCH_MIN         LC_INTERNAL_CFGVAL(WATCH_BATCH_MIN)
+#define DEFAULT_LC_WATCH_BATCH_MIN 4
+
+/**
+ * \brief Change-Only Watchpoint Evaluation
+ *
+ *  \par Description:
+ *       When true, every watchpoint is evaluated as if its
+ *       #LC_WATCH_OPT_CHANGE_ONLY option were set: a sample whose
+ *       masked data matches the previous sample reuses the previous
+ *       result instead of running the comparison or custom function.
+ *       When false, only watchpoints that set the option in the
+ *       Watchpoint Definition Table are evaluated this way.
+ *
+ *  \par Limits:
+ *       This parameter must be true or false.
+ */
+#define LC_WATCH_CHANGE_ONLY         LC_INTERNAL_CFGVAL(WATCH_CHANGE_ONLY)
+#define DEFAULT_LC_WATCH_CHANGE_ONLY false
+
+/**
+ * \brief Packet Digest Maximum Bytes
+ *
+ *  \par Description:
+ *       Largest span of watched bytes, from the first watched byte of
+ *       a message to the end of its last one, that can use a packet
+ *       digest (#LC_WATCH_OPT_DIGEST). The bytes of the span are kept
+ *       with the digest and compared when the digest matches, so a
+ *       digest collision can never reuse results for changed data.
+ *       Messages with a longer span are always evaluated. Each
+ *       dispatch index entry reserves this many bytes.
+ *
+ *  \par Limits:
+ *       This parameter must not be less than 1.
+ */
+#define LC_DIGEST_MAX_BYTES         LC_INTERNAL_CFGVAL(DIGEST_MAX_BYTES)
+#define DEFAULT_LC_DIGEST_MAX_BYTES 64
+
+/**
+ * \brief Stale Countdown Wheel Slots
+ *
+ *  \par Description:
+ *       Number of slots in the timing wheel used to age watchpoint
+ *       results. Each sample request that updates result ages visits
+ *       one slot, so only the watchpoints whose countdown to stale
+ *       ends on that request, plus any whose countdown is a multiple
+ *       of this value away, are touched.
+ *
+ *  \par Limits:
+ *       This parameter must be a power of two, at least 1 and no
+ *       more than 65536.
+ */
+#define LC_STALE_WHEEL_SLOTS         LC_INTERNAL_CFGVAL(STALE_WHEEL_SLOTS)
+#define DEFAULT_LC_STALE_WHEEL_SLOTS 64
+
+/**
+ * \brief Minimum CDS Persist Interval
+ *
+ *  \par Description:
+ *       Number of maintenance cycles (housekeeping requests and
+ *       command pipe timeouts) between updates of the Critical Data
+ *       Store. A value of 1 updates the CDS on every cycle. Only the
+ *       CDS blocks whose data changed since they were last written
+ *       are written, so a larger value trades how old the saved
+ *       results may be for fewer CDS writes.
+ *
+ *       Blocks are marked as changed where their data is updated:
+ *       the WRT when a watchpoint is evaluated or reset, the ART
+ *       when an actionpoint is sampled or commanded, and the
+ *       application data whenever a message is processed. An update
+ *       with nothing marked writes nothing. While telemetry flows
+ *       every block changes each cycle, so this interval is what
+ *       reduces the CDS writes.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.
+ */
+#define LC_CDS_MIN_PERSIST_INTERVAL         LC_INTERNAL_CFGVAL(CDS_MIN_PERSIST_INTERVAL)
+#define DEFAULT_LC_CDS_MIN_PERSIST_INTERVAL 1
+
+/**
+ * \brief CDS Writer Task Switch
+ *
+ *  \par Description:
+ *       When true, LC starts a child task at initialization that
+ *       writes the Critical Data Store. Each maintenance cycle then
+ *       only copies the results into a staging buffer and wakes the
+ *       child task, so the CDS writes do not delay the processing of
+ *       monitored packets. When false, or if the child task cannot
+ *       be started, the CDS is written by the main task.
+ *
+ *  \par Limits:
+ *       This parameter must be true or false.
+ */
+#define LC_CDS_WRITER_TASK         LC_INTERNAL_CFGVAL(CDS_WRITER_TASK)
+#define DEFAULT_LC_CDS_WRITER_TASK false
+
+/**
+ * \brief CDS Writer Task Priority
+ *
+ *  \par Description:
+ *       Priority of the CDS writer child task. It should be a lower
+ *       priority (a larger number) than the LC application itself.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 255.
+ */
+#define LC_CDS_WRITER_PRIORITY         LC_INTERNAL_CFGVAL(CDS_WRITER_PRIORITY)
+#define DEFAULT_LC_CDS_WRITER_PRIORITY 200
+
+/**
+ * \brief CDS Writer Task Stack Size
+ *
+ *  \par Description:
+ *       Stack size, in bytes, of the CDS writer child task.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than zero.
+ */
+#define LC_CDS_WRITER_STACK_SIZE         LC_INTERNAL_CFGVAL(CDS_WRITER_STACK_SIZE)
+#define DEFAULT_LC_CDS_WRITER_STACK_SIZE 8192
+
+/**
+ * \brief Maximum Tracked Unreferenced Message IDs
+ *
+ *  \par Description:
+ *       Number of message IDs, with no watchpoint referencing them,
+ *       for which LC keeps a count of the messages received. The
+ *       counts are cleared each time a new watchpoint definition
+ *       table takes effect. Messages with further unreferenced
+ *       message IDs are only counted in total.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and can't be larger than
+ *       an unsigned 16 bit integer (65535).
+ */
+#define LC_MAX_UNREF_MSGIDS         LC_INTERNAL_CFGVAL(MAX_UNREF_MSGIDS)
+#define DEFAULT_LC_MAX_UNREF_MSGIDS 16
+
+/**
+ * \brief Unreferenced Message ID Event Interval
+ *
+ *  \par Description:
+ *       #LC_MID_INF_EID is issued for the first message received
+ *       with an unreferenced message ID and then once for every
+ *       this many messages with the same message ID.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.
+ */
+#define LC_UNREF_EVENT_INTERVAL         LC_INTERNAL_CFGVAL(UNREF_EVENT_INTERVAL)
+#define DEFAULT_LC_UNREF_EVENT_INTERVAL 100
+
+/**
+ * \brief Unreferenced Message ID Unsubscribe Limit
+ *
+ *  \par Description:
+ *       Number of messages received with a tracked, unreferenced
+ *       message ID after which LC unsubscribes from that message ID.
+ *       Zero never unsubscribes. A later watchpoint definition table
+ *       that references the message ID subscribes to it again.
+ *
+ *  \par Limits:
+ *       This parameter must not be less than zero.
+ */
+#define LC_UNREF_UNSUB_LIMIT         LC_INTERNAL_CFGVAL(UNREF_UNSUB_LIMIT)
+#define DEFAULT_LC_UNREF_UNSUB_LIMIT 0
+
+/**
+ * \brief Watchpoint Error Event Limit
+ *
+ *  \par Description:
+ *       Number of evaluation errors of a watchpoint (bad offset, NAN
+ *       data, undefined data type or operator) that are each reported
+ *       with an event. Further errors are only reported once every
+ *       #LC_WP_ERR_EVENT_INTERVAL errors, but all of them are counted
+ *       in the ErrorCount of the watchpoint results. Resetting the
+ *       watchpoint statistics starts the budget over.
+ *
+ *  \par Limits:
+ *       This parameter must not be less than zero.
+ */
+#define LC_WP_ERR_EVENT_LIMIT         LC_INTERNAL_CFGVAL(WP_ERR_EVENT_LIMIT)
+#define DEFAULT_LC_WP_ERR_EVENT_LIMIT 5
+
+/**
+ * \brief Watchpoint Error Event Interval
+ *
+ *  \par Description:
+ *       Once a watchpoint has used its #LC_WP_ERR_EVENT_LIMIT error
+ *       events, one of every this many further evaluation errors is
+ *       reported with an event.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.
+ */
+#define LC_WP_ERR_EVENT_INTERVAL         LC_INTERNAL_CFGVAL(WP_ERR_EVENT_INTERVAL)
+#define DEFAULT_LC_WP_ERR_EVENT_INTERVAL 500
+
 /**
  * \name LC Table Name Strings
  * \{
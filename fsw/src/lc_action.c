@@ -26,6 +26,7 @@
 *************************************************************************/
 #include "lc_app.h"
 #include "lc_action.h"
+#include "lc_watch.h"
 #include "lc_msgids.h"
 #include "lc_eventids.h"
 #include "lc_custom.h"
@@ -52,11 +53,19 @@ void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex)
     if ((CurrentAPState != LC_ACTION_NOT_USED) && (CurrentAPState != LC_APSTATE_PERMOFF))
     {
         /*
-         ** Sample selected actionpoints
+         ** Sample selected actionpoints, stopping after the last one
+         ** in use so a sample of all of them skips the unused tail
          */
-        for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++)
+        for (TableIndex = StartIndex; (TableIndex <= EndIndex) && (TableIndex < LC_OperData.ActionHighWater);
+             TableIndex++)
         {
             LC_SampleSingleAP(TableIndex);
+
+            /*
+            ** Each sample request renews the immediate evaluations
+            ** the actionpoint is allowed
+            */
+            LC_OperData.APImmediate.EvalCount[TableIndex] = 0;
         }
     }
     else
@@ -100,10 +109,24 @@ void LC_SampleSingleAP(uint16 APNumber)
         ** as needed
         */
         LC_AppData.APSampleCount++;
+        LC_OperData.CDSDirty |= LC_CDS_DIRTY_ART;
 
         PreviousResult = LC_OperData.ARTPtr[APNumber].ActionResult;
 
-        CurrentResult = LC_EvaluateRPN(APNumber);
+        if (LC_APNeedsEval(APNumber))
+        {
+            CurrentResult = LC_EvaluateRPN(APNumber);
+        }
+        else
+        {
+            /*
+            ** No watchpoint in the equation changed result, so it
+            ** would evaluate the same as last time. The result is
+            ** still handled below so fail counts keep advancing.
+            */
+            CurrentResult = PreviousResult;
+            LC_OperData.APSkipCount++;
+        }
 
         LC_OperData.ARTPtr[APNumber].ActionResult = CurrentResult;
 
@@ -286,6 +309,31 @@ void LC_SampleSingleAP(uint16 APNumber)
 /* actionpoint                                                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_EvaluateRPN(uint16 APNumber)
+{
+    uint8 EvalResult;
+
+    if (LC_OperData.RPNProgram.Length[APNumber] == 0)
+    {
+        EvalResult = LC_InterpretRPN(APNumber);
+    }
+    else if (LC_OperData.RPNProgram.Form[APNumber] == LC_RPN_FORM_PROGRAM)
+    {
+        EvalResult = LC_RunRPNProgram(APNumber);
+    }
+    else
+    {
+        EvalResult = LC_EvaluateWatchMask(APNumber);
+    }
+
+    return EvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Interpret the RPN equation for an actionpoint                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /*
  * StackPtr is an index into an array RPNStack (see LC_EvaluateRPN)
@@ -294,7 +342,7 @@ void LC_SampleSingleAP(uint16 APNumber)
  * in the RPMStack array, then returns the next element.
  */
 #define POP_RPN_DATA ((StackPtr <= 0) ? (IllegalRPN = true) : (RPNStack[--StackPtr]))
-uint8 LC_EvaluateRPN(uint16 APNumber)
+uint8 LC_InterpretRPN(uint16 APNumber)
 {
     bool   Done;
     bool   IllegalRPN;
@@ -486,6 +534,877 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
     return EvalResult;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run the compiled program for an actionpoint                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_RunRPNProgram(uint16 APNumber)
+{
+    const LC_RPNInstr_t *Code = LC_OperData.RPNProgram.Code[APNumber];
+
+    bool   Done;
+    uint8  EvalResult;
+    uint8  Stack[LC_MAX_RPN_EQU_SIZE];
+    uint8  Operand1;
+    uint8  Operand2;
+    uint32 StackPtr;
+    uint32 InstrIndex;
+
+    StackPtr   = 0;
+    InstrIndex = 0;
+    Done       = false;
+
+    /*
+    ** The equation was validated when it was compiled, so the stack
+    ** can neither underflow nor overflow and the program always ends
+    */
+    while (Done == false)
+    {
+        switch (Code[InstrIndex].Opcode)
+        {
+            case LC_RPN_OP_LOAD:
+                Stack[StackPtr++] = LC_GetPlaneResult(Code[InstrIndex].Operand);
+                InstrIndex++;
+                break;
+
+            case LC_RPN_OP_JUMP_FALSE:
+                /*
+                ** A false left operand makes the AND false, which is
+                ** already on the stack as its result
+                */
+                if (Stack[StackPtr - 1] == LC_WATCH_FALSE)
+                {
+                    InstrIndex = Code[InstrIndex].Operand;
+                }
+                else
+                {
+                    InstrIndex++;
+                }
+                break;
+
+            case LC_RPN_OP_JUMP_TRUE:
+                /*
+                ** A true left operand makes the OR true
+                */
+                if (Stack[StackPtr - 1] == LC_WATCH_TRUE)
+                {
+                    InstrIndex = Code[InstrIndex].Operand;
+                }
+                else
+                {
+                    InstrIndex++;
+                }
+                break;
+
+            case LC_RPN_OP_AND:
+                Operand2 = Stack[--StackPtr];
+                Operand1 = Stack[StackPtr - 1];
+                if ((Operand1 == LC_WATCH_FALSE) || (Operand2 == LC_WATCH_FALSE))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_FALSE;
+                }
+                else if ((Operand1 == LC_WATCH_ERROR) || (Operand2 == LC_WATCH_ERROR))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_ERROR;
+                }
+                else if ((Operand1 == LC_WATCH_STALE) || (Operand2 == LC_WATCH_STALE))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_STALE;
+                }
+                else
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_TRUE;
+                }
+                InstrIndex++;
+                break;
+
+            case LC_RPN_OP_OR:
+                Operand2 = Stack[--StackPtr];
+                Operand1 = Stack[StackPtr - 1];
+                if ((Operand1 == LC_WATCH_TRUE) || (Operand2 == LC_WATCH_TRUE))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_TRUE;
+                }
+                else if ((Operand1 == LC_WATCH_ERROR) || (Operand2 == LC_WATCH_ERROR))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_ERROR;
+                }
+                else if ((Operand1 == LC_WATCH_STALE) || (Operand2 == LC_WATCH_STALE))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_STALE;
+                }
+                else
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_FALSE;
+                }
+                InstrIndex++;
+                break;
+
+            case LC_RPN_OP_XOR:
+                Operand2 = Stack[--StackPtr];
+                Operand1 = Stack[StackPtr - 1];
+                if ((Operand1 == LC_WATCH_ERROR) || (Operand2 == LC_WATCH_ERROR))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_ERROR;
+                }
+                else if ((Operand1 == LC_WATCH_STALE) || (Operand2 == LC_WATCH_STALE))
+                {
+                    Stack[StackPtr - 1] = LC_WATCH_STALE;
+                }
+                else
+                {
+                    Stack[StackPtr - 1] = (Operand1 != Operand2);
+                }
+                InstrIndex++;
+                break;
+
+            case LC_RPN_OP_NOT:
+                Operand1 = Stack[StackPtr - 1];
+                if ((Operand1 != LC_WATCH_ERROR) && (Operand1 != LC_WATCH_STALE))
+                {
+                    Stack[StackPtr - 1] = (Operand1 == LC_WATCH_FALSE);
+                }
+                InstrIndex++;
+                break;
+
+            default:
+                /* LC_RPN_OP_END */
+                Done = true;
+                break;
+        }
+    }
+
+    EvalResult = Stack[0];
+
+    if (EvalResult == LC_WATCH_ERROR)
+    {
+        EvalResult = LC_ACTION_ERROR;
+    }
+    else if (EvalResult == LC_WATCH_STALE)
+    {
+        EvalResult = LC_ACTION_STALE;
+    }
+    else if (EvalResult == LC_WATCH_FALSE)
+    {
+        EvalResult = LC_ACTION_PASS;
+    }
+    else if (EvalResult == LC_WATCH_TRUE)
+    {
+        EvalResult = LC_ACTION_FAIL;
+    }
+
+    return EvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate an AND or OR of the watchpoints in an actionpoint's    */
+/* watch mask                                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_EvaluateWatchMask(uint16 APNumber)
+{
+    const uint32           *Mask   = LC_OperData.RPNProgram.WatchMask[APNumber];
+    const LC_WatchPlanes_t *Planes = &LC_OperData.WatchPlanes;
+
+    uint8  EvalResult;
+    uint32 AnyTrue;
+    uint32 AnyFalse;
+    uint32 AnyError;
+    uint32 AnyStale;
+    uint32 WordIndex;
+
+    AnyTrue  = 0;
+    AnyFalse = 0;
+    AnyError = 0;
+    AnyStale = 0;
+
+    /*
+    ** Only the words between the first and last watchpoints the
+    ** equation references can have mask bits set
+    */
+    for (WordIndex = LC_OperData.RPNProgram.MaskStart[APNumber]; WordIndex < LC_OperData.RPNProgram.MaskEnd[APNumber];
+         WordIndex++)
+    {
+        AnyTrue |= Mask[WordIndex] & Planes->True[WordIndex];
+        AnyError |= Mask[WordIndex] & Planes->Error[WordIndex];
+        AnyStale |= Mask[WordIndex] & Planes->Stale[WordIndex];
+        AnyFalse |= Mask[WordIndex] & ~(Planes->True[WordIndex] | Planes->Error[WordIndex] | Planes->Stale[WordIndex]);
+    }
+
+    /*
+    ** Error takes precedence over stale, and both give way to the
+    ** result that decides the operator: a false watchpoint for an AND,
+    ** a true one for an OR
+    */
+    if (LC_OperData.RPNProgram.Form[APNumber] == LC_RPN_FORM_ALL)
+    {
+        if (AnyFalse != 0)
+        {
+            EvalResult = LC_ACTION_PASS;
+        }
+        else if (AnyError != 0)
+        {
+            EvalResult = LC_ACTION_ERROR;
+        }
+        else if (AnyStale != 0)
+        {
+            EvalResult = LC_ACTION_STALE;
+        }
+        else
+        {
+            EvalResult = LC_ACTION_FAIL;
+        }
+    }
+    else
+    {
+        if (AnyTrue != 0)
+        {
+            EvalResult = LC_ACTION_FAIL;
+        }
+        else if (AnyError != 0)
+        {
+            EvalResult = LC_ACTION_ERROR;
+        }
+        else if (AnyStale != 0)
+        {
+            EvalResult = LC_ACTION_STALE;
+        }
+        else
+        {
+            EvalResult = LC_ACTION_PASS;
+        }
+    }
+
+    return EvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get a watchpoint result from the packed watchpoint results      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_GetPlaneResult(uint16 WatchIndex)
+{
+    const LC_WatchPlanes_t *Planes = &LC_OperData.WatchPlanes;
+    uint32                  Word   = LC_BIT_WORD(WatchIndex);
+    uint32                  Bit    = LC_BIT_MASK(WatchIndex);
+    uint8                   WatchResult;
+
+    if ((Planes->True[Word] & Bit) != 0)
+    {
+        WatchResult = LC_WATCH_TRUE;
+    }
+    else if ((Planes->Error[Word] & Bit) != 0)
+    {
+        WatchResult = LC_WATCH_ERROR;
+    }
+    else if ((Planes->Stale[Word] & Bit) != 0)
+    {
+        WatchResult = LC_WATCH_STALE;
+    }
+    else
+    {
+        WatchResult = LC_WATCH_FALSE;
+    }
+
+    return WatchResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the equations of all actionpoints                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CompileActionpoints(void)
+{
+    LC_RPNProgram_t  *Program   = &LC_OperData.RPNProgram;
+    LC_APImmediate_t *Immediate = &LC_OperData.APImmediate;
+    uint32            TableIndex;
+
+    memset(Immediate, 0, sizeof(*Immediate));
+
+    LC_OperData.ActionHighWater = 0;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++)
+    {
+        if (LC_OperData.ADTPtr[TableIndex].DefaultState != LC_APSTATE_NOT_USED)
+        {
+            LC_OperData.ActionHighWater = TableIndex + 1;
+        }
+
+        Program->Length[TableIndex] =
+            LC_CompileRPN(LC_OperData.ADTPtr[TableIndex].RPNEquation, Program->Code[TableIndex]);
+
+        LC_ClassifyRPN(TableIndex);
+
+        /*
+        ** Only compiled equations are in the dependency index that
+        ** queues immediate evaluations
+        */
+        if ((Program->Length[TableIndex] != 0) &&
+            ((LC_OperData.ADTPtr[TableIndex].ActionOptions & LC_ACTION_OPT_IMMEDIATE) != 0))
+        {
+            Immediate->Enabled[LC_BIT_WORD(TableIndex)] |= LC_BIT_MASK(TableIndex);
+        }
+    }
+
+    LC_BuildWatchPlanes();
+    LC_BuildAPDepends();
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Classify a compiled actionpoint equation                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ClassifyRPN(uint16 APNumber)
+{
+    const LC_RPNInstr_t *Code = LC_OperData.RPNProgram.Code[APNumber];
+    uint32              *Mask = LC_OperData.RPNProgram.WatchMask[APNumber];
+    uint16               Length;
+    uint16               WatchIndex;
+    uint16               FirstWatch;
+    uint16               LastWatch;
+    uint32               InstrIndex;
+    bool                 HasAnd;
+    bool                 HasOr;
+    bool                 HasOther;
+
+    Length   = LC_OperData.RPNProgram.Length[APNumber];
+    HasAnd   = false;
+    HasOr    = false;
+    HasOther = (Length == 0);
+
+    FirstWatch = LC_MAX_WATCHPOINTS;
+    LastWatch  = 0;
+
+    memset(Mask, 0, sizeof(LC_OperData.RPNProgram.WatchMask[APNumber]));
+
+    for (InstrIndex = 0; InstrIndex < Length; InstrIndex++)
+    {
+        switch (Code[InstrIndex].Opcode)
+        {
+            case LC_RPN_OP_LOAD:
+                WatchIndex = Code[InstrIndex].Operand;
+                Mask[LC_BIT_WORD(WatchIndex)] |= LC_BIT_MASK(WatchIndex);
+
+                if (WatchIndex < FirstWatch)
+                {
+                    FirstWatch = WatchIndex;
+                }
+                if (WatchIndex > LastWatch)
+                {
+                    LastWatch = WatchIndex;
+                }
+                break;
+
+            case LC_RPN_OP_AND:
+            case LC_RPN_OP_JUMP_FALSE:
+                HasAnd = true;
+                break;
+
+            case LC_RPN_OP_OR:
+            case LC_RPN_OP_JUMP_TRUE:
+                HasOr = true;
+                break;
+
+            case LC_RPN_OP_END:
+                break;
+
+            default:
+                HasOther = true;
+                break;
+        }
+    }
+
+    if (HasOther || (HasAnd && HasOr))
+    {
+        LC_OperData.RPNProgram.Form[APNumber] = LC_RPN_FORM_PROGRAM;
+    }
+    else if (HasOr)
+    {
+        LC_OperData.RPNProgram.Form[APNumber] = LC_RPN_FORM_ANY;
+    }
+    else
+    {
+        /*
+        ** Includes an equation of a single watchpoint
+        */
+        LC_OperData.RPNProgram.Form[APNumber] = LC_RPN_FORM_ALL;
+    }
+
+    /*
+    ** Bound the watch mask so evaluating it does not cost a pass over
+    ** every word of LC_MAX_WATCHPOINTS, an empty mask has no words
+    */
+    if (FirstWatch < LC_MAX_WATCHPOINTS)
+    {
+        LC_OperData.RPNProgram.MaskStart[APNumber] = LC_BIT_WORD(FirstWatch);
+        LC_OperData.RPNProgram.MaskEnd[APNumber]   = LC_BIT_WORD(LastWatch) + 1;
+    }
+    else
+    {
+        LC_OperData.RPNProgram.MaskStart[APNumber] = 0;
+        LC_OperData.RPNProgram.MaskEnd[APNumber]   = 0;
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load the packed watchpoint results from the results table       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_BuildWatchPlanes(void)
+{
+    LC_WatchPlanes_t *Planes = &LC_OperData.WatchPlanes;
+    uint32            WatchIndex;
+    uint8             WatchResult;
+
+    memset(Planes, 0, sizeof(*Planes));
+
+    for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++)
+    {
+        WatchResult = LC_OperData.WRTPtr[WatchIndex].WatchResult;
+
+        if (WatchResult == LC_WATCH_TRUE)
+        {
+            Planes->True[LC_BIT_WORD(WatchIndex)] |= LC_BIT_MASK(WatchIndex);
+        }
+        else if (WatchResult == LC_WATCH_STALE)
+        {
+            Planes->Stale[LC_BIT_WORD(WatchIndex)] |= LC_BIT_MASK(WatchIndex);
+        }
+        else if (WatchResult != LC_WATCH_FALSE)
+        {
+            /*
+            ** LC_WATCH_ERROR or a result that is not valid,
+            ** such as one restored from a corrupt CDS
+            */
+            Planes->Error[LC_BIT_WORD(WatchIndex)] |= LC_BIT_MASK(WatchIndex);
+        }
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the watchpoint to actionpoint dependency index            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_BuildAPDepends(void)
+{
+    LC_APDepends_t      *Depends = &LC_OperData.APDepends;
+    const LC_RPNInstr_t *Code;
+    uint32               RefFill[LC_MAX_WATCHPOINTS];
+    uint16               LastRef[LC_MAX_WATCHPOINTS];
+    uint32               APNumber;
+    uint32               WatchIndex;
+    uint32               InstrIndex;
+    uint32               Pass;
+
+    /*
+    ** The first pass counts the actionpoints that reference each
+    ** watchpoint, the second fills them in. LastRef holds the last
+    ** actionpoint (plus one) counted for a watchpoint, so an equation
+    ** that uses a watchpoint twice is only listed once.
+    */
+    memset(Depends->RefStart, 0, sizeof(Depends->RefStart));
+
+    for (Pass = 0; Pass < 2; Pass++)
+    {
+        memset(LastRef, 0, sizeof(LastRef));
+
+        for (APNumber = 0; APNumber < LC_MAX_ACTIONPOINTS; APNumber++)
+        {
+            Code = LC_OperData.RPNProgram.Code[APNumber];
+
+            for (InstrIndex = 0; InstrIndex < LC_OperData.RPNProgram.Length[APNumber]; InstrIndex++)
+            {
+                WatchIndex = Code[InstrIndex].Operand;
+
+                if ((Code[InstrIndex].Opcode == LC_RPN_OP_LOAD) && (LastRef[WatchIndex] != (APNumber + 1)))
+                {
+                    LastRef[WatchIndex] = APNumber + 1;
+
+                    if (Pass == 0)
+                    {
+                        Depends->RefStart[WatchIndex + 1]++;
+                    }
+                    else
+                    {
+                        Depends->RefList[RefFill[WatchIndex]++] = APNumber;
+                    }
+                }
+            }
+        }
+
+        if (Pass == 0)
+        {
+            for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++)
+            {
+                Depends->RefStart[WatchIndex + 1] += Depends->RefStart[WatchIndex];
+                RefFill[WatchIndex] = Depends->RefStart[WatchIndex];
+            }
+        }
+    }
+
+    /*
+    ** Results saved before this table was loaded may not match the
+    ** current watchpoint results, so evaluate everything once
+    */
+    memset(Depends->Dirty, 0xFF, sizeof(Depends->Dirty));
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update the packed result of a watchpoint and mark the           */
+/* actionpoints that reference it as dirty                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_WatchResultChanged(uint16 WatchIndex)
+{
+    LC_APDepends_t   *Depends = &LC_OperData.APDepends;
+    LC_WatchPlanes_t *Planes  = &LC_OperData.WatchPlanes;
+    uint32            Word    = LC_BIT_WORD(WatchIndex);
+    uint32            Bit     = LC_BIT_MASK(WatchIndex);
+    uint32            RefIndex;
+    uint16            APNumber;
+    uint8             WatchResult;
+
+    WatchResult = LC_OperData.WRTPtr[WatchIndex].WatchResult;
+
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_WRT;
+
+    Planes->True[Word] &= ~Bit;
+    Planes->Error[Word] &= ~Bit;
+    Planes->Stale[Word] &= ~Bit;
+
+    if (WatchResult == LC_WATCH_TRUE)
+    {
+        Planes->True[Word] |= Bit;
+    }
+    else if (WatchResult == LC_WATCH_STALE)
+    {
+        Planes->Stale[Word] |= Bit;
+    }
+    else if (WatchResult != LC_WATCH_FALSE)
+    {
+        /* Results that are not valid are reported as errors */
+        Planes->Error[Word] |= Bit;
+    }
+
+    for (RefIndex = Depends->RefStart[WatchIndex]; RefIndex < Depends->RefStart[WatchIndex + 1]; RefIndex++)
+    {
+        APNumber = Depends->RefList[RefIndex];
+
+        Depends->Dirty[LC_BIT_WORD(APNumber)] |= LC_BIT_MASK(APNumber);
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue the immediate actionpoints that reference a watchpoint    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_QueueImmediateAPs(uint16 WatchIndex)
+{
+    LC_APDepends_t   *Depends   = &LC_OperData.APDepends;
+    LC_APImmediate_t *Immediate = &LC_OperData.APImmediate;
+    uint32            RefIndex;
+    uint32            Word;
+    uint16            APNumber;
+
+    for (RefIndex = Depends->RefStart[WatchIndex]; RefIndex < Depends->RefStart[WatchIndex + 1]; RefIndex++)
+    {
+        APNumber = Depends->RefList[RefIndex];
+        Word     = LC_BIT_WORD(APNumber);
+
+        Immediate->Pending[Word] |= LC_BIT_MASK(APNumber) & Immediate->Enabled[Word];
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sample the queued immediate actionpoints                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_RunImmediateAPs(LC_PacketTime_t *PacketTime)
+{
+    LC_APImmediate_t *Immediate = &LC_OperData.APImmediate;
+    uint32            WordIndex;
+    uint32            Pending;
+    uint32            RTSExecCount;
+    uint16            APNumber;
+
+    for (WordIndex = 0; WordIndex < LC_AP_SET_WORDS; WordIndex++)
+    {
+        Pending = Immediate->Pending[WordIndex];
+
+        Immediate->Pending[WordIndex] = 0;
+
+        for (APNumber = WordIndex * 32; Pending != 0; APNumber++, Pending >>= 1)
+        {
+            if ((Pending & 1) == 0)
+            {
+                /*
+                ** Not queued
+                */
+            }
+            else if (Immediate->EvalCount[APNumber] < LC_OperData.ADTPtr[APNumber].MaxImmediateEvals)
+            {
+                Immediate->EvalCount[APNumber]++;
+                LC_OperData.ImmediateAPCount++;
+
+                RTSExecCount = LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount;
+
+                LC_SampleSingleAP(APNumber);
+
+                if (LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount != RTSExecCount)
+                {
+                    LC_RecordRTSLatency(LC_GetPacketTime(PacketTime));
+                }
+            }
+            else
+            {
+                /*
+                ** The actionpoint stays dirty, so the next sample
+                ** request evaluates it
+                */
+                LC_OperData.ImmediateDeferCount++;
+            }
+        }
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record the packet to RTS request time of an immediate RTS       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_RecordRTSLatency(CFE_TIME_SysTime_t Timestamp)
+{
+    CFE_TIME_SysTime_t Elapsed;
+    uint32             Latency;
+
+    Elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), Timestamp);
+
+    /*
+    ** A packet time stamped in the future shows as a large
+    ** elapsed time, both are limited to the largest latency
+    */
+    if (Elapsed.Seconds >= (0xFFFFFFFF / 1000000))
+    {
+        Latency = 0xFFFFFFFF;
+    }
+    else
+    {
+        Latency = (Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds);
+    }
+
+    LC_OperData.LastRTSLatency = Latency;
+
+    if (Latency > LC_OperData.PeakRTSLatency)
+    {
+        LC_OperData.PeakRTSLatency = Latency;
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark one actionpoint as dirty                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_MarkAPDirty(uint16 APNumber)
+{
+    LC_OperData.APDepends.Dirty[LC_BIT_WORD(APNumber)] |= LC_BIT_MASK(APNumber);
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check whether an actionpoint must be evaluated when sampled     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_APNeedsEval(uint16 APNumber)
+{
+    uint32 *DirtyWord = &LC_OperData.APDepends.Dirty[LC_BIT_WORD(APNumber)];
+    bool    NeedsEval;
+
+    if (LC_OperData.RPNProgram.Length[APNumber] == 0)
+    {
+        /*
+        ** Interpreted equations are not in the dependency index
+        */
+        NeedsEval = true;
+    }
+    else
+    {
+        NeedsEval = ((*DirtyWord & LC_BIT_MASK(APNumber)) != 0);
+
+        *DirtyWord &= ~LC_BIT_MASK(APNumber);
+    }
+
+    return NeedsEval;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile one RPN equation                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 LC_CompileRPN(const uint16 *RPNPtr, LC_RPNInstr_t *Code)
+{
+    uint16 SubStart[LC_MAX_RPN_EQU_SIZE];
+    uint16 JumpOwner[LC_MAX_RPN_EQU_SIZE];
+    uint16 JumpIndex[LC_MAX_RPN_EQU_SIZE];
+    uint16 RPNData;
+    uint16 Length;
+    uint16 Target;
+    int32  ErrIndex;
+    int32  ErrDepth;
+    int32  Depth;
+    int32  TokenIndex;
+    int32  EqualIndex;
+    int32  InstrIndex;
+
+    if (LC_ValidateRPN(RPNPtr, &ErrIndex, &ErrDepth) != LC_ADTVAL_ERR_NONE)
+    {
+        return 0;
+    }
+
+    /*
+    ** Find where the right operand of each AND and OR starts. The
+    ** stack holds the first token of each pending subexpression, and a
+    ** binary operator's subexpression starts where its left one did.
+    ** At most one operator's right operand starts at any token.
+    */
+    Depth = 0;
+    for (TokenIndex = 0; RPNPtr[TokenIndex] != LC_RPN_EQUAL; TokenIndex++)
+    {
+        RPNData               = RPNPtr[TokenIndex];
+        JumpOwner[TokenIndex] = LC_RPN_NO_JUMP;
+
+        if ((RPNData == LC_RPN_AND) || (RPNData == LC_RPN_OR))
+        {
+            JumpOwner[SubStart[--Depth]] = TokenIndex;
+        }
+        else if (RPNData == LC_RPN_XOR)
+        {
+            Depth--;
+        }
+        else if (RPNData != LC_RPN_NOT)
+        {
+            SubStart[Depth++] = TokenIndex;
+        }
+    }
+    EqualIndex = TokenIndex;
+
+    /*
+    ** Emit the program, putting each short-circuit jump just before
+    ** the right operand it skips. The jump goes to the instruction
+    ** after its operator, leaving the left operand as the result.
+    */
+    Length = 0;
+    for (TokenIndex = 0; TokenIndex < EqualIndex; TokenIndex++)
+    {
+        RPNData = RPNPtr[TokenIndex];
+
+        if (JumpOwner[TokenIndex] != LC_RPN_NO_JUMP)
+        {
+            JumpIndex[JumpOwner[TokenIndex]] = Length;
+
+            Code[Length].Opcode =
+                (RPNPtr[JumpOwner[TokenIndex]] == LC_RPN_AND) ? LC_RPN_OP_JUMP_FALSE : LC_RPN_OP_JUMP_TRUE;
+            Code[Length].Spare   = 0;
+            Code[Length].Operand = 0;
+            Length++;
+        }
+
+        Code[Length].Spare   = 0;
+        Code[Length].Operand = 0;
+
+        switch (RPNData)
+        {
+            case LC_RPN_AND:
+                Code[Length].Opcode                 = LC_RPN_OP_AND;
+                Code[JumpIndex[TokenIndex]].Operand = Length + 1;
+                break;
+
+            case LC_RPN_OR:
+                Code[Length].Opcode                 = LC_RPN_OP_OR;
+                Code[JumpIndex[TokenIndex]].Operand = Length + 1;
+                break;
+
+            case LC_RPN_XOR:
+                Code[Length].Opcode = LC_RPN_OP_XOR;
+                break;
+
+            case LC_RPN_NOT:
+                Code[Length].Opcode = LC_RPN_OP_NOT;
+                break;
+
+            default:
+                Code[Length].Opcode  = LC_RPN_OP_LOAD;
+                Code[Length].Operand = RPNData;
+                break;
+        }
+        Length++;
+    }
+
+    Code[Length].Opcode  = LC_RPN_OP_END;
+    Code[Length].Spare   = 0;
+    Code[Length].Operand = 0;
+    Length++;
+
+    /*
+    ** A jump that lands on a jump testing the same value will be taken
+    ** again, and one that lands on the opposite jump will fall through
+    ** it, since the stack top is unchanged. Chain through both so a run
+    ** of ANDs or ORs decided early exits in one step.
+    */
+    for (InstrIndex = Length - 1; InstrIndex >= 0; InstrIndex--)
+    {
+        if ((Code[InstrIndex].Opcode == LC_RPN_OP_JUMP_FALSE) || (Code[InstrIndex].Opcode == LC_RPN_OP_JUMP_TRUE))
+        {
+            Target = Code[InstrIndex].Operand;
+
+            while ((Code[Target].Opcode == LC_RPN_OP_JUMP_FALSE) || (Code[Target].Opcode == LC_RPN_OP_JUMP_TRUE))
+            {
+                if (Code[Target].Opcode == Code[InstrIndex].Opcode)
+                {
+                    Target = Code[Target].Operand;
+                }
+                else
+                {
+                    Target++;
+                }
+            }
+
+            Code[InstrIndex].Operand = Target;
+        }
+    }
+
+    return Length;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Validate the actionpoint definition table (ADT)                 */
@@ -565,6 +1484,14 @@ int32 LC_ValidateADT(void *TableData)
             BadCount++;
             EntryResult = LC_ADTVAL_ERR_EVTTYPE;
         }
+        else if ((TableArray[TableIndex].ActionOptions & ~LC_ACTION_OPT_MASK) != 0)
+        {
+            /*
+            ** Option bits this version does not define
+            */
+            BadCount++;
+            EntryResult = LC_ADTVAL_ERR_OPTIONS;
+        }
         else
         {
             /*
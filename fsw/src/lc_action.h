@@ -29,6 +29,7 @@
  *************************************************************************/
 #include "cfe.h"
 #include "lc_tbl.h"
+#include "lc_app.h"
 
 /************************************************************************
  * Macro Definitions
@@ -45,6 +46,40 @@
 
 /**\}*/
 
+/**
+ * \name Compiled actionpoint program opcodes
+ *
+ * Operators pop their operands from and push their result onto the
+ * program's stack, with the same four valued results as the RPN
+ * operators they replace
+ * \{
+ */
+#define LC_RPN_OP_END        0 /**< \brief End of program, result is on the stack       */
+#define LC_RPN_OP_LOAD       1 /**< \brief Push the result of watchpoint Operand        */
+#define LC_RPN_OP_AND        2 /**< \brief #LC_RPN_AND                                  */
+#define LC_RPN_OP_OR         3 /**< \brief #LC_RPN_OR                                   */
+#define LC_RPN_OP_XOR        4 /**< \brief #LC_RPN_XOR                                  */
+#define LC_RPN_OP_NOT        5 /**< \brief #LC_RPN_NOT                                  */
+#define LC_RPN_OP_JUMP_FALSE 6 /**< \brief Go to Operand if the stack top is false,
+                                           skipping the right operand of an AND        */
+#define LC_RPN_OP_JUMP_TRUE  7 /**< \brief Go to Operand if the stack top is true,
+                                           skipping the right operand of an OR         */
+/**\}*/
+
+/**
+ * \brief Equation token that starts no short-circuited operand
+ */
+#define LC_RPN_NO_JUMP 0xFFFF
+
+/**
+ * \name Compiled actionpoint evaluation forms
+ * \{
+ */
+#define LC_RPN_FORM_PROGRAM 0 /**< \brief Run the compiled program                          */
+#define LC_RPN_FORM_ALL     1 /**< \brief AND of every watchpoint in the equation's mask     */
+#define LC_RPN_FORM_ANY     2 /**< \brief OR of every watchpoint in the equation's mask      */
+/**\}*/
+
 /*************************************************************************
  * Exported Functions
  *************************************************************************/
@@ -97,6 +132,7 @@ void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex);
  *  \retval #LC_ADTVAL_ERR_FAILCNT  \copydoc LC_ADTVAL_ERR_FAILCNT
  *  \retval #LC_ADTVAL_ERR_EVTTYPE  \copydoc LC_ADTVAL_ERR_EVTTYPE
  *  \retval #LC_ADTVAL_ERR_RPN      \copydoc LC_ADTVAL_ERR_RPN
+ *  \retval #LC_ADTVAL_ERR_OPTIONS  \copydoc LC_ADTVAL_ERR_OPTIONS
  *
  *  \sa #LC_ValidateWDT
  */
@@ -113,6 +149,9 @@ int32 LC_ValidateADT(void *TableData);
  *       passive.  Other states are ignored since this routine is
  *       called in a loop to process ALL actionpoints.
  *
+ *       The equation is only evaluated if #LC_APNeedsEval says so,
+ *       otherwise the previous result is handled again.
+ *
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
@@ -130,7 +169,9 @@ void LC_SampleSingleAP(uint16 APNumber);
  *       actionpoint and returns the result
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       A compiled equation is evaluated by its watch mask or its
+ *       program, according to its form, otherwise the equation is
+ *       interpreted
  *
  *  \param [in]   APNumber     The actionpoint number to evaluate (zero
  *                             based actionpoint definition table index)
@@ -143,6 +184,285 @@ void LC_SampleSingleAP(uint16 APNumber);
  */
 uint8 LC_EvaluateRPN(uint16 APNumber);
 
+/**
+ * \brief Interpret RPN
+ *
+ *  \par Description
+ *       Support function for #LC_EvaluateRPN that interprets the
+ *       reverse polish notation (RPN) equation for the specified
+ *       actionpoint directly, checking it for errors as it goes
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Used for actionpoints that #LC_CompileActionpoints could
+ *       not compile
+ *
+ *  \param [in]   APNumber     The actionpoint number to evaluate (zero
+ *                             based actionpoint definition table index)
+ *
+ *  \return Reverse polish notation result
+ *  \retval #LC_ACTION_PASS  \copydoc LC_ACTION_PASS
+ *  \retval #LC_ACTION_FAIL  \copydoc LC_ACTION_FAIL
+ *  \retval #LC_ACTION_STALE \copydoc LC_ACTION_STALE
+ *  \retval #LC_ACTION_ERROR \copydoc LC_ACTION_ERROR
+ */
+uint8 LC_InterpretRPN(uint16 APNumber);
+
+/**
+ * \brief Run compiled actionpoint program
+ *
+ *  \par Description
+ *       Support function for #LC_EvaluateRPN that runs the program
+ *       compiled from the specified actionpoint's equation. The right
+ *       operand of an AND or OR is skipped when the left operand
+ *       already decides the result.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The program was built by #LC_CompileRPN from an equation that
+ *       passed #LC_ValidateRPN, so no checks are made while it runs.
+ *       Watchpoint results are read from #LC_OperData_t.WatchPlanes.
+ *
+ *  \param [in]   APNumber     The actionpoint number to evaluate (zero
+ *                             based actionpoint definition table index)
+ *
+ *  \return Reverse polish notation result
+ *  \retval #LC_ACTION_PASS  \copydoc LC_ACTION_PASS
+ *  \retval #LC_ACTION_FAIL  \copydoc LC_ACTION_FAIL
+ *  \retval #LC_ACTION_STALE \copydoc LC_ACTION_STALE
+ *  \retval #LC_ACTION_ERROR \copydoc LC_ACTION_ERROR
+ */
+uint8 LC_RunRPNProgram(uint16 APNumber);
+
+/**
+ * \brief Evaluate actionpoint watch mask
+ *
+ *  \par Description
+ *       Support function for #LC_EvaluateRPN that evaluates an
+ *       #LC_RPN_FORM_ALL or #LC_RPN_FORM_ANY equation by combining its
+ *       watch mask with the packed watchpoint results a word at a time,
+ *       however many watchpoints the equation references
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   APNumber     The actionpoint number to evaluate (zero
+ *                             based actionpoint definition table index)
+ *
+ *  \return Reverse polish notation result
+ *  \retval #LC_ACTION_PASS  \copydoc LC_ACTION_PASS
+ *  \retval #LC_ACTION_FAIL  \copydoc LC_ACTION_FAIL
+ *  \retval #LC_ACTION_STALE \copydoc LC_ACTION_STALE
+ *  \retval #LC_ACTION_ERROR \copydoc LC_ACTION_ERROR
+ */
+uint8 LC_EvaluateWatchMask(uint16 APNumber);
+
+/**
+ * \brief Get packed watchpoint result
+ *
+ *  \par Description
+ *       Returns the result of a watchpoint from
+ *       #LC_OperData_t.WatchPlanes
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   WatchIndex   The watchpoint number (zero based
+ *                             watchpoint definition table index)
+ *
+ *  \return Watchpoint result
+ *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
+ *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
+ *  \retval #LC_WATCH_ERROR \copydoc LC_WATCH_ERROR
+ *  \retval #LC_WATCH_STALE \copydoc LC_WATCH_STALE
+ */
+uint8 LC_GetPlaneResult(uint16 WatchIndex);
+
+/**
+ * \brief Compile actionpoint equations
+ *
+ *  \par Description
+ *       Compiles the RPN equation of every actionpoint in the loaded
+ *       actionpoint definition table into #LC_OperData_t.RPNProgram
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called each time a new actionpoint definition table is loaded
+ */
+void LC_CompileActionpoints(void);
+
+/**
+ * \brief Classify compiled actionpoint equation
+ *
+ *  \par Description
+ *       Support function for #LC_CompileActionpoints that sets the
+ *       evaluation form of a compiled equation. An equation made only
+ *       of watchpoints and ANDs is #LC_RPN_FORM_ALL, one made only of
+ *       watchpoints and ORs is #LC_RPN_FORM_ANY, and both get a watch
+ *       mask of the watchpoints they reference. Any other equation is
+ *       #LC_RPN_FORM_PROGRAM.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       AND and OR are associative, commutative and idempotent over
+ *       the four watchpoint results, so the grouping and repetition of
+ *       watchpoints in such an equation do not affect its result
+ *
+ *  \param [in]   APNumber     The actionpoint number to classify (zero
+ *                             based actionpoint definition table index)
+ */
+void LC_ClassifyRPN(uint16 APNumber);
+
+/**
+ * \brief Build packed watchpoint results
+ *
+ *  \par Description
+ *       Support function for #LC_CompileActionpoints that loads
+ *       #LC_OperData_t.WatchPlanes from the watchpoint results table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void LC_BuildWatchPlanes(void);
+
+/**
+ * \brief Build actionpoint dependency index
+ *
+ *  \par Description
+ *       Support function for #LC_CompileActionpoints that lists, for
+ *       each watchpoint, the compiled actionpoints that reference it in
+ *       #LC_OperData_t.APDepends, then marks every actionpoint dirty
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Actionpoints that did not compile are not listed; they are
+ *       always evaluated when sampled
+ */
+void LC_BuildAPDepends(void);
+
+/**
+ * \brief Watchpoint result changed
+ *
+ *  \par Description
+ *       Copies the watchpoint's result from the watchpoint results
+ *       table into the packed watchpoint results, then marks every
+ *       actionpoint that references the watchpoint as needing its
+ *       equation evaluated on its next sample. Called whenever the
+ *       watchpoint's result changes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   WatchIndex   The watchpoint number whose result changed
+ *                             (zero based watchpoint definition table index)
+ */
+void LC_WatchResultChanged(uint16 WatchIndex);
+
+/**
+ * \brief Queue immediate actionpoints
+ *
+ *  \par Description
+ *       Queues every actionpoint with #LC_ACTION_OPT_IMMEDIATE that
+ *       references the watchpoint for evaluation by
+ *       #LC_RunImmediateAPs. Called when processing a packet changes
+ *       the watchpoint's result.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   WatchIndex   The watchpoint number whose result changed
+ *                             (zero based watchpoint definition table index)
+ */
+void LC_QueueImmediateAPs(uint16 WatchIndex);
+
+/**
+ * \brief Run immediate actionpoints
+ *
+ *  \par Description
+ *       Samples each actionpoint queued by #LC_QueueImmediateAPs, as a
+ *       sample request would, unless it has already been evaluated
+ *       MaxImmediateEvals times since its last sample request. Records
+ *       the time from the packet to each RTS request this makes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once a packet's watchpoints have been processed. An
+ *       actionpoint over its limit is left for the next sample request.
+ *
+ *  \param [in]   PacketTime   Time stamp of the packet that changed the
+ *                             watchpoint results, resolved only if an
+ *                             RTS is requested
+ */
+void LC_RunImmediateAPs(LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Record RTS latency
+ *
+ *  \par Description
+ *       Support function for #LC_RunImmediateAPs that updates the
+ *       last and peak packet to RTS request times, in microseconds
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Times too long for the counters are recorded as 0xFFFFFFFF
+ *
+ *  \param [in]   Timestamp    Time stamp of the packet that led to the
+ *                             RTS request
+ */
+void LC_RecordRTSLatency(CFE_TIME_SysTime_t Timestamp);
+
+/**
+ * \brief Mark actionpoint dirty
+ *
+ *  \par Description
+ *       Marks the actionpoint as needing its equation evaluated on
+ *       its next sample
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   APNumber     The actionpoint number (zero based
+ *                             actionpoint definition table index)
+ */
+void LC_MarkAPDirty(uint16 APNumber);
+
+/**
+ * \brief Check whether actionpoint needs evaluation
+ *
+ *  \par Description
+ *       Support function for #LC_SampleSingleAP that reports whether
+ *       the actionpoint's equation must be evaluated, and clears its
+ *       dirty mark
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An actionpoint that did not compile always needs evaluation
+ *
+ *  \param [in]   APNumber     The actionpoint number (zero based
+ *                             actionpoint definition table index)
+ *
+ *  \return Evaluation needed
+ *  \retval true  A referenced watchpoint result changed since the last
+ *                evaluation, or the equation is interpreted
+ *  \retval false The previous result still holds
+ */
+bool LC_APNeedsEval(uint16 APNumber);
+
+/**
+ * \brief Compile RPN equation
+ *
+ *  \par Description
+ *       Support function for #LC_CompileActionpoints that turns one
+ *       reverse polish notation (RPN) equation into a program. Each
+ *       AND and OR gets a jump after its left operand that skips the
+ *       right operand when the left one decides the result, and jumps
+ *       that land on a jump testing the same value are chained through.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   RPNPtr     Pointer to the RPN equation
+ *
+ *  \param [out]  Code       Program buffer of #LC_RPN_PROGRAM_SIZE
+ *                           instructions
+ *
+ *  \return Number of instructions in the program, or zero if the
+ *          equation does not pass #LC_ValidateRPN
+ */
+uint16 LC_CompileRPN(const uint16 *RPNPtr, LC_RPNInstr_t *Code);
+
 /**
  * \brief Validate RPN expression
  *
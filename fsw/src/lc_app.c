@@ -58,6 +58,8 @@ void LC_AppMain(void)
     bool             Initialized = false;
     uint32           RunStatus   = CFE_ES_RunStatus_APP_RUN;
     CFE_SB_Buffer_t *BufPtr      = NULL;
+    uint32           IdleTime    = 0;
+    uint16           CtrlBatch   = 0;
 
     /*
     ** Performance Log, Start
@@ -96,9 +98,10 @@ void LC_AppMain(void)
         CFE_ES_PerfLogExit(LC_APPMAIN_PERF_ID);
 
         /*
-        ** Pend on the arrival of the next Software Bus message
+        ** Pend on the arrival of the next monitor packet, waking
+        ** regularly to check the control pipe
         */
-        Status = CFE_SB_ReceiveBuffer(&BufPtr, LC_OperData.CmdPipe, LC_SB_TIMEOUT);
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, LC_OperData.CmdPipe, LC_CTRL_PIPE_PEND_TIME);
 
         /*
         ** Performance Log, Start
@@ -108,21 +111,34 @@ void LC_AppMain(void)
         /*
         ** Process the software bus message
         */
-        if (Status == CFE_SB_TIME_OUT)
+        if ((Status == CFE_SB_TIME_OUT) || (Status == CFE_SB_NO_MESSAGE))
         {
+            if (Status == CFE_SB_TIME_OUT)
+            {
+                IdleTime += LC_CTRL_PIPE_PEND_TIME;
+            }
+
+            /* No monitor packet, but control messages may be waiting */
+            Status = LC_DrainCtrlPipe(&CtrlBatch);
+
+            if (CtrlBatch > 0)
+            {
+                IdleTime = 0;
+            }
+
             /* Note: these routine actions are generally done in the
              * housekeeping cycle.  If we are not getting messages as
              * expected, the routine actions are done here instead. */
-            Status = LC_PerformMaintenance();
-        }
-        else if (Status == CFE_SB_NO_MESSAGE)
-        {
-            /* no action, but also no error */
-            Status = CFE_SUCCESS;
+            if ((Status == CFE_SUCCESS) && (IdleTime >= LC_SB_TIMEOUT))
+            {
+                IdleTime = 0;
+                Status   = LC_PerformMaintenance();
+            }
         }
         else if (Status == CFE_SUCCESS)
         {
-            LC_AppPipe(BufPtr);
+            IdleTime = 0;
+            Status   = LC_DrainCmdPipe(BufPtr);
         }
 
         /*
@@ -164,6 +180,11 @@ void LC_AppMain(void)
     */
     CFE_ES_PerfLogExit(LC_APPMAIN_PERF_ID);
 
+    /*
+    ** Make the final CDS update from the main task
+    */
+    LC_StopCDSWriter();
+
     /*
     ** Do not update CDS if inactive or startup was incomplete
     */
@@ -178,6 +199,151 @@ void LC_AppMain(void)
     CFE_ES_ExitApp(RunStatus);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a batch of messages from the command pipe               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t LC_DrainCmdPipe(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_Status_t     Status     = CFE_SUCCESS;
+    CFE_SB_Buffer_t *NextBufPtr = NULL;
+    uint16           BatchSize  = 0;
+    uint16           CtrlBatch;
+
+    do
+    {
+        /*
+        ** Control messages never wait behind a monitor packet,
+        ** an empty control pipe costs a single poll
+        */
+        Status = LC_DrainCtrlPipe(&CtrlBatch);
+
+        if (Status == CFE_SUCCESS)
+        {
+            LC_AppPipe(BufPtr);
+            BatchSize++;
+
+            /*
+            ** Take whatever else is already waiting, up to the limit,
+            ** without pending for more
+            */
+            if (BatchSize <= LC_PIPE_DRAIN_LIMIT)
+            {
+                Status = CFE_SB_ReceiveBuffer(&NextBufPtr, LC_OperData.CmdPipe, CFE_SB_POLL);
+                BufPtr = NextBufPtr;
+            }
+        }
+    } while ((Status == CFE_SUCCESS) && (BatchSize <= LC_PIPE_DRAIN_LIMIT));
+
+    /* An empty pipe just ends the batch */
+    if (Status == CFE_SB_NO_MESSAGE)
+    {
+        Status = CFE_SUCCESS;
+    }
+    else if (Status == CFE_SUCCESS)
+    {
+        /* The limit ended the batch, more packets may be waiting */
+        LC_OperData.PipeLimitCount++;
+    }
+
+    LC_OperData.LastPipeBatch = BatchSize;
+
+    if (BatchSize > LC_OperData.PeakPipeBatch)
+    {
+        LC_OperData.PeakPipeBatch = BatchSize;
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process every message waiting on the control pipe               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t LC_DrainCtrlPipe(uint16 *BatchSize)
+{
+    CFE_Status_t     Status = CFE_SUCCESS;
+    CFE_SB_Buffer_t *BufPtr = NULL;
+    uint16           Count  = 0;
+
+    /*
+    ** Stop at the pipe depth in case requests keep arriving
+    */
+    while ((Count < LC_CTRL_PIPE_DEPTH) && (Status == CFE_SUCCESS))
+    {
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, LC_OperData.CtrlPipe, CFE_SB_POLL);
+
+        if (Status == CFE_SUCCESS)
+        {
+            LC_AppPipe(BufPtr);
+            Count++;
+        }
+    }
+
+    /* An empty pipe is the usual case */
+    if (Status == CFE_SB_NO_MESSAGE)
+    {
+        Status = CFE_SUCCESS;
+    }
+
+    if (Count > 0)
+    {
+        LC_OperData.LastCtrlBatch = Count;
+
+        if (Count > LC_OperData.PeakCtrlBatch)
+        {
+            LC_OperData.PeakCtrlBatch = Count;
+        }
+    }
+
+    *BatchSize = Count;
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count a gap in a MessageID's sequence counts                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CheckMsgSequence(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr)
+{
+    LC_MsgSeq_t            *MsgSeq;
+    CFE_MSG_SequenceCount_t SeqCount = 0;
+
+    /* Ground commands have no single source to keep a count */
+    if ((MessageList != NULL) && (MessageList->Handler != LC_MSG_HANDLER_CMD))
+    {
+        MsgSeq = &LC_OperData.MsgSeq[MessageList - LC_OperData.MsgIndex->MessageList];
+
+        CFE_MSG_GetSequenceCount(&BufPtr->Msg, &SeqCount);
+
+        /* A repeated count is a sender that does not increment it */
+        if ((MsgSeq->Valid == true) && (SeqCount != MsgSeq->SeqCount) &&
+            (SeqCount != CFE_MSG_GetNextSequenceCount(MsgSeq->SeqCount)))
+        {
+            if (MessageList->Handler == LC_MSG_HANDLER_WATCH)
+            {
+                LC_OperData.MonPipeGaps++;
+            }
+            else
+            {
+                LC_OperData.CtrlPipeGaps++;
+            }
+        }
+
+        MsgSeq->SeqCount = SeqCount;
+        MsgSeq->Valid    = true;
+    }
+
+    return;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* LC initialization                                               */
@@ -194,6 +360,17 @@ CFE_Status_t LC_AppInit(void)
     memset(&LC_OperData, 0, sizeof(LC_OperData));
     memset(&LC_AppData, 0, sizeof(LC_AppData));
 
+    /*
+    ** Dispatch packets with an empty index until the WDT is loaded
+    */
+    LC_OperData.MsgIndex        = &LC_OperData.MsgIndexBuf[0];
+    LC_OperData.HashBuild.Index = &LC_OperData.MsgIndexBuf[1];
+
+    /*
+    ** Every CDS area is written on the first update
+    */
+    LC_OperData.CDSDirty = LC_CDS_DIRTY_ALL;
+
     /*
     ** Initialize event services
     */
@@ -215,6 +392,14 @@ CFE_Status_t LC_AppInit(void)
         Status = LC_TableInit();
     }
 
+    /*
+    ** Optionally move CDS writes off the main task
+    */
+    if ((Status == CFE_SUCCESS) && (LC_CDS_WRITER_TASK == true) && (LC_OperData.HaveActiveCDS))
+    {
+        LC_CreateCDSWriter();
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /*
@@ -290,12 +475,27 @@ CFE_Status_t LC_SbInit(void)
                           (unsigned int)Status);
     }
 
+    if (Status == CFE_SUCCESS)
+    {
+        /*
+        ** Create the control pipe, kept apart from the monitor packets...
+        */
+        Status = CFE_SB_CreatePipe(&LC_OperData.CtrlPipe, LC_CTRL_PIPE_DEPTH, LC_CTRL_PIPE_NAME);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(LC_CR_PIPE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error Creating LC Control Pipe, RC=0x%08X",
+                              (unsigned int)Status);
+        }
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /*
         ** Subscribe to Housekeeping request messages...
         */
-        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(LC_SEND_HK_MID), LC_OperData.CmdPipe);
+        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(LC_SEND_HK_MID), LC_OperData.CtrlPipe);
         if (Status != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(LC_SUB_HK_REQ_ERR_EID,
@@ -311,7 +511,7 @@ CFE_Status_t LC_SbInit(void)
         /*
         ** Subscribe to LC ground command messages...
         */
-        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(LC_CMD_MID), LC_OperData.CmdPipe);
+        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(LC_CMD_MID), LC_OperData.CtrlPipe);
         if (Status != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(LC_SUB_GND_CMD_ERR_EID,
@@ -327,7 +527,7 @@ CFE_Status_t LC_SbInit(void)
         /*
         ** Subscribe to LC internal actionpoint sample messages...
         */
-        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(LC_SAMPLE_AP_MID), LC_OperData.CmdPipe);
+        Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(LC_SAMPLE_AP_MID), LC_OperData.CtrlPipe);
         if (Status != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(LC_SUB_SAMPLE_CMD_ERR_EID,
@@ -490,6 +690,16 @@ CFE_Status_t LC_TableInit(void)
     {
         LC_CreateHashTable();
 
+        /*
+        ** Resume the countdowns to stale kept in the results table
+        */
+        LC_BuildStaleWheel();
+
+        /*
+        ** Compile actionpoint equations
+        */
+        LC_CompileActionpoints();
+
         /*
         ** Display results of CDS initialization (if enabled at startup)
         */
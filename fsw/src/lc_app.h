@@ -30,6 +30,7 @@
 #include "cfe.h"
 #include "lc_msg.h"
 #include "lc_tbl.h"
+#include "lc_platform_cfg.h"
 
 /************************************************************************
  * Macro Definitions
@@ -48,7 +49,18 @@
  * \name LC Command Pipe Parameters
  * \{
  */
-#define LC_PIPE_NAME "LC_CMD_PIPE"
+#define LC_PIPE_NAME      "LC_CMD_PIPE"
+#define LC_CTRL_PIPE_NAME "LC_CTRL_PIPE"
+/**\}*/
+
+/**
+ * \name LC CDS Writer Task Parameters
+ * \{
+ */
+#define LC_CDS_WRITER_NAME         "LC_CDS_WRITER"
+#define LC_CDS_WRITER_SEM_NAME     "LC_CDS_WAKE"
+#define LC_CDS_DONE_SEM_NAME       "LC_CDS_DONE"
+#define LC_CDS_WRITER_STOP_TIMEOUT 2000 /**< \brief Milliseconds to wait for the writer to exit */
 /**\}*/
 
 /**
@@ -85,6 +97,16 @@
 #define LC_ADT_NOT_CRITICAL 0x00800000
 /**\}*/
 
+/**
+ * \name CDS Areas Changed Since Last Written
+ * \{
+ */
+#define LC_CDS_DIRTY_WRT     0x01 /**< \brief Watchpoint results changed  */
+#define LC_CDS_DIRTY_ART     0x02 /**< \brief Actionpoint results changed */
+#define LC_CDS_DIRTY_APPDATA 0x04 /**< \brief Application data changed    */
+#define LC_CDS_DIRTY_ALL     (LC_CDS_DIRTY_WRT | LC_CDS_DIRTY_ART | LC_CDS_DIRTY_APPDATA)
+/**\}*/
+
 /**
  * \brief Wakeup for LC
  *
@@ -95,84 +117,390 @@
 #define LC_SB_TIMEOUT 1000
 
 /**
- * \name Hash table definitions - presumes MessageID as hash function input
+ * \name Dispatch index message handlers
+ *
+ * Every MessageID on LC's pipes resolves to one of these through
+ * the dispatch index, so LC's own MessageIDs share the monitor packet
+ * lookup instead of being compared in turn
  * \{
  */
-#define LC_HASH_TABLE_ENTRIES 256    /**< \brief Hash table number of entries */
-#define LC_HASH_TABLE_MASK    0x00FF /**< \brief Hash table mask */
+#define LC_MSG_HANDLER_WATCH     0 /**< \brief Monitor packet, evaluate its watchpoints */
+#define LC_MSG_HANDLER_SAMPLE_AP 1 /**< \brief Sample actionpoints request             */
+#define LC_MSG_HANDLER_SEND_HK   2 /**< \brief Housekeeping request                     */
+#define LC_MSG_HANDLER_CMD       3 /**< \brief LC ground command                        */
+
+#define LC_MSG_HANDLER_MIDS 3 /**< \brief Number of MessageIDs LC handles itself */
 /**\}*/
 
-/** \brief Linked list of Watchpoints that reference the same MessageID */
-typedef struct LC_WListTag
-{
-    struct LC_WListTag *Next; /**< \brief Next linked list element */
+/**
+ * \brief Dispatch index entries, one per referenced MessageID plus LC's own
+ */
+#define LC_MSG_INDEX_ENTRIES (LC_MAX_WATCHPOINTS + LC_MSG_HANDLER_MIDS)
+
+/**
+ * \name Watchpoint dispatch index definitions
+ *
+ * The dispatch index is a hash-and-displace perfect hash over the set of
+ * MessageIDs referenced by the loaded Watchpoint Definition Table and the
+ * MessageIDs LC handles itself. The slot table is sized to the next power
+ * of two that is at least twice #LC_MSG_INDEX_ENTRIES so the table is never
+ * more than half full, and there is one displacement bucket for every four
+ * slots.
+ * \{
+ */
+#if (LC_MSG_INDEX_ENTRIES <= 64)
+#define LC_HASH_SLOT_BITS 7
+#elif (LC_MSG_INDEX_ENTRIES <= 128)
+#define LC_HASH_SLOT_BITS 8
+#elif (LC_MSG_INDEX_ENTRIES <= 256)
+#define LC_HASH_SLOT_BITS 9
+#elif (LC_MSG_INDEX_ENTRIES <= 512)
+#define LC_HASH_SLOT_BITS 10
+#elif (LC_MSG_INDEX_ENTRIES <= 1024)
+#define LC_HASH_SLOT_BITS 11
+#elif (LC_MSG_INDEX_ENTRIES <= 2048)
+#define LC_HASH_SLOT_BITS 12
+#elif (LC_MSG_INDEX_ENTRIES <= 4096)
+#define LC_HASH_SLOT_BITS 13
+#elif (LC_MSG_INDEX_ENTRIES <= 8192)
+#define LC_HASH_SLOT_BITS 14
+#elif (LC_MSG_INDEX_ENTRIES <= 16384)
+#define LC_HASH_SLOT_BITS 15
+#elif (LC_MSG_INDEX_ENTRIES <= 32768)
+#define LC_HASH_SLOT_BITS 16
+#else
+#define LC_HASH_SLOT_BITS 17
+#endif
+
+#define LC_HASH_SLOT_ENTRIES  (1UL << LC_HASH_SLOT_BITS)    /**< \brief Number of slots in the hash table  */
+#define LC_HASH_SLOT_MASK     (LC_HASH_SLOT_ENTRIES - 1)     /**< \brief Hash table slot mask              */
+#define LC_HASH_TABLE_ENTRIES (LC_HASH_SLOT_ENTRIES >> 2)    /**< \brief Number of displacement buckets    */
+#define LC_HASH_TABLE_MASK    (LC_HASH_TABLE_ENTRIES - 1)    /**< \brief Displacement bucket mask          */
+#define LC_HASH_SLOT_EMPTY    0xFFFF                         /**< \brief Hash table slot not in use        */
+#define LC_HASH_MAX_SEEDS     16                             /**< \brief Seeds tried before build gives up */
+/**\}*/
 
-    uint16 WatchIndex; /**< \brief Watchpoint table index   */
-    uint16 Spare;      /**< \brief Structure alignment pad  */
-} LC_WatchPtList_t;
+/**
+ * \brief Align compiled watchpoint program arrays to a cache line
+ */
+#ifdef __GNUC__
+#define LC_CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define LC_CACHE_ALIGNED
+#endif
 
-/** \brief Linked list of MessageID's with same hash function result */
-typedef struct LC_MListTag
+/**
+ *  \brief Compiled watchpoint program
+ *
+ *  Structure of arrays generated from the Watchpoint Definition Table.
+ *  Element N describes the watchpoint at #LC_MsgIndex_t.WatchPtList[N],
+ *  so the watchpoints for one MessageID are contiguous in every array.
+ *  Within a MessageID, watchpoints with the same opcode and extractor
+ *  are adjacent so they can be evaluated as a batch.
+ */
+typedef struct
 {
-    struct LC_MListTag *Next; /**< \brief Next linked list element */
+    uint32 Offset[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED;        /**< \brief Byte offset of the data in the packet */
+    uint32 BitMask[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED;       /**< \brief Mask applied to the extracted data   */
+    uint32 Compare[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED;       /**< \brief Comparison value, sign or zero
+                                                                           extended to 32 bits                 */
+    uint32 SecondCompare[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED; /**< \brief Second comparison value of range
+                                                                           operators, extended the same way    */
+    uint8  Extract[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED;       /**< \brief How to extract the data             */
+    uint8  Opcode[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED;        /**< \brief Comparison kind and operator        */
+    uint16 RunLength[LC_MAX_WATCHPOINTS] LC_CACHE_ALIGNED;     /**< \brief Like watchpoints from this one to
+                                                                           the end of its batchable run        */
+} LC_WatchProgram_t;
 
-    CFE_SB_MsgId_t MessageID; /**< \brief MessageID for this link  */
-    uint16         Spare;     /**< \brief Structure alignment pad  */
+/**
+ * \brief Message extent of a span with a watchpoint of unknown size
+ */
+#define LC_MSG_EXTENT_UNKNOWN 0xFFFFFFFF
 
-    LC_WatchPtList_t *WatchPtList; /**< \brief Watchpoint list for this MessageID */
+/**
+ * \brief Digest start of a span that does not use a packet digest
+ */
+#define LC_MSG_DIGEST_OFF 0xFFFFFFFF
+
+/**
+ *  \brief Dispatch index entry for one referenced MessageID
+ *
+ *  The watchpoints that reference the MessageID occupy the contiguous
+ *  span [WatchStart, WatchStart + WatchCount) of #LC_MsgIndex_t.WatchPtList
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID;   /**< \brief MessageID for this entry                      */
+    uint16         WatchStart;  /**< \brief First element of this MessageID's watch span   */
+    uint16         WatchCount;  /**< \brief Number of watchpoints that reference MessageID */
+    uint32         MaxExtent;   /**< \brief Packet length that puts every watchpoint in the
+                                             span in bounds, or #LC_MSG_EXTENT_UNKNOWN      */
+    uint32         DigestStart; /**< \brief First byte of the packet digest, which ends at
+                                             MaxExtent, or #LC_MSG_DIGEST_OFF               */
+    uint8          Handler;     /**< \brief How packets with this MessageID are processed,
+                                             #LC_MSG_HANDLER_WATCH for monitor packets      */
 } LC_MessageList_t;
 
-/************************************************************************
- * Type Definitions
- ************************************************************************/
+/**
+ *  \brief Watchpoint dispatch index
+ *
+ *  Built from the Watchpoint Definition Table each time it is loaded and
+ *  read-only once published to packet processing
+ */
+typedef struct
+{
+    uint16 MessageIDsCount; /**< \brief Count of unique MessageIDs referenced
+                                        in the Watchpoint Definition Table
+                                        or handled by LC itself              */
+    uint16 WatchpointCount; /**< \brief Count of in-use watchpoints defined
+                                        in the Watchpoint Definition Table   */
+
+    uint32 HashSeed;  /**< \brief Seed the perfect hash was built with          */
+    bool   HashValid; /**< \brief Perfect hash was built for the current table */
+
+    uint32 HashDisp[LC_HASH_TABLE_ENTRIES]; /**< \brief Displacement for each hash bucket */
+    uint16 HashSlots[LC_HASH_SLOT_ENTRIES]; /**< \brief MessageList index for each slot,
+                                                        or #LC_HASH_SLOT_EMPTY             */
+
+    LC_MessageList_t MessageList[LC_MSG_INDEX_ENTRIES]; /**< \brief One entry per referenced MessageID  */
+    uint16           WatchPtList[LC_MAX_WATCHPOINTS];   /**< \brief Watchpoint table indexes grouped
+                                                                    by MessageID                       */
+
+    LC_WatchProgram_t Program; /**< \brief Compiled watchpoints, aligned with WatchPtList */
+} LC_MsgIndex_t;
 
 /**
- *  \brief LC Operational Data Structure
+ *  \brief Scratch storage used only while the dispatch index is built
+ */
+typedef struct
+{
+    LC_MsgIndex_t *Index; /**< \brief Dispatch index being built */
+
+    uint16 BucketHead[LC_HASH_TABLE_ENTRIES]; /**< \brief First MessageList index in each bucket */
+    uint16 BucketSize[LC_HASH_TABLE_ENTRIES]; /**< \brief Number of MessageIDs in each bucket    */
+    uint16 BucketNext[LC_MSG_INDEX_ENTRIES];  /**< \brief Next MessageList index in same bucket  */
+    uint16 WatchFill[LC_MSG_INDEX_ENTRIES];   /**< \brief Next free span element per MessageID   */
+    uint16 Lookup[LC_HASH_SLOT_ENTRIES];      /**< \brief Open addressed MessageID lookup table  */
+    uint16 GroupOrder[LC_MAX_WATCHPOINTS];    /**< \brief Watchpoint list sorted by group key   */
+    bool   Subscribed[LC_MSG_INDEX_ENTRIES];  /**< \brief MessageID was subscribed before
+                                                          the index was rebuilt              */
+} LC_HashBuild_t;
+
+/**
+ *  \brief Last evaluated sample of a watchpoint
  *
- *  The operational data is not saved to the CDS
+ *  Kept beside the Watchpoint Results Table so an unchanged sample can
+ *  reuse the previous result instead of running the comparison again
  */
 typedef struct
 {
-    CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID                      */
+    uint64 RawValue; /**< \brief Masked watchpoint data of the last evaluation */
+    uint8  Result;   /**< \brief Result of the last evaluation                 */
+    bool   Valid;    /**< \brief Change-only watchpoint may reuse Result       */
+} LC_WatchCache_t;
 
-    LC_WDTEntry_t *WDTPtr; /**< \brief Watchpoint  Definition Table Pointer */
-    LC_ADTEntry_t *ADTPtr; /**< \brief Actionpoint Definition Table Pointer */
+/**
+ *  \brief Digest of the watched bytes of the last packet for one MessageID
+ */
+typedef struct
+{
+    uint64 Digest;                     /**< \brief Digest of the last fully evaluated packet */
+    bool   Valid;                      /**< \brief Digest may be compared                    */
+    uint8  Bytes[LC_DIGEST_MAX_BYTES]; /**< \brief Watched bytes the digest was taken over,
+                                                   compared when the digest matches      */
+} LC_MsgDigest_t;
 
-    LC_WRTEntry_t *WRTPtr; /**< \brief Watchpoint  Results Table Pointer    */
-    LC_ARTEntry_t *ARTPtr; /**< \brief Actionpoint Results Table Pointer    */
+/**
+ *  \brief Sequence count of the last packet received for one MessageID
+ */
+typedef struct
+{
+    CFE_MSG_SequenceCount_t SeqCount; /**< \brief Sequence count of the last packet */
+    bool                    Valid;    /**< \brief SeqCount may be compared         */
+} LC_MsgSeq_t;
 
-    CFE_TBL_Handle_t WDTHandle; /**< \brief Watchpoint  Definition Table Handle  */
-    CFE_TBL_Handle_t ADTHandle; /**< \brief Actionpoint Definition Table Handle  */
+/**
+ *  \brief Time stamp of the packet being processed
+ *
+ *  Resolved by #LC_GetPacketTime the first time it is needed, so a
+ *  packet that changes no watchpoint result reads no time at all
+ */
+typedef struct
+{
+    const CFE_SB_Buffer_t *BufPtr;    /**< \brief Packet being processed      */
+    CFE_TIME_SysTime_t     Timestamp; /**< \brief Packet time, once resolved  */
+    bool                   Resolved;  /**< \brief Timestamp has been resolved */
+} LC_PacketTime_t;
 
-    CFE_TBL_Handle_t WRTHandle; /**< \brief Watchpoint  Results Table Handle     */
-    CFE_TBL_Handle_t ARTHandle; /**< \brief Actionpoint Results Table Handle     */
+/**
+ * \name Bit set definitions
+ * \{
+ */
+#define LC_WATCH_PLANE_WORDS ((LC_MAX_WATCHPOINTS + 31) / 32) /**< \brief Words in a watch result plane */
 
-    CFE_ES_CDSHandle_t WRTDataCDSHandle; /**< \brief Watchpoint  Results Table CDS Handle */
-    CFE_ES_CDSHandle_t ARTDataCDSHandle; /**< \brief Actionpoint Results Table CDS Handle */
+#define LC_BIT_WORD(Index) ((Index) / 32)                /**< \brief Bit set word holding Index */
+#define LC_BIT_MASK(Index) ((uint32)1 << ((Index) % 32)) /**< \brief Bit of Index in its word   */
+/**\}*/
 
-    CFE_ES_CDSHandle_t AppDataCDSHandle; /**< \brief Application Data CDS Handle          */
+/**
+ * \brief Longest compiled actionpoint program
+ *
+ * Every AND and OR in an equation adds a short-circuit jump, and an
+ * equation holds fewer binary operators than half its size
+ */
+#define LC_RPN_PROGRAM_SIZE (LC_MAX_RPN_EQU_SIZE + (LC_MAX_RPN_EQU_SIZE / 2))
 
-    uint16 WatchpointCount; /**< \brief Count of in-use watchpoints defined
-                                        in the Watchpoint Definition Table   */
+/**
+ *  \brief Compiled actionpoint program instruction
+ */
+typedef struct
+{
+    uint8  Opcode;  /**< \brief One of the LC_RPN_OP_ opcodes               */
+    uint8  Spare;   /**< \brief Structure padding                           */
+    uint16 Operand; /**< \brief Watchpoint number of a load, or instruction
+                                 index a short-circuit jump goes to         */
+} LC_RPNInstr_t;
 
-    uint16 MessageIDsCount; /**< \brief Count of unique MessageIDs referenced
-                                        in the Watchpoint Definition Table   */
+/**
+ *  \brief Compiled actionpoint programs
+ *
+ *  Built from the Actionpoint Definition Table each time it is loaded.
+ *  An actionpoint whose equation did not compile has a length of zero
+ *  and is evaluated by interpreting its RPN equation.
+ */
+typedef struct
+{
+    LC_RPNInstr_t Code[LC_MAX_ACTIONPOINTS][LC_RPN_PROGRAM_SIZE];       /**< \brief Program for each actionpoint */
+    uint16        Length[LC_MAX_ACTIONPOINTS];                          /**< \brief Instructions in each program,
+                                                                                  zero if not compiled         */
+    uint8         Form[LC_MAX_ACTIONPOINTS];                            /**< \brief One of the LC_RPN_FORM_
+                                                                                  evaluation forms             */
+    uint32        WatchMask[LC_MAX_ACTIONPOINTS][LC_WATCH_PLANE_WORDS]; /**< \brief Watchpoints combined by an
+                                                                                  #LC_RPN_FORM_ALL or
+                                                                                  #LC_RPN_FORM_ANY equation    */
+    uint16        MaskStart[LC_MAX_ACTIONPOINTS];                       /**< \brief First nonzero word of
+                                                                                  each watch mask              */
+    uint16        MaskEnd[LC_MAX_ACTIONPOINTS];                         /**< \brief One past the last nonzero
+                                                                                  word of each watch mask      */
+} LC_RPNProgram_t;
 
-    LC_HkPacket_t HkPacket; /**< \brief Housekeeping telemetry packet        */
+/**
+ * \name Actionpoint dependency index definitions
+ * \{
+ */
+#define LC_RPN_MAX_WATCH_REFS ((LC_MAX_RPN_EQU_SIZE + 1) / 2)   /**< \brief Most watchpoints one equation
+                                                                           can reference                 */
+#define LC_AP_SET_WORDS       ((LC_MAX_ACTIONPOINTS + 31) / 32) /**< \brief Words in an actionpoint bit set */
+/**\}*/
 
-    uint32 TableResults; /**< \brief Table and CDS initialization results */
+/**
+ *  \brief Actionpoint dependency index
+ *
+ *  Lists, for each watchpoint, the compiled actionpoints whose equations
+ *  reference it. The actionpoints for watchpoint N occupy the span
+ *  [RefStart[N], RefStart[N + 1]) of RefList. An actionpoint is marked
+ *  dirty when the result of a watchpoint it references changes, and only
+ *  dirty actionpoints have their equations evaluated when sampled.
+ */
+typedef struct
+{
+    uint32 RefStart[LC_MAX_WATCHPOINTS + 1];                     /**< \brief First RefList element of each
+                                                                             watchpoint, and the end of the last */
+    uint16 RefList[LC_MAX_ACTIONPOINTS * LC_RPN_MAX_WATCH_REFS]; /**< \brief Actionpoints grouped by the
+                                                                             watchpoints they reference          */
+    uint32 Dirty[LC_AP_SET_WORDS];                               /**< \brief Bit set for each actionpoint with
+                                                                             a changed input since it was last
+                                                                             evaluated                           */
+} LC_APDepends_t;
+
+/**
+ *  \brief Packed watchpoint results
+ *
+ *  Holds the result of every watchpoint in the Watchpoint Results Table
+ *  as one bit in one of three planes, with a false result setting no
+ *  bit, so compiled equations can test many watchpoints with a single
+ *  word operation. Kept in step with the results table by
+ *  #LC_WatchResultChanged.
+ */
+typedef struct
+{
+    uint32 True[LC_WATCH_PLANE_WORDS];  /**< \brief Set for each #LC_WATCH_TRUE watchpoint  */
+    uint32 Error[LC_WATCH_PLANE_WORDS]; /**< \brief Set for each #LC_WATCH_ERROR watchpoint */
+    uint32 Stale[LC_WATCH_PLANE_WORDS]; /**< \brief Set for each #LC_WATCH_STALE watchpoint */
+} LC_WatchPlanes_t;
+
+/**
+ *  \brief Immediate actionpoint evaluation state
+ *
+ *  Actionpoints with #LC_ACTION_OPT_IMMEDIATE are queued in Pending when
+ *  a packet changes the result of a watchpoint they reference, and are
+ *  sampled once that packet has been processed rather than waiting for
+ *  the next sample request.
+ */
+typedef struct
+{
+    uint32 Enabled[LC_AP_SET_WORDS];      /**< \brief Bit set for each compiled actionpoint
+                                                      with #LC_ACTION_OPT_IMMEDIATE          */
+    uint32 Pending[LC_AP_SET_WORDS];      /**< \brief Bit set for each actionpoint queued
+                                                      for immediate evaluation              */
+    uint8  EvalCount[LC_MAX_ACTIONPOINTS]; /**< \brief Immediate evaluations of each
+                                                      actionpoint since its last sample
+                                                      request                               */
+} LC_APImmediate_t;
 
-    LC_MessageList_t *HashTable[LC_HASH_TABLE_ENTRIES]; /**< \brief Each entry in the hash
-                                                                   table is a linked list
-                                                                   of all the MessageID's
-                                                                   that the hash function
-                                                                   converts to each index  */
+#define LC_STALE_WHEEL_MASK (LC_STALE_WHEEL_SLOTS - 1) /**< \brief Stale wheel slot mask */
 
-    LC_MessageList_t MessageLinks[LC_MAX_WATCHPOINTS]; /**< \brief Message linked list elements */
-    LC_WatchPtList_t WatchPtLinks[LC_MAX_WATCHPOINTS]; /**< \brief WatchPoint linked list elements */
+/**
+ *  \brief Watchpoint staleness timing wheel
+ *
+ *  Each watchpoint with a nonzero countdown to stale is linked into the
+ *  slot of the age tick on which it goes stale, so aging the results
+ *  only visits one slot instead of the whole Watchpoint Results Table.
+ *  Links hold the watchpoint number plus one, so a zero link ends a list
+ *  and zeroed memory is an empty wheel.
+ */
+typedef struct
+{
+    uint32 AgeTick;                      /**< \brief Sample requests that have aged the results */
+    uint32 Armed[LC_WATCH_PLANE_WORDS];  /**< \brief Bit set for each linked watchpoint          */
+    uint32 Deadline[LC_MAX_WATCHPOINTS]; /**< \brief Age tick on which each linked watchpoint
+                                                     goes stale                                */
+    uint16 Next[LC_MAX_WATCHPOINTS];     /**< \brief Next watchpoint link in the same slot     */
+    uint16 Prev[LC_MAX_WATCHPOINTS];     /**< \brief Previous watchpoint link in the same slot */
+    uint16 Head[LC_STALE_WHEEL_SLOTS];   /**< \brief First watchpoint link in each slot        */
+} LC_StaleWheel_t;
 
-    bool HaveActiveCDS; /**< \brief Critical Data Store in use flag      */
-} LC_OperData_t;
+/**
+ *  \brief Messages received for one unreferenced MessageID
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t MessageID;  /**< \brief MessageID no watchpoint references    */
+    uint32         MsgCount;   /**< \brief Messages received with this MessageID */
+    bool           Subscribed; /**< \brief Still subscribed to because an
+                                           unsubscribe failed               */
+} LC_UnrefMsg_t;
+
+/**
+ *  \brief Unreferenced MessageIDs received since the dispatch index was
+ *          last published
+ *
+ *  Messages with a MessageID that does not fit in the table share the
+ *  untracked count for event throttling. Entries still subscribed to
+ *  are carried over to the next dispatch index with their counts reset.
+ */
+typedef struct
+{
+    LC_UnrefMsg_t Entry[LC_MAX_UNREF_MSGIDS]; /**< \brief Unreferenced MessageIDs seen   */
+    uint32        UntrackedCount;             /**< \brief Messages with a MessageID that
+                                                          did not fit in the table      */
+    uint16        EntryCount;                 /**< \brief Entries in use                */
+    uint16        UnsubscribedCount;          /**< \brief MessageIDs unsubscribed from  */
+} LC_UnrefMsgs_t;
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
 
 /**
  *  \brief LC Application Data Structure
@@ -198,6 +526,144 @@ typedef struct
     uint8  CurrentLCState; /**< \brief Current LC application operating state */
 } LC_AppData_t;
 
+/**
+ *  \brief CDS writer child task state
+ *
+ *  The main task copies the CDS areas that changed into the staging
+ *  buffers here and gives #LC_CDSWriter_t.WakeSem, and the writer task
+ *  writes them to the CDS and gives #LC_CDSWriter_t.DoneSem. The main task only touches the
+ *  buffers and the writer counters after taking #LC_CDSWriter_t.DoneSem,
+ *  and folds the counters into the operational data then.
+ */
+typedef struct
+{
+    LC_WRTEntry_t WRT[LC_MAX_WATCHPOINTS];  /**< \brief Staged watchpoint results  */
+    LC_ARTEntry_t ART[LC_MAX_ACTIONPOINTS]; /**< \brief Staged actionpoint results */
+    LC_AppData_t  AppData;                  /**< \brief Staged application data    */
+    uint8         Dirty;                    /**< \brief CDS areas staged, see
+                                                        #LC_CDS_DIRTY_ALL       */
+
+    CFE_ES_TaskId_t TaskId;  /**< \brief Writer child task ID                                  */
+    osal_id_t       WakeSem; /**< \brief Given by the main task for each snapshot              */
+    osal_id_t       DoneSem; /**< \brief Given by the writer once a snapshot is written or it exits */
+
+    uint32       BytesWritten;  /**< \brief Bytes written since the counters were last folded in */
+    uint32       WritesSkipped; /**< \brief CDS updates that wrote nothing since then          */
+    CFE_Status_t WriteResult;   /**< \brief First failed write status since then, if any        */
+
+    bool TaskActive;    /**< \brief Writer task has been created and not yet stopped */
+    bool StopRequested; /**< \brief Main task has asked the writer to exit          */
+    bool Exited;        /**< \brief Writer has left its loop                        */
+} LC_CDSWriter_t;
+
+/**
+ *  \brief LC Operational Data Structure
+ *
+ *  The operational data is not saved to the CDS
+ */
+typedef struct
+{
+    CFE_SB_PipeId_t CmdPipe;  /**< \brief Command pipe ID, monitor packets     */
+    CFE_SB_PipeId_t CtrlPipe; /**< \brief Control pipe ID, commands and requests */
+
+    LC_WDTEntry_t *WDTPtr; /**< \brief Watchpoint  Definition Table Pointer */
+    LC_ADTEntry_t *ADTPtr; /**< \brief Actionpoint Definition Table Pointer */
+
+    LC_WRTEntry_t *WRTPtr; /**< \brief Watchpoint  Results Table Pointer    */
+    LC_ARTEntry_t *ARTPtr; /**< \brief Actionpoint Results Table Pointer    */
+
+    CFE_TBL_Handle_t WDTHandle; /**< \brief Watchpoint  Definition Table Handle  */
+    CFE_TBL_Handle_t ADTHandle; /**< \brief Actionpoint Definition Table Handle  */
+
+    CFE_TBL_Handle_t WRTHandle; /**< \brief Watchpoint  Results Table Handle     */
+    CFE_TBL_Handle_t ARTHandle; /**< \brief Actionpoint Results Table Handle     */
+
+    CFE_ES_CDSHandle_t WRTDataCDSHandle; /**< \brief Watchpoint  Results Table CDS Handle */
+    CFE_ES_CDSHandle_t ARTDataCDSHandle; /**< \brief Actionpoint Results Table CDS Handle */
+
+    CFE_ES_CDSHandle_t AppDataCDSHandle; /**< \brief Application Data CDS Handle          */
+
+    uint16 ActionHighWater; /**< \brief One past the last actionpoint in use in
+                                        the Actionpoint Definition Table     */
+
+    LC_HkPacket_t HkPacket; /**< \brief Housekeeping telemetry packet        */
+
+    uint32 TableResults; /**< \brief Table and CDS initialization results */
+
+    LC_MsgIndex_t *MsgIndex;       /**< \brief Active MessageID to watchpoint dispatch index */
+    LC_MsgIndex_t  MsgIndexBuf[2]; /**< \brief Active and spare dispatch index buffers      */
+    LC_HashBuild_t HashBuild;      /**< \brief Dispatch index build workspace                */
+
+    LC_WDTEntry_t WDTShadow[LC_MAX_WATCHPOINTS]; /**< \brief Watchpoint definitions the dispatch
+                                                              index was last built from          */
+
+    LC_WatchCache_t WatchCache[LC_MAX_WATCHPOINTS];  /**< \brief Last evaluated sample of each
+                                                                  watchpoint, indexed like the WRT */
+    LC_MsgDigest_t  MsgDigest[LC_MSG_INDEX_ENTRIES]; /**< \brief Packet digests, indexed like
+                                                                  #LC_MsgIndex_t.MessageList       */
+    LC_MsgSeq_t     MsgSeq[LC_MSG_INDEX_ENTRIES];    /**< \brief Last sequence counts, indexed
+                                                                  like #LC_MsgIndex_t.MessageList  */
+
+    LC_RPNProgram_t  RPNProgram;  /**< \brief Compiled actionpoint equations         */
+    LC_APDepends_t   APDepends;   /**< \brief Watchpoint to actionpoint dependencies */
+    LC_WatchPlanes_t WatchPlanes; /**< \brief Packed watchpoint results              */
+    LC_APImmediate_t APImmediate; /**< \brief Immediate actionpoint evaluation state */
+    LC_StaleWheel_t  StaleWheel;  /**< \brief Watchpoint staleness timing wheel     */
+    LC_UnrefMsgs_t   UnrefMsgs;   /**< \brief Unreferenced MessageIDs received     */
+
+    /*
+    ** Housekeeping statistics, not saved to the CDS
+    */
+    uint32 UnrefMsgCount;       /**< \brief Total count of messages received with a
+                                            MessageID no watchpoint references     */
+    uint32 SkippedEvalCount;    /**< \brief Total count of watchpoint evaluations
+                                            skipped because the masked data was
+                                            unchanged                              */
+    uint32 DigestHitCount;      /**< \brief Total count of messages whose results
+                                            were reused on a digest match          */
+    uint32 DigestMissCount;     /**< \brief Total count of digest enabled messages
+                                            that had to be evaluated               */
+    uint32 APSkipCount;         /**< \brief Total count of actionpoint samples that
+                                            reused the previous result because no
+                                            referenced watchpoint result changed   */
+    uint32 ImmediateAPCount;    /**< \brief Total count of immediate actionpoint
+                                            evaluations                            */
+    uint32 ImmediateDeferCount; /**< \brief Total count of immediate evaluations
+                                            left to the next sample request by
+                                            the actionpoint's MaxImmediateEvals    */
+    uint32 LastRTSLatency;      /**< \brief Microseconds from packet to RTS request
+                                            for the last immediate RTS request     */
+    uint32 PeakRTSLatency;      /**< \brief Longest packet to RTS request time, in
+                                            microseconds, of an immediate RTS
+                                            request                                */
+    uint32 CtrlPipeGaps;        /**< \brief Total count of sequence count gaps in
+                                            the requests on the control pipe       */
+    uint32 MonPipeGaps;         /**< \brief Total count of sequence count gaps in
+                                            the monitor packets                    */
+    uint16 LastPipeBatch;       /**< \brief Messages processed in the last wakeup  */
+    uint16 PeakPipeBatch;       /**< \brief Most messages processed in one wakeup,
+                                            at most #LC_PIPE_DRAIN_LIMIT plus one  */
+    uint32 PipeLimitCount;      /**< \brief Total count of wakeups that stopped at
+                                            #LC_PIPE_DRAIN_LIMIT with messages
+                                            possibly left in the command pipe      */
+    uint16 LastCtrlBatch;       /**< \brief Control messages processed the last
+                                            time the control pipe had any          */
+    uint16 PeakCtrlBatch;       /**< \brief Most control messages processed in
+                                            one pass                               */
+
+    uint8          CDSDirty;         /**< \brief CDS areas changed since they were last
+                                                 written, see #LC_CDS_DIRTY_ALL        */
+    uint32         CDSCycles;        /**< \brief Maintenance cycles since the last update  */
+    uint32         CDSBytesWritten;  /**< \brief Total bytes written to the CDS            */
+    uint32         CDSWritesSkipped; /**< \brief Total CDS updates that wrote nothing
+                                                 because no data changed, the minimum
+                                                 persist interval had not passed or the
+                                                 writer task was still busy            */
+    LC_CDSWriter_t CDSWriter;        /**< \brief CDS writer child task and staging buffers */
+
+    bool HaveActiveCDS; /**< \brief Critical Data Store in use flag      */
+} LC_OperData_t;
+
 /************************************************************************
  * Exported Data
  ************************************************************************/
@@ -220,6 +686,72 @@ extern LC_AppData_t  LC_AppData;  /**< \brief Application data */
  */
 void LC_AppMain(void);
 
+/**
+ * \brief Process a batch of messages from the command pipe
+ *
+ *  \par Description
+ *       Processes the message that woke the task, then reads and
+ *       processes up to #LC_PIPE_DRAIN_LIMIT more messages that are
+ *       already waiting, without pending, so the per-wakeup overhead
+ *       of the main loop is paid once per batch. The control pipe is
+ *       emptied before each message, so control messages never wait
+ *       behind more than one monitor packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Updates the last and peak batch size housekeeping counters,
+ *       and counts the batches that stopped at the limit.
+ *
+ *  \param [in]   BufPtr  Pointer to the Software Bus buffer that
+ *                        woke the task
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t LC_DrainCmdPipe(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process every message waiting on the control pipe
+ *
+ *  \par Description
+ *       Reads and processes the ground commands, housekeeping
+ *       requests and actionpoint sample requests waiting on the
+ *       control pipe, without pending, until the pipe is empty or
+ *       #LC_CTRL_PIPE_DEPTH messages have been handled. Called
+ *       before each monitor packet and each time the main loop
+ *       wakes without one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Updates the last and peak control batch housekeeping
+ *       counters when any message was processed
+ *
+ *  \param [out]  BatchSize  Number of messages processed
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t LC_DrainCtrlPipe(uint16 *BatchSize);
+
+/**
+ * \brief Count a gap in a MessageID's sequence counts
+ *
+ *  \par Description
+ *       Compares the sequence count of the message with the one
+ *       that should follow the last message received for the same
+ *       MessageID. A mismatch means a message never reached LC,
+ *       usually because its pipe was full, and is counted against
+ *       the pipe the MessageID is subscribed on.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Ground commands are not checked, their sequence counts
+ *       come from more than one source. The last sequence counts
+ *       are forgotten whenever a new dispatch index takes effect.
+ *
+ *  \param [in]   MessageList  Dispatch index entry of the message,
+ *                             may be NULL
+ *  \param [in]   BufPtr       Pointer to the Software Bus buffer
+ */
+void LC_CheckMsgSequence(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr);
+
 /**
  * \brief Initialize the CFS Limit Checker (LC) application
  *
@@ -44,7 +44,6 @@
 void LC_SampleAPReq(const CFE_SB_Buffer_t *BufPtr)
 {
     const LC_SampleAP_Payload_t *LC_SampleAP;
-    uint16                       WatchIndex;
     bool                         ValidSampleCmd = false;
 
     LC_SampleAP = LC_GET_CMD_PAYLOAD(BufPtr, LC_SampleAPCmd_t);
@@ -90,18 +89,7 @@ void LC_SampleAPReq(const CFE_SB_Buffer_t *BufPtr)
         */
         if ((LC_SampleAP->UpdateAge != 0) && (ValidSampleCmd))
         {
-            for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++)
-            {
-                if (LC_OperData.WRTPtr[WatchIndex].CountdownToStale > 0)
-                {
-                    LC_OperData.WRTPtr[WatchIndex].CountdownToStale--;
-
-                    if (LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0)
-                    {
-                        LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_STALE;
-                    }
-                }
-            }
+            LC_AgeWatchResults();
         }
     }
 }
@@ -119,8 +107,11 @@ CFE_Status_t LC_SendHkCmd(const LC_SendHkCmd_t *msg)
     uint8  Shift;
     uint8  TempByteData;
     uint8  i;
+    uint32 Word;
+    uint64 Packed;
 
-    LC_HkTlm_Payload_t *PayloadPtr;
+    LC_HkTlm_Payload_t     *PayloadPtr;
+    const LC_WatchPlanes_t *Planes = &LC_OperData.WatchPlanes;
 
     /* Update HK variables */
     PayloadPtr = &LC_OperData.HkPacket.Payload;
@@ -131,56 +122,56 @@ CFE_Status_t LC_SendHkCmd(const LC_SendHkCmd_t *msg)
     PayloadPtr->MonitoredMsgCount   = LC_AppData.MonitoredMsgCount;
     PayloadPtr->RTSExecCount        = LC_AppData.RTSExecCount;
     PayloadPtr->PassiveRTSExecCount = LC_AppData.PassiveRTSExecCount;
+    PayloadPtr->SkippedEvalCount    = LC_OperData.SkippedEvalCount;
+    PayloadPtr->DigestHitCount      = LC_OperData.DigestHitCount;
+    PayloadPtr->DigestMissCount     = LC_OperData.DigestMissCount;
+    PayloadPtr->LastPipeBatch       = LC_OperData.LastPipeBatch;
+    PayloadPtr->PeakPipeBatch       = LC_OperData.PeakPipeBatch;
+    PayloadPtr->PipeLimitCount      = LC_OperData.PipeLimitCount;
+    PayloadPtr->APSkipCount         = LC_OperData.APSkipCount;
+    PayloadPtr->ImmediateAPCount    = LC_OperData.ImmediateAPCount;
+    PayloadPtr->ImmediateDeferCount = LC_OperData.ImmediateDeferCount;
+    PayloadPtr->LastRTSLatency      = LC_OperData.LastRTSLatency;
+    PayloadPtr->PeakRTSLatency      = LC_OperData.PeakRTSLatency;
+    PayloadPtr->CDSBytesWritten     = LC_OperData.CDSBytesWritten;
+    PayloadPtr->CDSWritesSkipped    = LC_OperData.CDSWritesSkipped;
+    PayloadPtr->UnrefMsgCount       = LC_OperData.UnrefMsgCount;
+    PayloadPtr->UnrefMsgIDs         = LC_OperData.UnrefMsgs.EntryCount;
+    PayloadPtr->UnrefUnsubscribed   = LC_OperData.UnrefMsgs.UnsubscribedCount;
+    PayloadPtr->LastCtrlBatch       = LC_OperData.LastCtrlBatch;
+    PayloadPtr->PeakCtrlBatch       = LC_OperData.PeakCtrlBatch;
+    PayloadPtr->CtrlPipeGaps        = LC_OperData.CtrlPipeGaps;
+    PayloadPtr->MonPipeGaps         = LC_OperData.MonPipeGaps;
     PayloadPtr->CurrentLCState      = LC_AppData.CurrentLCState;
-    PayloadPtr->WPsInUse            = LC_OperData.WatchpointCount;
+    PayloadPtr->WPsInUse            = LC_OperData.MsgIndex->WatchpointCount;
 
     /* Clear out the active actionpoint count, it will get recomputed below */
     PayloadPtr->ActiveAPs = 0;
 
-    /* Update packed watch results (4 watch results in one 8-bit byte) */
-    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex += 4)
+    /*
+    ** Update packed watch results (4 watch results in one 8-bit byte) a
+    ** word of watchpoints at a time. The low bit of each 2-bit code is set
+    ** for TRUE and STALE and the high bit for ERROR and STALE.
+    */
+    for (Word = 0; Word < LC_WATCH_PLANE_WORDS; Word++)
     {
-        HKIndex = TableIndex / 4;
+        Packed = LC_SpreadBits(Planes->True[Word] | Planes->Stale[Word]) |
+                 (LC_SpreadBits(Planes->Error[Word] | Planes->Stale[Word]) << 1);
 
-        /* Pack in the results 2-bits at a time to ByteData */
-        for (i = 0; i < 4; i++)
+        for (i = 0; i < 8; i++)
         {
-            Shift = 6 - (i * 2);
-            switch (LC_OperData.WRTPtr[TableIndex + 3 - i].WatchResult)
-            {
-                case LC_WATCH_STALE:
-                    TempByteData = LC_HKWR_STALE << Shift;
-                    break;
-
-                case LC_WATCH_FALSE:
-                    TempByteData = LC_HKWR_FALSE << Shift;
-                    break;
+            HKIndex = (Word * 8) + i;
 
-                case LC_WATCH_TRUE:
-                    TempByteData = LC_HKWR_TRUE << Shift;
-                    break;
-
-                /* We should never get an undefined watch result, but set an error result if we do */
-                case LC_WATCH_ERROR:
-                default:
-                    TempByteData = LC_HKWR_ERROR << Shift;
-                    break;
+            /* The last word may reach past the longword padded array */
+            if (HKIndex < LC_HKWR_NUM_BYTES)
+            {
+                PayloadPtr->WPResults[HKIndex] = (uint8)(Packed >> (i * 8));
             }
-
-            /* Directly assign 1st result, but logical OR the 2nd, 3rd and 4th results */
-            if (i == 0)
-                ByteData = TempByteData;
-            else
-                ByteData |= TempByteData;
         }
-
-        /* Update housekeeping watch results array */
-        /* SAD: HKIndex is derived from TableIndex, ensuring it stays within the bounds of the WPResults array */
-        PayloadPtr->WPResults[HKIndex] = ByteData;
     }
 
     /* Update packed action results (2 action state/result pairs (4 bits each) in one 8-bit byte) */
-    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex += 2)
+    for (TableIndex = 0; TableIndex < LC_OperData.ActionHighWater; TableIndex += 2)
     {
         HKIndex = TableIndex / 2;
 
@@ -252,6 +243,16 @@ CFE_Status_t LC_SendHkCmd(const LC_SendHkCmd_t *msg)
         PayloadPtr->APResults[HKIndex] = ByteData;
     }
 
+    /*
+    ** Actionpoints past the last one in use are always not used and stale
+    */
+    ByteData = (LC_HKAR_STATE_NOT_USED << 6) | (LC_HKAR_STALE << 4) | (LC_HKAR_STATE_NOT_USED << 2) | LC_HKAR_STALE;
+
+    for (HKIndex = (LC_OperData.ActionHighWater + 1) / 2; HKIndex < (LC_MAX_ACTIONPOINTS / 2); HKIndex++)
+    {
+        PayloadPtr->APResults[HKIndex] = ByteData;
+    }
+
     /* Timestamp and send housekeeping packet */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(LC_OperData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(LC_OperData.HkPacket.TelemetryHeader), true);
@@ -259,6 +260,24 @@ CFE_Status_t LC_SendHkCmd(const LC_SendHkCmd_t *msg)
     return LC_PerformMaintenance();
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Spread the bits of a word into every other bit                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint64 LC_SpreadBits(uint32 Bits)
+{
+    uint64 Spread = Bits;
+
+    Spread = (Spread | (Spread << 16)) & 0x0000FFFF0000FFFFULL;
+    Spread = (Spread | (Spread << 8)) & 0x00FF00FF00FF00FFULL;
+    Spread = (Spread | (Spread << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    Spread = (Spread | (Spread << 2)) & 0x3333333333333333ULL;
+    Spread = (Spread | (Spread << 1)) & 0x5555555555555555ULL;
+
+    return Spread;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Noop command                                                    */
@@ -307,6 +326,25 @@ void LC_ResetCounters(void)
     LC_AppData.MonitoredMsgCount   = 0;
     LC_AppData.RTSExecCount        = 0;
     LC_AppData.PassiveRTSExecCount = 0;
+
+    LC_OperData.UnrefMsgCount       = 0;
+    LC_OperData.SkippedEvalCount    = 0;
+    LC_OperData.DigestHitCount      = 0;
+    LC_OperData.DigestMissCount     = 0;
+    LC_OperData.LastPipeBatch       = 0;
+    LC_OperData.PeakPipeBatch       = 0;
+    LC_OperData.PipeLimitCount      = 0;
+    LC_OperData.LastCtrlBatch       = 0;
+    LC_OperData.PeakCtrlBatch       = 0;
+    LC_OperData.CtrlPipeGaps        = 0;
+    LC_OperData.MonPipeGaps         = 0;
+    LC_OperData.APSkipCount         = 0;
+    LC_OperData.ImmediateAPCount    = 0;
+    LC_OperData.ImmediateDeferCount = 0;
+    LC_OperData.LastRTSLatency      = 0;
+    LC_OperData.PeakRTSLatency      = 0;
+    LC_OperData.CDSBytesWritten     = 0;
+    LC_OperData.CDSWritesSkipped    = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -459,6 +497,7 @@ CFE_Status_t LC_SetAPStateCmd(const LC_SetAPStateCmd_t *msg)
         */
         if (CmdSuccess == true)
         {
+            LC_OperData.CDSDirty |= LC_CDS_DIRTY_ART;
             LC_AppData.CmdCount++;
 
             CFE_EVS_SendEvent(LC_APSTATE_INF_EID,
@@ -522,6 +561,7 @@ CFE_Status_t LC_SetAPPermOffCmd(const LC_SetAPPermOffCmd_t *msg)
             ** Update state for actionpoint specified
             */
             LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_PERMOFF;
+            LC_OperData.CDSDirty |= LC_CDS_DIRTY_ART;
 
             LC_AppData.CmdCount++;
 
@@ -590,6 +630,8 @@ void LC_ResetResultsAP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd)
 {
     uint32 TableIndex;
 
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_ART;
+
     /* reset selected entries in actionpoint results table */
     for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++)
     {
@@ -598,6 +640,9 @@ void LC_ResetResultsAP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd)
             /* reset AP stats command does not modify AP state or most recent test result */
             LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_STALE;
             LC_OperData.ARTPtr[TableIndex].CurrentState = LC_OperData.ADTPtr[TableIndex].DefaultState;
+
+            /* the next sample must evaluate the equation again */
+            LC_MarkAPDirty(TableIndex);
         }
 
         LC_OperData.ARTPtr[TableIndex].PassiveAPCount  = 0;
@@ -665,26 +710,32 @@ void LC_ResetResultsWP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd)
 {
     uint32 TableIndex;
 
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_WRT;
+
     /* reset selected entries in watchpoint results table */
     for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++)
     {
         if (!ResetStatsCmd)
         {
             /* reset WP stats command does not modify most recent test result */
-            LC_OperData.WRTPtr[TableIndex].WatchResult      = LC_WATCH_STALE;
-            LC_OperData.WRTPtr[TableIndex].CountdownToStale = 0;
+            LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_STALE;
+            LC_DisarmStaleTimer(TableIndex);
+            LC_WatchResultChanged(TableIndex);
         }
 
         LC_OperData.WRTPtr[TableIndex].EvaluationCount      = 0;
         LC_OperData.WRTPtr[TableIndex].FalseToTrueCount     = 0;
         LC_OperData.WRTPtr[TableIndex].ConsecutiveTrueCount = 0;
         LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount  = 0;
+        LC_OperData.WRTPtr[TableIndex].ErrorCount           = 0;
 
         LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value                = 0;
+        LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.ValueUpper           = 0;
         LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Seconds    = 0;
         LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Subseconds = 0;
 
         LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Value                = 0;
+        LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.ValueUpper           = 0;
         LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Seconds    = 0;
         LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Subseconds = 0;
     }
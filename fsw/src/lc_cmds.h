@@ -108,6 +108,23 @@ void LC_SampleAPReq(const CFE_SB_Buffer_t *BufPtr);
  */
 CFE_Status_t LC_SendHkCmd(const LC_SendHkCmd_t *msg);
 
+/**
+ * \brief Spread the bits of a word into every other bit
+ *
+ *  \par Description
+ *       Utility function used to pack 2-bit housekeeping codes a word
+ *       of watchpoints at a time. Bit N of the word is moved to bit 2N
+ *       of the result and every odd bit of the result is zero.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Bits          The word to spread
+ *
+ *  \return The spread bits
+ */
+uint64 LC_SpreadBits(uint32 Bits);
+
 /**
  * \brief Noop command
  *
@@ -313,30 +313,36 @@ void LC_AppProcessCmd(const CFE_SB_Buffer_t *BufPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 {
-    static CFE_SB_MsgId_t CMD_MID       = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SEND_HK_MID   = CFE_SB_MSGID_RESERVED;
-    static CFE_SB_MsgId_t SAMPLE_AP_MID = CFE_SB_MSGID_RESERVED;
+    const LC_MessageList_t *MessageList;
+    CFE_SB_MsgId_t          MessageID = CFE_SB_INVALID_MSG_ID;
 
-    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
 
-    /* Cache the local MID values here, this avoids repeat lookups */
-    if (!CFE_SB_IsValidMsgId(CMD_MID))
-    {
-        CMD_MID       = CFE_SB_ValueToMsgId(LC_CMD_MID);
-        SEND_HK_MID   = CFE_SB_ValueToMsgId(LC_SEND_HK_MID);
-        SAMPLE_AP_MID = CFE_SB_ValueToMsgId(LC_SAMPLE_AP_MID);
-    }
+    /* Application data only changes while a message is processed */
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_APPDATA;
 
-    CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+    /* One lookup finds the handler and the watchpoints for any MessageID */
+    MessageList = LC_FindMessageIndex(MessageID);
+
+    /* Count any messages lost on the way to LC */
+    LC_CheckMsgSequence(MessageList, BufPtr);
 
-    if (CFE_SB_MsgId_Equal(MessageID, SAMPLE_AP_MID))
+    if ((MessageList == NULL) || (MessageList->Handler == LC_MSG_HANDLER_WATCH))
+    {
+        /*
+        ** All other message ID's should be monitor
+        ** packets
+        */
+        LC_CheckIndexedMsgForWPs(MessageID, MessageList, BufPtr);
+    }
+    else if (MessageList->Handler == LC_MSG_HANDLER_SAMPLE_AP)
     {
         /*
         ** Sample actionpoints request
         */
         LC_SampleAPVerifyDispatch(BufPtr);
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
+    else if (MessageList->Handler == LC_MSG_HANDLER_SEND_HK)
     {
         /*
         ** Housekeeping telemetry request
@@ -344,19 +350,11 @@ void LC_AppPipe(const CFE_SB_Buffer_t *BufPtr)
         */
         LC_SendHkVerifyDispatch(BufPtr);
     }
-    else if (CFE_SB_MsgId_Equal(MessageID, CMD_MID))
+    else
     {
         /*
         ** LC application commands...
         */
         LC_AppProcessCmd(BufPtr);
     }
-    else
-    {
-        /*
-        ** All other message ID's should be monitor
-        ** packets
-        */
-        LC_CheckMsgForWPs(MessageID, BufPtr);
-    }
-}
\ No newline at end of file
+}
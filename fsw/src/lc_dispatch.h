@@ -37,15 +37,16 @@
  * \brief Process a command pipe message
  *
  *  \par Description
- *       Processes a single software bus command pipe message. Checks
- *       the message and command IDs and calls the appropriate routine
- *       to handle the message.
+ *       Processes a single software bus command pipe message. Looks
+ *       the message ID up in the dispatch index and calls the routine
+ *       its entry names to handle the message.
  *
  *       All messageIDs other than #LC_CMD_MID, #LC_SEND_HK_MID, and
  *       #LC_SAMPLE_AP_MID are assumed to be monitor packets.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The dispatch index is built by #LC_CreateHashTable during
+ *       initialization, before any message is processed
  *
  *  \param[in] BufPtr Pointer to Software Bus buffer
  */
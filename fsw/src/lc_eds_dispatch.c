@@ -31,6 +31,7 @@
 #include "lc_eventids.h"
 #include "lc_msgids.h"
 #include "lc_msg.h"
+#include "lc_watch.h"
 
 #include "lc_eds_dispatcher.h"
 #include "lc_eds_dictionary.h"
@@ -65,16 +66,35 @@ static const EdsDispatchTable_EdsComponent_LC_Application_CFE_SB_Telecommand_t L
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 {
-    CFE_Status_t      Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_Size_t    MsgSize;
-    CFE_MSG_FcnCode_t MsgFc;
+    const LC_MessageList_t *MessageList;
+    CFE_Status_t            Status = CFE_SUCCESS;
+    CFE_SB_MsgId_t          MsgId  = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Size_t          MsgSize;
+    CFE_MSG_FcnCode_t       MsgFc;
 
-    Status = EdsDispatch_EdsComponent_LC_Application_Telecommand(BufPtr, &LC_TC_DISPATCH_TABLE);
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+
+    /* Application data only changes while a message is processed */
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_APPDATA;
+
+    /* One lookup finds the handler and the watchpoints for any MessageID */
+    MessageList = LC_FindMessageIndex(MsgId);
+
+    /* Count any messages lost on the way to LC */
+    LC_CheckMsgSequence(MessageList, BufPtr);
+
+    if ((MessageList == NULL) || (MessageList->Handler == LC_MSG_HANDLER_WATCH))
+    {
+        /* Monitor packets skip the telecommand dispatcher */
+        LC_CheckIndexedMsgForWPs(MsgId, MessageList, BufPtr);
+    }
+    else
+    {
+        Status = EdsDispatch_EdsComponent_LC_Application_Telecommand(BufPtr, &LC_TC_DISPATCH_TABLE);
+    }
 
     if (Status != CFE_SUCCESS)
     {
-        CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
         CFE_MSG_GetSize(&BufPtr->Msg, &MsgSize);
         CFE_MSG_GetFcnCode(&BufPtr->Msg, &MsgFc);
         ++LC_AppData.CmdErrCount;
@@ -34,6 +34,8 @@
 #include "lc_platform_cfg.h"
 #include "lc_utils.h"
 
+#include <string.h>
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Manage tables - chance to be dumped, reloaded, etc.             */
@@ -44,6 +46,15 @@ CFE_Status_t LC_ManageTables(void)
 {
     CFE_Status_t Result;
 
+    /*
+    ** The stale wheel only keeps the countdowns in the results table
+    **  current when asked, so bring them up to date for a pending dump
+    */
+    if (CFE_TBL_GetStatus(LC_OperData.WRTHandle) == CFE_TBL_INFO_DUMP_PENDING)
+    {
+        LC_SyncStaleCountdowns();
+    }
+
     /*
     ** It is not necessary to release dump only table pointers before
     **  calling cFE Table Services to manage the table
@@ -68,12 +79,12 @@ CFE_Status_t LC_ManageTables(void)
     if (Result == CFE_TBL_INFO_UPDATED)
     {
         /*
-        ** Clear watchpoint results for previous table
+        ** Clear results of watchpoints the new table redefined
         */
-        LC_ResetResultsWP(0, LC_MAX_WATCHPOINTS - 1, false);
+        LC_ResetChangedWatchpoints();
 
         /*
-        ** Create watchpoint hash tables -- also subscribes to watchpoint packets
+        ** Create watchpoint hash tables -- also updates watchpoint subscriptions
         */
         LC_CreateHashTable();
     }
@@ -94,6 +105,11 @@ CFE_Status_t LC_ManageTables(void)
         ** Clear actionpoint results for previous table
         */
         LC_ResetResultsAP(0, LC_MAX_ACTIONPOINTS - 1, false);
+
+        /*
+        ** Compile the new actionpoint equations
+        */
+        LC_CompileActionpoints();
     }
     else if (Result != CFE_SUCCESS)
     {
@@ -118,50 +134,111 @@ CFE_Status_t LC_UpdateTaskCDS(void)
     CFE_Status_t Result;
 
     /*
-    ** Copy the watchpoint results table (WRT) data to CDS
+    ** Bring the countdowns to stale up to date before saving the
+    **  watchpoint results table (WRT)
     */
-    Result = CFE_ES_CopyToCDS(LC_OperData.WRTDataCDSHandle, LC_OperData.WRTPtr);
+    LC_SyncStaleCountdowns();
 
-    if (Result != CFE_SUCCESS)
+    Result = LC_WriteTaskCDS(LC_OperData.WRTPtr,
+                             LC_OperData.ARTPtr,
+                             &LC_AppData,
+                             LC_OperData.CDSDirty,
+                             &LC_OperData.CDSBytesWritten,
+                             &LC_OperData.CDSWritesSkipped);
+
+    if (Result == CFE_SUCCESS)
     {
-        CFE_EVS_SendEvent(LC_WRT_NO_SAVE_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Unable to update watchpoint results in CDS, RC=0x%08X",
-                          (unsigned int)Result);
-        return Result;
+        LC_OperData.CDSDirty = 0;
     }
 
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write results and application data to Critical Data Store       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t LC_WriteTaskCDS(const LC_WRTEntry_t *WRTPtr,
+                             const LC_ARTEntry_t *ARTPtr,
+                             LC_AppData_t        *AppDataPtr,
+                             uint8                Dirty,
+                             uint32              *BytesWritten,
+                             uint32              *WritesSkipped)
+{
+    CFE_Status_t Result;
+
     /*
-    ** Copy the actionpoint results table (ART) data to CDS
+    ** Only the areas marked as changed since they were last written
+    **  are written again
     */
-    Result = CFE_ES_CopyToCDS(LC_OperData.ARTDataCDSHandle, LC_OperData.ARTPtr);
-
-    if (Result != CFE_SUCCESS)
+    if (Dirty == 0)
     {
-        CFE_EVS_SendEvent(LC_ART_NO_SAVE_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Unable to update actionpoint results in CDS, RC=0x%08X",
-                          (unsigned int)Result);
-        return Result;
+        (*WritesSkipped)++;
+        return CFE_SUCCESS;
     }
 
     /*
-    ** Set the "data has been saved" indicator
+    ** Copy the watchpoint results table (WRT) data to CDS
     */
-    LC_AppData.CDSSavedOnExit = LC_CDS_SAVED;
+    if ((Dirty & LC_CDS_DIRTY_WRT) != 0)
+    {
+        Result = CFE_ES_CopyToCDS(LC_OperData.WRTDataCDSHandle, WRTPtr);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(LC_WRT_NO_SAVE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Unable to update watchpoint results in CDS, RC=0x%08X",
+                              (unsigned int)Result);
+            return Result;
+        }
+
+        *BytesWritten += sizeof(LC_WRTEntry_t) * LC_MAX_WATCHPOINTS;
+    }
 
     /*
-    ** Copy the global application data structure to CDS
+    ** Copy the actionpoint results table (ART) data to CDS
     */
-    Result = CFE_ES_CopyToCDS(LC_OperData.AppDataCDSHandle, &LC_AppData);
+    if ((Dirty & LC_CDS_DIRTY_ART) != 0)
+    {
+        Result = CFE_ES_CopyToCDS(LC_OperData.ARTDataCDSHandle, ARTPtr);
 
-    if (Result != CFE_SUCCESS)
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(LC_ART_NO_SAVE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Unable to update actionpoint results in CDS, RC=0x%08X",
+                              (unsigned int)Result);
+            return Result;
+        }
+
+        *BytesWritten += sizeof(LC_ARTEntry_t) * LC_MAX_ACTIONPOINTS;
+    }
+
+    if ((Dirty & LC_CDS_DIRTY_APPDATA) != 0)
     {
-        CFE_EVS_SendEvent(LC_APP_NO_SAVE_START_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "Unable to update application data in CDS, RC=0x%08X",
-                          (unsigned int)Result);
-        return Result;
+        /*
+        ** Set the "data has been saved" indicator
+        */
+        AppDataPtr->CDSSavedOnExit = LC_CDS_SAVED;
+
+        /*
+        ** Copy the global application data structure to CDS
+        */
+        Result = CFE_ES_CopyToCDS(LC_OperData.AppDataCDSHandle, AppDataPtr);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(LC_APP_NO_SAVE_START_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Unable to update application data in CDS, RC=0x%08X",
+                              (unsigned int)Result);
+            return Result;
+        }
+
+        *BytesWritten += sizeof(LC_AppData_t);
     }
 
     return CFE_SUCCESS;
@@ -176,6 +253,7 @@ CFE_Status_t LC_UpdateTaskCDS(void)
 CFE_Status_t LC_PerformMaintenance(void)
 {
     CFE_Status_t Result;
+    CFE_Status_t Status;
 
     /*
     ** Manage tables - allow cFE to perform dump, update, etc.
@@ -189,14 +267,313 @@ CFE_Status_t LC_PerformMaintenance(void)
         {
             /*
             ** If CDS is enabled - update the 3 CDS areas managed by LC
+            **  once the minimum persist interval has passed
             **  (continue, but disable CDS if unable to update all 3)
             */
-            if (LC_UpdateTaskCDS() != CFE_SUCCESS)
+            if (++LC_OperData.CDSCycles < LC_CDS_MIN_PERSIST_INTERVAL)
+            {
+                LC_OperData.CDSWritesSkipped++;
+            }
+            else
+            {
+                LC_OperData.CDSCycles = 0;
+
+                if (LC_OperData.CDSWriter.TaskActive)
+                {
+                    Status = LC_StageTaskCDS();
+                }
+                else
+                {
+                    Status = LC_UpdateTaskCDS();
+                }
+
+                if (Status != CFE_SUCCESS)
+                {
+                    LC_OperData.HaveActiveCDS = false;
+                }
+            }
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start the CDS writer child task                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CreateCDSWriter(void)
+{
+    LC_CDSWriter_t *Writer = &LC_OperData.CDSWriter;
+    int32           OsStatus;
+    CFE_Status_t    Result;
+
+    OsStatus = OS_BinSemCreate(&Writer->WakeSem, LC_CDS_WRITER_SEM_NAME, 0, 0);
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(LC_CDS_WRITER_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Error creating CDS writer semaphore, RC=%d",
+                          (int)OsStatus);
+        return;
+    }
+
+    /*
+    ** The done semaphore starts full - the staging buffers are free
+    */
+    OsStatus = OS_BinSemCreate(&Writer->DoneSem, LC_CDS_DONE_SEM_NAME, 1, 0);
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        OS_BinSemDelete(Writer->WakeSem);
+
+        CFE_EVS_SendEvent(LC_CDS_WRITER_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Error creating CDS writer semaphore, RC=%d",
+                          (int)OsStatus);
+        return;
+    }
+
+    /*
+    ** Mark the writer active first - once created, it may run at any time
+    */
+    Writer->TaskActive    = true;
+    Writer->StopRequested = false;
+    Writer->Exited        = false;
+    Writer->BytesWritten  = 0;
+    Writer->WritesSkipped = 0;
+    Writer->WriteResult   = CFE_SUCCESS;
+
+    Result = CFE_ES_CreateChildTask(&Writer->TaskId,
+                                    LC_CDS_WRITER_NAME,
+                                    LC_CDSWriterTask,
+                                    CFE_ES_TASK_STACK_ALLOCATE,
+                                    LC_CDS_WRITER_STACK_SIZE,
+                                    LC_CDS_WRITER_PRIORITY,
+                                    0);
+
+    if (Result != CFE_SUCCESS)
+    {
+        Writer->TaskActive = false;
+        OS_BinSemDelete(Writer->WakeSem);
+        OS_BinSemDelete(Writer->DoneSem);
+
+        CFE_EVS_SendEvent(LC_CDS_WRITER_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Error creating CDS writer task, RC=0x%08X",
+                          (unsigned int)Result);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop the CDS writer child task                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_StopCDSWriter(void)
+{
+    LC_CDSWriter_t *Writer  = &LC_OperData.CDSWriter;
+    bool            Stopped = false;
+
+    if (Writer->TaskActive)
+    {
+        /*
+        ** Let the writer finish the snapshot it is saving, then ask it
+        **  to exit and wait for it to confirm
+        */
+        if (OS_BinSemTimedWait(Writer->DoneSem, LC_CDS_WRITER_STOP_TIMEOUT) == OS_SUCCESS)
+        {
+            if (LC_CollectCDSWriter() != CFE_SUCCESS)
             {
                 LC_OperData.HaveActiveCDS = false;
             }
+
+            if (Writer->Exited)
+            {
+                Stopped = true;
+            }
+            else
+            {
+                Writer->StopRequested = true;
+
+                if ((OS_BinSemGive(Writer->WakeSem) == OS_SUCCESS) &&
+                    (OS_BinSemTimedWait(Writer->DoneSem, LC_CDS_WRITER_STOP_TIMEOUT) == OS_SUCCESS))
+                {
+                    Stopped = true;
+                }
+            }
         }
+
+        if (Stopped == false)
+        {
+            /*
+            ** Last resort - the writer may be deleted part way through
+            **  saving a block, so write every block on the next update
+            */
+            CFE_ES_DeleteChildTask(Writer->TaskId);
+
+            LC_OperData.CDSDirty = LC_CDS_DIRTY_ALL;
+        }
+
+        OS_BinSemDelete(Writer->WakeSem);
+        OS_BinSemDelete(Writer->DoneSem);
+
+        Writer->TaskActive = false;
     }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fold the CDS writer counters into the operational data          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t LC_CollectCDSWriter(void)
+{
+    LC_CDSWriter_t *Writer = &LC_OperData.CDSWriter;
+    CFE_Status_t    Result;
+
+    LC_OperData.CDSBytesWritten += Writer->BytesWritten;
+    LC_OperData.CDSWritesSkipped += Writer->WritesSkipped;
+    Result = Writer->WriteResult;
+
+    Writer->BytesWritten  = 0;
+    Writer->WritesSkipped = 0;
+    Writer->WriteResult   = CFE_SUCCESS;
 
     return Result;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hand a snapshot of the results to the CDS writer task           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_Status_t LC_StageTaskCDS(void)
+{
+    LC_CDSWriter_t *Writer = &LC_OperData.CDSWriter;
+    CFE_Status_t    Result;
+
+    /*
+    ** Leave the snapshot the writer has not finished with alone,
+    **  the next maintenance cycle will try again
+    */
+    if (OS_BinSemTimedWait(Writer->DoneSem, 0) != OS_SUCCESS)
+    {
+        LC_OperData.CDSWritesSkipped++;
+        return CFE_SUCCESS;
+    }
+
+    Result = LC_CollectCDSWriter();
+
+    if ((Result != CFE_SUCCESS) || Writer->Exited)
+    {
+        /*
+        ** Hand the buffers back so that stopping the writer does not
+        **  wait for them
+        */
+        OS_BinSemGive(Writer->DoneSem);
+
+        if (Result != CFE_SUCCESS)
+        {
+            return Result;
+        }
+
+        /*
+        ** The writer is gone, so go back to writing the CDS from the
+        **  main task
+        */
+        LC_StopCDSWriter();
+
+        return LC_UpdateTaskCDS();
+    }
+
+    LC_SyncStaleCountdowns();
+
+    /*
+    ** Only the areas that changed are copied, and the writer only
+    **  writes those
+    */
+    Writer->Dirty        = LC_OperData.CDSDirty;
+    LC_OperData.CDSDirty = 0;
+
+    if ((Writer->Dirty & LC_CDS_DIRTY_WRT) != 0)
+    {
+        memcpy(Writer->WRT, LC_OperData.WRTPtr, sizeof(Writer->WRT));
+    }
+
+    if ((Writer->Dirty & LC_CDS_DIRTY_ART) != 0)
+    {
+        memcpy(Writer->ART, LC_OperData.ARTPtr, sizeof(Writer->ART));
+    }
+
+    if ((Writer->Dirty & LC_CDS_DIRTY_APPDATA) != 0)
+    {
+        LC_AppData.CDSSavedOnExit = LC_CDS_SAVED;
+
+        memcpy(&Writer->AppData, &LC_AppData, sizeof(Writer->AppData));
+    }
+
+    if (OS_BinSemGive(Writer->WakeSem) != OS_SUCCESS)
+    {
+        /*
+        ** Without a way to wake the writer, go back to writing the
+        **  CDS from the main task, starting with the areas staged here
+        */
+        LC_OperData.CDSDirty |= Writer->Dirty;
+
+        OS_BinSemGive(Writer->DoneSem);
+
+        LC_StopCDSWriter();
+
+        return LC_UpdateTaskCDS();
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CDS writer child task entry point                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CDSWriterTask(void)
+{
+    LC_CDSWriter_t *Writer = &LC_OperData.CDSWriter;
+    CFE_Status_t    Result;
+
+    while ((OS_BinSemTake(Writer->WakeSem) == OS_SUCCESS) && (Writer->StopRequested == false))
+    {
+        /*
+        ** Only the writer counters are updated here, the main task
+        **  folds them in (and disables CDS if a write failed)
+        */
+        Result = LC_WriteTaskCDS(Writer->WRT,
+                                 Writer->ART,
+                                 &Writer->AppData,
+                                 Writer->Dirty,
+                                 &Writer->BytesWritten,
+                                 &Writer->WritesSkipped);
+
+        if ((Result != CFE_SUCCESS) && (Writer->WriteResult == CFE_SUCCESS))
+        {
+            Writer->WriteResult = Result;
+        }
+
+        OS_BinSemGive(Writer->DoneSem);
+    }
+
+    /*
+    ** Confirm the exit - the main task deletes the semaphores
+    */
+    Writer->Exited = true;
+    OS_BinSemGive(Writer->DoneSem);
+
+    CFE_ES_ExitChildTask();
+}
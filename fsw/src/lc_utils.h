@@ -27,6 +27,7 @@
  * Includes
  ************************************************************************/
 #include "cfe.h"
+#include "lc_app.h"
 
 /**
  * \brief Manage LC application tables
@@ -54,13 +55,52 @@ CFE_Status_t LC_ManageTables(void);
  *       application global data.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Only the areas marked in #LC_OperData_t.CDSDirty as changed
+ *       since they were last written are written again. The marks
+ *       are cleared once they are.
  *
  *  \return Execution status, see \ref CFEReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *
+ *  \sa #LC_WriteTaskCDS
  */
 CFE_Status_t LC_UpdateTaskCDS(void);
 
+/**
+ * \brief Write results and application data to Critical Data Store (CDS)
+ *
+ *  \par Description
+ *       Writes the given watchpoint results, actionpoint results and
+ *       application data to those of the 3 CDS areas managed by LC
+ *       that are marked as changed, setting the "data has been saved"
+ *       indicator in the application data before it is written.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the main task with the live data and by the CDS
+ *       writer task with the staged snapshot. The areas to write are
+ *       marked where the data changes, so nothing is compared here.
+ *       The counters are those of the calling task, so the writer
+ *       task never updates the operational data counters.
+ *
+ *  \param [in]     WRTPtr         Pointer to the watchpoint results
+ *  \param [in]     ARTPtr         Pointer to the actionpoint results
+ *  \param [in,out] AppDataPtr     Pointer to the application data
+ *  \param [in]     Dirty          CDS areas to write, see #LC_CDS_DIRTY_ALL
+ *  \param [in,out] BytesWritten   Counter the bytes written are added to
+ *  \param [in,out] WritesSkipped  Counter incremented if nothing was written
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *
+ *  \sa #LC_WRT_NO_SAVE_ERR_EID, #LC_ART_NO_SAVE_ERR_EID, #LC_APP_NO_SAVE_START_ERR_EID
+ */
+CFE_Status_t LC_WriteTaskCDS(const LC_WRTEntry_t *WRTPtr,
+                             const LC_ARTEntry_t *ARTPtr,
+                             LC_AppData_t        *AppDataPtr,
+                             uint8                Dirty,
+                             uint32              *BytesWritten,
+                             uint32              *WritesSkipped);
+
 /**
  * \brief Perform Routine Maintenance
  *
@@ -76,11 +116,97 @@ CFE_Status_t LC_UpdateTaskCDS(void);
  *       per second.  By doing the update in the housekeeping and
  *       timeout cases, we cut down on the update frequency at the
  *       cost of the stored data being a couple of seconds old when
- *       a processor reset does occur.
+ *       a processor reset does occur. The CDS is updated on only
+ *       every #LC_CDS_MIN_PERSIST_INTERVAL cycles.
  *
  *  \return Execution status, see \ref CFEReturnCodes
  *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  */
 CFE_Status_t LC_PerformMaintenance(void);
 
+/**
+ * \brief Start the CDS writer child task
+ *
+ *  \par Description
+ *       Creates the semaphores that wake the CDS writer and report
+ *       its writes, and the writer child task itself.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called when #LC_CDS_WRITER_TASK is enabled and the CDS
+ *       is in use. On any error the CDS continues to be written by
+ *       the main task.
+ *
+ *  \sa #LC_CDS_WRITER_ERR_EID
+ */
+void LC_CreateCDSWriter(void);
+
+/**
+ * \brief Stop the CDS writer child task
+ *
+ *  \par Description
+ *       Waits for the CDS writer child task to finish the snapshot it
+ *       is saving, asks it to exit and waits for it to confirm, then
+ *       deletes its semaphores so that the main task writes the CDS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The task is deleted only if it does not exit within
+ *       #LC_CDS_WRITER_STOP_TIMEOUT milliseconds. Every CDS area is
+ *       then written on the next update, in case the task was
+ *       deleted while saving one.
+ */
+void LC_StopCDSWriter(void);
+
+/**
+ * \brief Collect the CDS writer task counters
+ *
+ *  \par Description
+ *       Adds the bytes written and updates skipped by the CDS writer
+ *       task to the operational data counters and clears them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called by the main task while it holds the done
+ *       semaphore, so the writer is not saving a snapshot.
+ *
+ *  \return Status of the first writer task write that failed since
+ *          the last call, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t LC_CollectCDSWriter(void);
+
+/**
+ * \brief Hand a snapshot of the results to the CDS writer task
+ *
+ *  \par Description
+ *       Copies the watchpoint results, actionpoint results and
+ *       application data areas marked as changed into the staging
+ *       buffers and wakes the CDS writer task to save them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is staged while the writer is still saving the
+ *       previous snapshot. If a writer task write failed since the
+ *       last snapshot its status is returned. If the writer has
+ *       exited or cannot be woken it is stopped and the CDS is
+ *       written by the main task.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t LC_StageTaskCDS(void);
+
+/**
+ * \brief CDS writer child task entry point
+ *
+ *  \par Description
+ *       Waits for the main task to stage a snapshot of the results
+ *       and writes it to the CDS, until the main task asks it to
+ *       exit or the semaphore can no longer be taken.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs at #LC_CDS_WRITER_PRIORITY so the CDS writes do not
+ *       delay the processing of monitored packets. A failed write is
+ *       reported to the main task, which disables CDS use. Never
+ *       deletes its semaphores - the main task does on stop.
+ */
+void LC_CDSWriterTask(void);
+
 #endif
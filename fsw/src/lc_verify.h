@@ -74,6 +74,39 @@
 #error LC_PIPE_DEPTH must not exceed UINT16_MAX
 #endif
 
+/*
+ * Command pipe drain limit
+ */
+#ifndef LC_PIPE_DRAIN_LIMIT
+#error LC_PIPE_DRAIN_LIMIT must be defined!
+#elif LC_PIPE_DRAIN_LIMIT < 0
+#error LC_PIPE_DRAIN_LIMIT must not be less than zero
+#elif LC_PIPE_DRAIN_LIMIT > (UINT16_MAX - 1)
+#error LC_PIPE_DRAIN_LIMIT must not exceed (UINT16_MAX - 1)
+#endif
+
+/*
+ * Control pipe depth
+ */
+#ifndef LC_CTRL_PIPE_DEPTH
+#error LC_CTRL_PIPE_DEPTH must be defined!
+#elif LC_CTRL_PIPE_DEPTH < 1
+#error LC_CTRL_PIPE_DEPTH must not be less than 1
+#elif LC_CTRL_PIPE_DEPTH > UINT16_MAX
+#error LC_CTRL_PIPE_DEPTH must not exceed UINT16_MAX
+#endif
+
+/*
+ * Control pipe pend time
+ */
+#ifndef LC_CTRL_PIPE_PEND_TIME
+#error LC_CTRL_PIPE_PEND_TIME must be defined!
+#elif LC_CTRL_PIPE_PEND_TIME < 1
+#error LC_CTRL_PIPE_PEND_TIME must not be less than 1
+#elif LC_CTRL_PIPE_PEND_TIME > LC_SB_TIMEOUT
+#error LC_CTRL_PIPE_PEND_TIME must not exceed LC_SB_TIMEOUT
+#endif
+
 /*
  * Maximum number of watchpoints
  */
@@ -87,6 +120,14 @@
 #error LC_MAX_WATCHPOINTS must be a multiple of 4
 #endif
 
+/*
+ * Watchpoint dispatch index entries, every index must be below the
+ * value that marks an empty hash table slot
+ */
+#if LC_MSG_INDEX_ENTRIES >= LC_HASH_SLOT_EMPTY
+#error LC_MSG_INDEX_ENTRIES (LC_MAX_WATCHPOINTS + LC_MSG_HANDLER_MIDS) must be less than LC_HASH_SLOT_EMPTY
+#endif
+
 /*
  * Maximum number of actionpoints
  */
@@ -180,4 +221,110 @@
 #error LC_MAX_VALID_ADT_RTSID must not exceed UINT16_MAX
 #endif
 
+/*
+ * Minimum watchpoint batch
+ */
+#ifndef LC_WATCH_BATCH_MIN
+#error LC_WATCH_BATCH_MIN must be defined!
+#elif LC_WATCH_BATCH_MIN < 1
+#error LC_WATCH_BATCH_MIN must not be less than 1
+#endif
+
+/*
+ * Change-only watchpoint evaluation
+ */
+#ifndef LC_WATCH_CHANGE_ONLY
+#error LC_WATCH_CHANGE_ONLY must be defined!
+#endif
+
+/*
+ * Stale countdown wheel slots
+ */
+#ifndef LC_STALE_WHEEL_SLOTS
+#error LC_STALE_WHEEL_SLOTS must be defined!
+#elif LC_STALE_WHEEL_SLOTS < 1
+#error LC_STALE_WHEEL_SLOTS must not be less than 1
+#elif LC_STALE_WHEEL_SLOTS > 65536
+#error LC_STALE_WHEEL_SLOTS must not exceed 65536
+#elif (LC_STALE_WHEEL_SLOTS & (LC_STALE_WHEEL_SLOTS - 1)) != 0
+#error LC_STALE_WHEEL_SLOTS must be a power of two
+#endif
+
+/*
+ * Minimum CDS persist interval
+ */
+#ifndef LC_CDS_MIN_PERSIST_INTERVAL
+#error LC_CDS_MIN_PERSIST_INTERVAL must be defined!
+#elif LC_CDS_MIN_PERSIST_INTERVAL < 1
+#error LC_CDS_MIN_PERSIST_INTERVAL must not be less than 1
+#endif
+
+/*
+ * CDS writer task
+ */
+#ifndef LC_CDS_WRITER_TASK
+#error LC_CDS_WRITER_TASK must be defined!
+#endif
+
+#ifndef LC_CDS_WRITER_PRIORITY
+#error LC_CDS_WRITER_PRIORITY must be defined!
+#elif LC_CDS_WRITER_PRIORITY < 1
+#error LC_CDS_WRITER_PRIORITY must not be less than 1
+#elif LC_CDS_WRITER_PRIORITY > 255
+#error LC_CDS_WRITER_PRIORITY must not be greater than 255
+#endif
+
+#ifndef LC_CDS_WRITER_STACK_SIZE
+#error LC_CDS_WRITER_STACK_SIZE must be defined!
+#elif LC_CDS_WRITER_STACK_SIZE < 1
+#error LC_CDS_WRITER_STACK_SIZE must be greater than zero
+#endif
+
+/*
+ * Packet digest span
+ */
+#ifndef LC_DIGEST_MAX_BYTES
+#error LC_DIGEST_MAX_BYTES must be defined!
+#elif LC_DIGEST_MAX_BYTES < 1
+#error LC_DIGEST_MAX_BYTES must not be less than 1
+#endif
+
+/*
+ * Unreferenced message IDs
+ */
+#ifndef LC_MAX_UNREF_MSGIDS
+#error LC_MAX_UNREF_MSGIDS must be defined!
+#elif LC_MAX_UNREF_MSGIDS < 1
+#error LC_MAX_UNREF_MSGIDS must not be less than 1
+#elif LC_MAX_UNREF_MSGIDS > 65535
+#error LC_MAX_UNREF_MSGIDS must not be greater than 65535
+#endif
+
+#ifndef LC_UNREF_EVENT_INTERVAL
+#error LC_UNREF_EVENT_INTERVAL must be defined!
+#elif LC_UNREF_EVENT_INTERVAL < 1
+#error LC_UNREF_EVENT_INTERVAL must not be less than 1
+#endif
+
+#ifndef LC_UNREF_UNSUB_LIMIT
+#error LC_UNREF_UNSUB_LIMIT must be defined!
+#elif LC_UNREF_UNSUB_LIMIT < 0
+#error LC_UNREF_UNSUB_LIMIT must not be less than 0
+#endif
+
+/*
+ * Watchpoint error event budget
+ */
+#ifndef LC_WP_ERR_EVENT_LIMIT
+#error LC_WP_ERR_EVENT_LIMIT must be defined!
+#elif LC_WP_ERR_EVENT_LIMIT < 0
+#error LC_WP_ERR_EVENT_LIMIT must not be less than 0
+#endif
+
+#ifndef LC_WP_ERR_EVENT_INTERVAL
+#error LC_WP_ERR_EVENT_INTERVAL must be defined!
+#elif LC_WP_ERR_EVENT_INTERVAL < 1
+#error LC_WP_ERR_EVENT_INTERVAL must not be less than 1
+#endif
+
 #endif
@@ -26,7 +26,10 @@
 *************************************************************************/
 #include "lc_app.h"
 #include "lc_watch.h"
+#include "lc_action.h"
+#include "lc_cmds.h"
 #include "lc_eventids.h"
+#include "lc_msgids.h"
 #include "lc_custom.h"
 #include "lc_perfids.h"
 #include "lc_platform_cfg.h"
@@ -42,88 +45,176 @@
  * Note these are not ideal/complete implementations of these macros, but they
  * are OK based on the way they are used inside this source file.  Use caution if
  * changing the code using these, notably:
- *  - isfinite assumes float type
- *  - both macros evaluate the argument twice - use only with a simple variable
+ *  - isfinite assumes float type, double values use LC_ISFINITE_DOUBLE
+ *  - the macros evaluate the argument twice - use only with a simple variable
  */
 #ifndef isnan
 #define isnan(x) ((x) != (x))
 #endif
 #ifndef isfinite
-#define isfinite(x) ((x) > -FLT_MAX && (x) < FLT_MAX)
+#define isfinite(x)           ((x) > -FLT_MAX && (x) < FLT_MAX)
+#define LC_ISFINITE_DOUBLE(x) ((x) >= -DBL_MAX && (x) <= DBL_MAX)
+#else
+#define LC_ISFINITE_DOUBLE(x) isfinite(x)
 #endif
 
+/*
+ * Select the SIMD instructions used to compare watchpoint batches.
+ * SSE2 is only used when scalar float math is also done in SSE
+ * registers, and NEON only on AArch64 where it is IEEE-754 compliant
+ * (no flush to zero), so batch results match the scalar comparisons.
+ */
+#if defined(__SSE2__) && (defined(__x86_64__) || defined(__SSE2_MATH__))
+#include <emmintrin.h>
+#define LC_WATCH_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define LC_WATCH_SIMD_NEON
+#endif
+
+/*
+ * Detect the host byte order at compile time so packet data can be
+ * read with one unaligned load and a byte swap only when it differs.
+ * Other compilers fall back to assembling the value a byte at a time.
+ */
+#if defined(__GNUC__) && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define LC_HOST_LITTLE_ENDIAN
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LC_HOST_BIG_ENDIAN
+#endif
+#endif
+
+/*
+ * Width and sign of the value compared for each extractor,
+ * used to truncate the masked data back to the watchpoint size
+ */
+static const uint32 LC_WP_EXTRACT_WIDTH[LC_WP_EXTRACT_COUNT] = { 0xFF,   0xFF,   0xFFFF,     0xFFFF,
+                                                                 0xFFFF, 0xFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+static const uint32 LC_WP_EXTRACT_SIGN[LC_WP_EXTRACT_COUNT]  = { 0, 0x80, 0, 0, 0x8000, 0x8000, 0, 0 };
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_HashMessageID() - mix messageID bits for the dispatch index  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 LC_HashMessageID(CFE_SB_MsgId_t MessageID, uint32 Seed)
+{
+    uint32 Hash;
+
+    /*
+    ** 32 bit finalizer from MurmurHash3. Every input bit affects
+    ** every output bit, and the mapping is one-to-one so distinct
+    ** MessageIDs never produce the same 32 bit result.
+    */
+    Hash = (uint32)CFE_SB_MsgIdToValue(MessageID) ^ Seed;
+    Hash ^= Hash >> 16;
+    Hash *= 0x85EBCA6BU;
+    Hash ^= Hash >> 13;
+    Hash *= 0xC2B2AE35U;
+    Hash ^= Hash >> 16;
+
+    return Hash;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* LC_GetHashTableIndex() - convert messageID to hash table index  */
+/* LC_GetHashTableIndex() - convert messageID to hash table slot   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID)
 {
+    uint32 Hash;
+
     /*
-    **   The purpose of a hash function is to take the input value
-    ** and convert it to an index into the hash table. Assume that
-    ** the range of input values is much different (larger) than
-    ** the number of entries in the hash table. Then multiple input
-    ** values must resolve to the same output table index. This is ok
-    ** because each entry in the hash table is a linked list of all
-    ** the inputs with the same hash function result.
-    **
-    **   This particular hash function takes advantage of knowledge
-    ** regarding the format of the input values (cFE MessageID). By
-    ** ignoring the bits that define version number, packet type and
-    ** secondary header (high 5 bits of 16) we are left with the bits
-    ** (mask = 0x7FF) that can identify 2048 unique input telemetry
-    ** packets. Also, by using a fixed hash table size of 256 entries
-    ** and using only the lower 8 bits of the bitmask as the result
-    ** of the hash function, no single hash table entry will have more
-    ** than 8 elements in its linked list.
+    **   The low bits of the hash select a displacement bucket and the
+    ** high bits select a base slot. The displacement stored for the
+    ** bucket was chosen when the table was built so that every
+    ** referenced MessageID lands in its own slot, so a lookup is a
+    ** single probe followed by one MessageID compare.
     */
-    return ((uint32)(CFE_SB_MsgIdToValue(MessageID) & LC_HASH_TABLE_MASK));
+    Hash = LC_HashMessageID(MessageID, LC_OperData.MsgIndex->HashSeed);
+
+    return (((Hash >> (32 - LC_HASH_SLOT_BITS)) ^ LC_OperData.MsgIndex->HashDisp[Hash & LC_HASH_TABLE_MASK]) &
+            LC_HASH_SLOT_MASK);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* LC_CreateHashTable() - create watchpoint hash table             */
+/* LC_FindMessageIndex() - find dispatch index entry for messageID */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-void LC_CreateHashTable(void)
+LC_MessageList_t *LC_FindMessageIndex(CFE_SB_MsgId_t MessageID)
 {
-    LC_WatchPtList_t *WatchPtLink;
-    CFE_SB_MsgId_t    LastMessageID;
-    CFE_SB_MsgId_t    MessageID;
-    int32             MessageLinkIndex;
-    int32             WatchPtTblIndex;
-    CFE_Status_t      Result;
+    LC_MessageList_t *MessageList = (LC_MessageList_t *)NULL;
+    uint32            MessageIndex;
 
-    /* Un-subscribe to any MessageID's referenced in previous Watchpoint Definition Table */
-    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount; MessageLinkIndex++)
+    if (LC_OperData.MsgIndex->HashValid)
     {
-        MessageID = LC_OperData.MessageLinks[MessageLinkIndex].MessageID;
+        MessageIndex = LC_OperData.MsgIndex->HashSlots[LC_GetHashTableIndex(MessageID)];
 
-        if ((Result = CFE_SB_Unsubscribe(MessageID, LC_OperData.CmdPipe)) != CFE_SUCCESS)
+        /* Slot may belong to a different MessageID or be empty */
+        if ((MessageIndex != LC_HASH_SLOT_EMPTY) &&
+            CFE_SB_MsgId_Equal(LC_OperData.MsgIndex->MessageList[MessageIndex].MessageID, MessageID))
         {
-            CFE_EVS_SendEvent(LC_UNSUB_WP_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Error unsubscribing watchpoint: MID=0x%08lX, RC=0x%08X",
-                              (unsigned long)CFE_SB_MsgIdToValue(MessageID),
-                              (unsigned int)Result);
+            MessageList = &LC_OperData.MsgIndex->MessageList[MessageIndex];
         }
     }
+    else
+    {
+        /* Perfect hash could not be built - fall back to a linear search */
+        for (MessageIndex = 0; MessageIndex < LC_OperData.MsgIndex->MessageIDsCount; MessageIndex++)
+        {
+            if (CFE_SB_MsgId_Equal(LC_OperData.MsgIndex->MessageList[MessageIndex].MessageID, MessageID))
+            {
+                MessageList = &LC_OperData.MsgIndex->MessageList[MessageIndex];
+                break;
+            }
+        }
+    }
+
+    return MessageList;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CreateHashTable() - create watchpoint dispatch index         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CreateHashTable(void)
+{
+    LC_MsgIndex_t  *Index;
+    LC_HashBuild_t *Build = &LC_OperData.HashBuild;
+    CFE_SB_MsgId_t  LastMessageID;
+    CFE_SB_MsgId_t  MessageID;
+    uint16          MessageIndex;
+    int32           WatchPtTblIndex;
+    uint16          WatchStart;
+
+    /* Build into the buffer packet processing is not using */
+    if (LC_OperData.MsgIndex == &LC_OperData.MsgIndexBuf[0])
+    {
+        Build->Index = &LC_OperData.MsgIndexBuf[1];
+    }
+    else
+    {
+        Build->Index = &LC_OperData.MsgIndexBuf[0];
+    }
 
-    /* Initialize hash table structures */
-    memset(LC_OperData.HashTable, 0, sizeof(LC_OperData.HashTable));
-    memset(LC_OperData.MessageLinks, 0, sizeof(LC_OperData.MessageLinks));
-    memset(LC_OperData.WatchPtLinks, 0, sizeof(LC_OperData.WatchPtLinks));
+    Index = Build->Index;
 
-    LC_OperData.MessageIDsCount = 0;
-    LC_OperData.WatchpointCount = 0;
+    /* Initialize dispatch index structures */
+    memset(Index, 0, sizeof(*Index));
+    memset(Build->Lookup, 0xFF, sizeof(Build->Lookup));
 
     LastMessageID = CFE_SB_INVALID_MSG_ID;
-    WatchPtLink   = (LC_WatchPtList_t *)NULL;
+    MessageIndex  = LC_HASH_SLOT_EMPTY;
 
-    /* Process each entry in the Watchpoint Definition Table */
+    /* First pass - find each unique MessageID and count its watchpoints */
     for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS; WatchPtTblIndex++)
     {
         /* Skip unused watchpoint table entries */
@@ -132,328 +223,2265 @@ void LC_CreateHashTable(void)
             MessageID = LC_OperData.WDTPtr[WatchPtTblIndex].MessageID;
 
             /* Use optimized code path if same MessageID as last watchpoint */
-            if (CFE_SB_MsgId_Equal(LastMessageID, MessageID) && (WatchPtLink != (LC_WatchPtList_t *)NULL))
+            if (CFE_SB_MsgId_Equal(LastMessageID, MessageID) && (MessageIndex != LC_HASH_SLOT_EMPTY))
             {
-                /* WatchPtLink points to last link in list for this Message ID */
-                WatchPtLink->Next = &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++];
-
-                /* Add new link to end of list, point to new last link */
-                WatchPtLink = WatchPtLink->Next;
+                Index->MessageList[MessageIndex].WatchCount++;
+                Index->WatchpointCount++;
             }
             else
             {
-                /* May add message list link and subscribe to MessageID */
-                WatchPtLink = LC_AddWatchpoint(MessageID);
+                /* May add message index entry for MessageID */
+                MessageIndex = LC_AddWatchpoint(MessageID);
+            }
+
+            LastMessageID = MessageID;
+        }
+    }
+
+    /* LC's own MessageIDs resolve through the same lookup as monitor packets */
+    LC_AddHandlerMID(CFE_SB_ValueToMsgId(LC_SAMPLE_AP_MID), LC_MSG_HANDLER_SAMPLE_AP);
+    LC_AddHandlerMID(CFE_SB_ValueToMsgId(LC_SEND_HK_MID), LC_MSG_HANDLER_SEND_HK);
+    LC_AddHandlerMID(CFE_SB_ValueToMsgId(LC_CMD_MID), LC_MSG_HANDLER_CMD);
+
+    /* Assign each MessageID a contiguous span of the watchpoint list */
+    WatchStart = 0;
+    for (MessageIndex = 0; MessageIndex < Index->MessageIDsCount; MessageIndex++)
+    {
+        Index->MessageList[MessageIndex].WatchStart = WatchStart;
+        Build->WatchFill[MessageIndex]              = WatchStart;
+        WatchStart += Index->MessageList[MessageIndex].WatchCount;
+    }
+
+    /* Second pass - fill each span in watchpoint table order */
+    LastMessageID = CFE_SB_INVALID_MSG_ID;
+    MessageIndex  = LC_HASH_SLOT_EMPTY;
+
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS; WatchPtTblIndex++)
+    {
+        if (LC_OperData.WDTPtr[WatchPtTblIndex].DataType != LC_DATA_WATCH_NOT_USED)
+        {
+            MessageID = LC_OperData.WDTPtr[WatchPtTblIndex].MessageID;
+
+            if (!CFE_SB_MsgId_Equal(LastMessageID, MessageID) || (MessageIndex == LC_HASH_SLOT_EMPTY))
+            {
+                MessageIndex = Build->Lookup[LC_FindBuildSlot(MessageID)];
             }
 
-            /* Set watchpoint table index for this entry in list */
-            WatchPtLink->WatchIndex = WatchPtTblIndex;
+            Index->WatchPtList[Build->WatchFill[MessageIndex]++] = WatchPtTblIndex;
 
             LastMessageID = MessageID;
         }
     }
 
+    /* Only touch subscriptions for MessageIDs added or removed by the load */
+    LC_UpdateSubscriptions();
+
+    /* Make MessageID lookups a single probe */
+    if (!LC_BuildPerfectHash())
+    {
+        CFE_EVS_SendEvent(LC_HASH_BUILD_ERR_EID,
+                          CFE_EVS_EventType_ERROR,
+                          "Perfect hash build failed after %d seeds: MIDs=%d, using linear search",
+                          LC_HASH_MAX_SEEDS,
+                          Index->MessageIDsCount);
+    }
+
+    /* Resolve each watchpoint's extractor and comparison once per load */
+    LC_CompileWatchpoints();
+
+    /* Make like watchpoints on the same message adjacent for batching */
+    LC_GroupWatchpoints();
+
+    /* Packets are dispatched with the new index from here on */
+    LC_PublishIndex();
+
+    /* Keep the definitions this index was built from for the next load */
+    memcpy(LC_OperData.WDTShadow, LC_OperData.WDTPtr, sizeof(LC_OperData.WDTShadow));
+
     return;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* LC_AddWatchpoint() - add one watchpoint entry to hash table     */
+/* LC_UpdateSubscriptions() - subscribe to the new MessageID set   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-LC_WatchPtList_t *LC_AddWatchpoint(CFE_SB_MsgId_t MessageID)
+void LC_UpdateSubscriptions(void)
 {
-    LC_MessageList_t *MessageLink;
-    LC_WatchPtList_t *WatchPtLink;
-    bool              NeedSubscription;
-    int32             HashTableIndex;
-    CFE_Status_t      Result;
-
-    /* Hash function converts MessageID into hash table index */
-    HashTableIndex = LC_GetHashTableIndex(MessageID);
-
-    /* Subscribe only for first reference to each MessageID */
-    NeedSubscription = false;
-
-    /* Each hash table entry is a linked list of MessageID's with same hash result */
-    if (LC_OperData.HashTable[HashTableIndex] == (LC_MessageList_t *)NULL)
+    const LC_MsgIndex_t *Active = LC_OperData.MsgIndex;
+    LC_HashBuild_t      *Build  = &LC_OperData.HashBuild;
+    LC_MsgIndex_t       *Index  = Build->Index;
+    LC_UnrefMsgs_t      *UnrefMsgs = &LC_OperData.UnrefMsgs;
+    LC_UnrefMsg_t       *Entry;
+    CFE_SB_MsgId_t       MessageID;
+    uint16               MessageIndex;
+    uint16               OldIndex;
+    uint16               i;
+    CFE_Status_t         Result;
+
+    memset(Build->Subscribed, 0, sizeof(Build->Subscribed));
+
+    /* Drop MessageIDs no longer referenced, keep the rest subscribed */
+    for (OldIndex = 0; OldIndex < Active->MessageIDsCount; OldIndex++)
     {
-        /* Get next unused MessageID linked list entry */
-        MessageLink = &LC_OperData.MessageLinks[LC_OperData.MessageIDsCount++];
+        MessageID    = Active->MessageList[OldIndex].MessageID;
+        MessageIndex = Build->Lookup[LC_FindBuildSlot(MessageID)];
 
-        /* Set first (and only) link in this hash table entry linked list */
-        LC_OperData.HashTable[HashTableIndex] = MessageLink;
+        if (MessageIndex != LC_HASH_SLOT_EMPTY)
+        {
+            Build->Subscribed[MessageIndex] = true;
+        }
+        else if ((Result = CFE_SB_Unsubscribe(MessageID, LC_OperData.CmdPipe)) != CFE_SUCCESS)
+        {
+            /* Remembered so a later table does not subscribe a second time */
+            Entry = LC_TrackUnrefMsg(MessageID);
 
-        /* Set the MessageID for this link */
-        MessageLink->MessageID = MessageID;
+            if (Entry != NULL)
+            {
+                Entry->Subscribed = true;
+            }
 
-        /* Subscribe to first link in list */
-        NeedSubscription = true;
+            CFE_EVS_SendEvent(LC_UNSUB_WP_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error unsubscribing watchpoint: MID=0x%08lX, RC=0x%08X",
+                              (unsigned long)CFE_SB_MsgIdToValue(MessageID),
+                              (unsigned int)Result);
+        }
     }
-    else
-    {
-        /* Get start of linked list (all MID's with same hash result) */
-        MessageLink = LC_OperData.HashTable[HashTableIndex];
 
-        /* Find the link for this MessageID */
-        while (!CFE_SB_MsgId_Equal(MessageLink->MessageID, MessageID))
+    /*
+    ** MessageIDs left subscribed by a failed unsubscribe are already
+    ** subscribed, and the new index takes them over if it references them
+    */
+    for (i = 0; i < UnrefMsgs->EntryCount; i++)
+    {
+        if (UnrefMsgs->Entry[i].Subscribed == true)
         {
-            if (MessageLink->Next == (LC_MessageList_t *)NULL)
-            {
-                /* Reached end of list without finding MessageID */
-                MessageLink->Next = &LC_OperData.MessageLinks[LC_OperData.MessageIDsCount++];
-                MessageLink       = MessageLink->Next;
+            MessageIndex = Build->Lookup[LC_FindBuildSlot(UnrefMsgs->Entry[i].MessageID)];
 
-                /* Add link with this MessageID (will exit loop) */
-                MessageLink->MessageID = MessageID;
-
-                /* Subscribe to new link in list */
-                NeedSubscription = true;
-            }
-            else
+            if (MessageIndex != LC_HASH_SLOT_EMPTY)
             {
-                /* Try the next link in the list */
-                MessageLink = MessageLink->Next;
+                Build->Subscribed[MessageIndex] = true;
+                UnrefMsgs->Entry[i].Subscribed  = false;
             }
         }
     }
 
-    /* Subscribe only once to each MessageID */
-    if (NeedSubscription)
+    /* Subscribe to MessageIDs the previous table did not reference */
+    for (MessageIndex = 0; MessageIndex < Index->MessageIDsCount; MessageIndex++)
     {
-        if ((Result = CFE_SB_Subscribe(MessageID, LC_OperData.CmdPipe)) != CFE_SUCCESS)
+        /* LC's own MessageIDs are subscribed to once at startup */
+        if ((Build->Subscribed[MessageIndex] == false) &&
+            (Index->MessageList[MessageIndex].Handler == LC_MSG_HANDLER_WATCH))
         {
-            /* Signal the error, but continue */
-            CFE_EVS_SendEvent(LC_SUB_WP_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "Error subscribing watchpoint: MID=0x%08lX, RC=0x%08X",
-                              (unsigned long)CFE_SB_MsgIdToValue(MessageID),
-                              (unsigned int)Result);
+            MessageID = Index->MessageList[MessageIndex].MessageID;
+
+            if ((Result = CFE_SB_Subscribe(MessageID, LC_OperData.CmdPipe)) != CFE_SUCCESS)
+            {
+                /* Signal the error, but continue */
+                CFE_EVS_SendEvent(LC_SUB_WP_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "Error subscribing watchpoint: MID=0x%08lX, RC=0x%08X",
+                                  (unsigned long)CFE_SB_MsgIdToValue(MessageID),
+                                  (unsigned int)Result);
+            }
         }
     }
 
-    /* MessageLink points to the link for this MessageID */
-    if (MessageLink->WatchPtList == (LC_WatchPtList_t *)NULL)
-    {
-        /* Get next unused watchpoint linked list entry */
-        WatchPtLink = &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++];
+    return;
+}
 
-        /* Set the start (and only) link in the watchpoint link list */
-        MessageLink->WatchPtList = WatchPtLink;
-    }
-    else
-    {
-        /* Find the end of the watchpoint linked list */
-        WatchPtLink = MessageLink->WatchPtList;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_PublishIndex() - make the newly built index the active one   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_PublishIndex(void)
+{
+    LC_UnrefMsgs_t *UnrefMsgs = &LC_OperData.UnrefMsgs;
+    uint16          Kept;
+    uint16          i;
+
+    /*
+    ** Packet digests and sequence counts are kept by MessageList
+    ** index, which the new index may assign to a different MessageID
+    */
+    memset(LC_OperData.MsgDigest, 0, sizeof(LC_OperData.MsgDigest));
+    memset(LC_OperData.MsgSeq, 0, sizeof(LC_OperData.MsgSeq));
+
+    /*
+    ** MessageIDs the previous table did not reference may be referenced
+    ** now, so the counts start over. Only the MessageIDs still subscribed
+    ** to after a failed unsubscribe are kept, so their subscription
+    ** state is known when a later table references them.
+    */
+    Kept = 0;
 
-        while (WatchPtLink->Next != (LC_WatchPtList_t *)NULL)
+    for (i = 0; i < UnrefMsgs->EntryCount; i++)
+    {
+        if (UnrefMsgs->Entry[i].Subscribed == true)
         {
-            WatchPtLink = WatchPtLink->Next;
+            UnrefMsgs->Entry[Kept].MessageID  = UnrefMsgs->Entry[i].MessageID;
+            UnrefMsgs->Entry[Kept].MsgCount   = 0;
+            UnrefMsgs->Entry[Kept].Subscribed = true;
+            Kept++;
         }
-
-        /* Add the new watchpoint link to the end of the list */
-        WatchPtLink->Next = &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++];
-        WatchPtLink       = WatchPtLink->Next;
     }
 
-    /* Return pointer to last link in watchpoint linked list */
+    memset(&UnrefMsgs->Entry[Kept], 0, (LC_MAX_UNREF_MSGIDS - Kept) * sizeof(LC_UnrefMsg_t));
+
+    UnrefMsgs->EntryCount        = Kept;
+    UnrefMsgs->UntrackedCount    = 0;
+    UnrefMsgs->UnsubscribedCount = 0;
+
+    /*
+    ** The index is complete, so one pointer store switches packet
+    ** processing over and the previous buffer becomes the spare
+    */
+    LC_OperData.MsgIndex = LC_OperData.HashBuild.Index;
 
-    return WatchPtLink;
+    return;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Handle a message with possible watchpoints                      */
+/* LC_ResetChangedWatchpoints() - reset results of redefined WPs   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
-{
-    CFE_TIME_SysTime_t Timestamp;
-    LC_MessageList_t  *MessageList;
-    LC_WatchPtList_t  *WatchPtList;
-    bool               WatchPtFound = false;
 
-    Timestamp.Seconds    = 0;
-    Timestamp.Subseconds = 0;
+uint16 LC_ResetChangedWatchpoints(void)
+{
+    uint16 WatchIndex;
+    uint16 ChangedCount = 0;
 
-    /* Do nothing if disabled at the application level */
-    if (LC_AppData.CurrentLCState != LC_STATE_DISABLED)
+    /*
+    ** Watchpoints whose definition is the same as in the previous
+    ** table keep their results and statistics across the load
+    */
+    for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++)
     {
-        /* Use message timestamp - if none, use current time */
-        CFE_MSG_GetMsgTime(&BufPtr->Msg, &Timestamp);
-
-        if ((Timestamp.Seconds == 0) && (Timestamp.Subseconds == 0))
+        if (memcmp(&LC_OperData.WDTPtr[WatchIndex], &LC_OperData.WDTShadow[WatchIndex], sizeof(LC_WDTEntry_t)) != 0)
         {
-            Timestamp = CFE_TIME_GetTime();
+            LC_OperData.WatchCache[WatchIndex].Valid = false;
+            LC_ResetResultsWP(WatchIndex, WatchIndex, false);
+            ChangedCount++;
         }
+    }
 
-        /* Performance Log (start time counter) */
-        CFE_ES_PerfLogEntry(LC_WDT_SEARCH_PERF_ID);
+    return ChangedCount;
+}
 
-        /* Get start of linked list (all MID's with same hash result) */
-        MessageList = LC_OperData.HashTable[LC_GetHashTableIndex(MessageID)];
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_FindBuildSlot() - find build lookup slot for messageID       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-        /* NULL when list is empty or end of list */
-        while (MessageList != (LC_MessageList_t *)NULL)
-        {
-            /* Compare this linked list entry for matching MessageID */
-            if (CFE_SB_MsgId_Equal(MessageList->MessageID, MessageID))
-            {
-                /* Stop the search - we found it */
-                break;
-            }
+uint32 LC_FindBuildSlot(CFE_SB_MsgId_t MessageID)
+{
+    LC_HashBuild_t *Build = &LC_OperData.HashBuild;
+    uint32          Slot;
 
-            /* Max of 8 links per design */
-            MessageList = MessageList->Next;
-        }
+    /*
+    ** Open addressed table with linear probing, only used while the
+    ** dispatch index is built. The table is never more than half
+    ** full, so the probe always ends at a match or an empty slot.
+    */
+    Slot = LC_HashMessageID(MessageID, 0) & LC_HASH_SLOT_MASK;
 
-        /* Should be true - else wouldn't subscribe to MessageID */
-        if (MessageList != (LC_MessageList_t *)NULL)
-        {
-            /* Get linked list of WP's that reference MessageID */
-            WatchPtList = MessageList->WatchPtList;
+    while ((Build->Lookup[Slot] != LC_HASH_SLOT_EMPTY) &&
+           !CFE_SB_MsgId_Equal(Build->Index->MessageList[Build->Lookup[Slot]].MessageID, MessageID))
+    {
+        Slot = (Slot + 1) & LC_HASH_SLOT_MASK;
+    }
 
-            /* NULL when list is empty or end of list */
-            while (WatchPtList != (LC_WatchPtList_t *)NULL)
-            {
-                WatchPtFound = true;
+    return Slot;
+}
 
-                /* Verify that WP packet offset is within actual packet */
-                if (LC_WPOffsetValid(WatchPtList->WatchIndex, BufPtr) == true)
-                {
-                    LC_ProcessWP(WatchPtList->WatchIndex, BufPtr, Timestamp);
-                }
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_AddWatchpoint() - add one watchpoint entry to dispatch index */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-                /* No limit to how many WP's can reference one MessageID */
-                WatchPtList = WatchPtList->Next;
-            }
-        }
+uint16 LC_AddWatchpoint(CFE_SB_MsgId_t MessageID)
+{
+    LC_HashBuild_t *Build = &LC_OperData.HashBuild;
+    LC_MsgIndex_t  *Index = Build->Index;
+    uint16          MessageIndex;
+    uint32          Slot;
 
-        /* Performance Log (stop time counter) */
-        CFE_ES_PerfLogExit(LC_WDT_SEARCH_PERF_ID);
+    Slot = LC_FindBuildSlot(MessageID);
 
-        if (WatchPtFound == true)
-        {
-            LC_AppData.MonitoredMsgCount++;
-        }
-        else
-        {
-            /* MessageID with no defined watchpoints */
-            CFE_EVS_SendEvent(LC_MID_INF_EID,
-                              CFE_EVS_EventType_INFORMATION,
-                              "Msg with unreferenced message ID rcvd: ID = 0x%08lX",
-                              (unsigned long)CFE_SB_MsgIdToValue(MessageID));
-        }
+    /* Add a message index entry for first reference to each MessageID */
+    if (Build->Lookup[Slot] == LC_HASH_SLOT_EMPTY)
+    {
+        /* Get next unused message index entry */
+        MessageIndex        = Index->MessageIDsCount++;
+        Build->Lookup[Slot] = MessageIndex;
+
+        Index->MessageList[MessageIndex].MessageID = MessageID;
+    }
+    else
+    {
+        MessageIndex = Build->Lookup[Slot];
     }
 
-    return;
+    Index->MessageList[MessageIndex].WatchCount++;
+    Index->WatchpointCount++;
+
+    /* Return index of the message entry for this MessageID */
+
+    return MessageIndex;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Process a single watchpoint                                     */
+/* LC_AddHandlerMID() - add one of LC's MessageIDs to the index    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_SysTime_t Timestamp)
+
+void LC_AddHandlerMID(CFE_SB_MsgId_t MessageID, uint8 Handler)
 {
-    uint8 *WPDataPtr;
-    uint8  PreviousResult;
-    uint8  WPEvalResult;
-    uint32 SizedWPData;
-    uint32 MaskedWPData;
-    uint32 StaleCounter;
-    bool   SizedDataValid;
+    LC_HashBuild_t *Build = &LC_OperData.HashBuild;
+    LC_MsgIndex_t  *Index = Build->Index;
+    uint16          MessageIndex;
+    uint32          Slot;
 
-    /*
-    ** Setup the pointer and get the massaged data
-    */
-    WPDataPtr = ((uint8 *)BufPtr) + LC_OperData.WDTPtr[WatchIndex].WatchpointOffset;
+    Slot = LC_FindBuildSlot(MessageID);
 
-    SizedDataValid = LC_GetSizedWPData(WatchIndex, WPDataPtr, &SizedWPData);
-    if (SizedDataValid == true)
+    /* A watchpoint may already reference the MessageID */
+    if (Build->Lookup[Slot] == LC_HASH_SLOT_EMPTY)
     {
-        /*
-        ** Get the last evaluation result for this watchpoint
-        */
-        PreviousResult = LC_OperData.WRTPtr[WatchIndex].WatchResult;
-
-        /*
-        ** Apply the defined bitmask for this watchpoint and then
-        ** call the mission defined custom function or do our own
-        ** relational comparison.
-        */
-        MaskedWPData = SizedWPData & LC_OperData.WDTPtr[WatchIndex].BitMask;
+        MessageIndex        = Index->MessageIDsCount++;
+        Build->Lookup[Slot] = MessageIndex;
 
-        if (LC_OperData.WDTPtr[WatchIndex].OperatorID == LC_OPER_CUSTOM)
-        {
-            WPEvalResult =
-                LC_CustomFunction(WatchIndex, MaskedWPData, BufPtr, LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument);
-        }
-        else
-        {
-            WPEvalResult = LC_OperatorCompare(WatchIndex, MaskedWPData);
-        }
+        Index->MessageList[MessageIndex].MessageID = MessageID;
+    }
+    else
+    {
+        MessageIndex = Build->Lookup[Slot];
+    }
 
-        /*
-        ** Update the watch result
-        */
-        LC_OperData.WRTPtr[WatchIndex].WatchResult = WPEvalResult;
+    Index->MessageList[MessageIndex].Handler = Handler;
 
-        /*
-        ** Update the watchpoint statistics based on the evaluation
-        ** result
-        */
-        LC_OperData.WRTPtr[WatchIndex].EvaluationCount++;
+    return;
+}
 
-        if (WPEvalResult == LC_WATCH_TRUE)
-        {
-            LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount++;
-            LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount++;
-            StaleCounter                                    = LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = StaleCounter;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_BuildPerfectHash() - assign every MessageID its own slot     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-            if ((PreviousResult == LC_WATCH_FALSE) || (PreviousResult == LC_WATCH_STALE))
-            {
-                LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.DataType = LC_OperData.WDTPtr[WatchIndex].DataType;
+bool LC_BuildPerfectHash(void)
+{
+    LC_HashBuild_t *Build = &LC_OperData.HashBuild;
+    LC_MsgIndex_t  *Index = Build->Index;
+    uint32          SeedAttempt;
+    uint32          Hash;
+    uint32          Bucket;
+    uint32          Disp;
+    uint32          Slot;
+    uint16          MessageIndex;
+    uint16          Member;
+    uint16          BucketSize;
+    uint16          MaxBucketSize;
+    bool            Placed = false;
+
+    for (SeedAttempt = 0; (SeedAttempt < LC_HASH_MAX_SEEDS) && !Placed; SeedAttempt++)
+    {
+        Index->HashSeed = SeedAttempt * 0x9E3779B9U;
 
-                LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount++;
+        memset(Index->HashDisp, 0, sizeof(Index->HashDisp));
+        memset(Index->HashSlots, 0xFF, sizeof(Index->HashSlots));
+        memset(Build->BucketHead, 0xFF, sizeof(Build->BucketHead));
+        memset(Build->BucketSize, 0, sizeof(Build->BucketSize));
 
-                LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value = MaskedWPData;
+        /* Sort MessageIDs into buckets using the low bits of the hash */
+        MaxBucketSize = 0;
+        for (MessageIndex = 0; MessageIndex < Index->MessageIDsCount; MessageIndex++)
+        {
+            Bucket = LC_HashMessageID(Index->MessageList[MessageIndex].MessageID, Index->HashSeed) &
+                     LC_HASH_TABLE_MASK;
 
-                LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds = Timestamp.Seconds;
+            Build->BucketNext[MessageIndex] = Build->BucketHead[Bucket];
+            Build->BucketHead[Bucket]       = MessageIndex;
 
-                LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds = Timestamp.Subseconds;
+            if (++Build->BucketSize[Bucket] > MaxBucketSize)
+            {
+                MaxBucketSize = Build->BucketSize[Bucket];
             }
         }
-        else if (WPEvalResult == LC_WATCH_FALSE)
-        {
-            LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount = 0;
-            StaleCounter                                        = LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale     = StaleCounter;
 
-            if ((PreviousResult == LC_WATCH_TRUE) || (PreviousResult == LC_WATCH_STALE))
+        /*
+        ** Place the largest buckets first while most slots are free.
+        ** For each bucket, find the first displacement that moves every
+        ** member into an empty slot. Members that share a base slot can
+        ** never be separated, so that forces a new seed.
+        */
+        Placed = true;
+        for (BucketSize = MaxBucketSize; (BucketSize > 0) && Placed; BucketSize--)
+        {
+            for (Bucket = 0; (Bucket < LC_HASH_TABLE_ENTRIES) && Placed; Bucket++)
             {
-                LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.DataType = LC_OperData.WDTPtr[WatchIndex].DataType;
+                if (Build->BucketSize[Bucket] != BucketSize)
+                {
+                    continue;
+                }
 
-                LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value = MaskedWPData;
+                Placed = false;
+                for (Disp = 0; (Disp < LC_HASH_SLOT_ENTRIES) && !Placed; Disp++)
+                {
+                    /* Claim slots for each member, release them on conflict */
+                    Placed = true;
+                    for (Member = Build->BucketHead[Bucket]; Member != LC_HASH_SLOT_EMPTY;
+                         Member = Build->BucketNext[Member])
+                    {
+                        Hash = LC_HashMessageID(Index->MessageList[Member].MessageID, Index->HashSeed);
+                        Slot = ((Hash >> (32 - LC_HASH_SLOT_BITS)) ^ Disp) & LC_HASH_SLOT_MASK;
+
+                        if (Index->HashSlots[Slot] != LC_HASH_SLOT_EMPTY)
+                        {
+                            Placed = false;
+                            break;
+                        }
+
+                        Index->HashSlots[Slot] = Member;
+                    }
+
+                    if (Placed)
+                    {
+                        Index->HashDisp[Bucket] = Disp;
+                    }
+                    else
+                    {
+                        for (MessageIndex = Build->BucketHead[Bucket]; MessageIndex != Member;
+                             MessageIndex  = Build->BucketNext[MessageIndex])
+                        {
+                            Hash = LC_HashMessageID(Index->MessageList[MessageIndex].MessageID, Index->HashSeed);
+                            Slot = ((Hash >> (32 - LC_HASH_SLOT_BITS)) ^ Disp) & LC_HASH_SLOT_MASK;
+                            Index->HashSlots[Slot] = LC_HASH_SLOT_EMPTY;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    Index->HashValid = Placed;
+
+    return Placed;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CompileWatchpoints() - build compiled watchpoint program     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CompileWatchpoints(void)
+{
+    LC_MsgIndex_t *Index = LC_OperData.HashBuild.Index;
+    LC_WDTEntry_t *WDTEntry;
+    uint32         MessageIndex;
+    uint32         Position;
+    uint32         WatchEnd;
+    uint32         DataSize;
+    uint32         MaxExtent;
+    uint32         DigestStart;
+    bool           UseDigest;
+
+    for (Position = 0; Position < Index->WatchpointCount; Position++)
+    {
+        LC_CompileWatchpoint(Position);
+    }
+
+    /*
+    ** Find the packet length each MessageID needs for all of its
+    ** watchpoints to be in bounds, so one length check per packet
+    ** replaces a check per watchpoint. A MessageID uses a packet
+    ** digest only when every one of its watchpoints asks for it and
+    ** none is a custom function, which may read any byte of the packet.
+    */
+    for (MessageIndex = 0; MessageIndex < Index->MessageIDsCount; MessageIndex++)
+    {
+        MaxExtent   = 0;
+        DigestStart = LC_MSG_DIGEST_OFF;
+        UseDigest   = (Index->MessageList[MessageIndex].WatchCount > 0);
+        WatchEnd    = Index->MessageList[MessageIndex].WatchStart + Index->MessageList[MessageIndex].WatchCount;
+
+        for (Position = Index->MessageList[MessageIndex].WatchStart; Position < WatchEnd; Position++)
+        {
+            WDTEntry = &LC_OperData.WDTPtr[Index->WatchPtList[Position]];
+            DataSize = LC_GetWPDataSize(WDTEntry->DataType);
+
+            if ((DataSize == 0) || (WDTEntry->WatchpointOffset > (LC_MSG_EXTENT_UNKNOWN - DataSize)))
+            {
+                /* Leave this one to the per-watchpoint check and its event */
+                MaxExtent = LC_MSG_EXTENT_UNKNOWN;
+                break;
+            }
+
+            if ((WDTEntry->WatchpointOffset + DataSize) > MaxExtent)
+            {
+                MaxExtent = WDTEntry->WatchpointOffset + DataSize;
+            }
+
+            if (WDTEntry->WatchpointOffset < DigestStart)
+            {
+                DigestStart = WDTEntry->WatchpointOffset;
+            }
+
+            if (((WDTEntry->WatchOptions & LC_WATCH_OPT_DIGEST) == 0) || (WDTEntry->OperatorID == LC_OPER_CUSTOM))
+            {
+                UseDigest = false;
+            }
+        }
+
+        if ((UseDigest == false) || (MaxExtent == LC_MSG_EXTENT_UNKNOWN) ||
+            ((MaxExtent - DigestStart) > LC_DIGEST_MAX_BYTES))
+        {
+            DigestStart = LC_MSG_DIGEST_OFF;
+        }
+
+        Index->MessageList[MessageIndex].MaxExtent   = MaxExtent;
+        Index->MessageList[MessageIndex].DigestStart = DigestStart;
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CompileWatchpoint() - compile one watchpoint definition      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CompileWatchpoint(uint32 Position)
+{
+    LC_MsgIndex_t     *Index   = LC_OperData.HashBuild.Index;
+    LC_WatchProgram_t *Program = &Index->Program;
+    LC_WDTEntry_t     *WDTEntry;
+    uint8              Kind;
+
+    WDTEntry = &LC_OperData.WDTPtr[Index->WatchPtList[Position]];
+
+    Program->Offset[Position]  = WDTEntry->WatchpointOffset;
+    Program->BitMask[Position] = WDTEntry->BitMask;
+    Program->Compare[Position]       = 0;
+    Program->SecondCompare[Position] = 0;
+    Program->Extract[Position]       = LC_WP_EXTRACT_U32_BE;
+
+    /*
+    ** Resolve the extractor and comparison kind once here
+    ** rather than for every sample, and widen the comparison
+    ** value the same way LC_OperatorCompare does
+    */
+    switch (WDTEntry->DataType)
+    {
+        case LC_DATA_WATCH_BYTE:
+            Program->Extract[Position] = LC_WP_EXTRACT_S8;
+            Program->Compare[Position]       = (uint32)((int32)WDTEntry->ComparisonValue.Signed8);
+            Program->SecondCompare[Position] = (uint32)((int32)WDTEntry->SecondComparisonValue.Signed8);
+            Kind                             = LC_WP_OPCODE_SIGNED;
+            break;
+
+        case LC_DATA_WATCH_UBYTE:
+            Program->Extract[Position] = LC_WP_EXTRACT_U8;
+            Program->Compare[Position]       = WDTEntry->ComparisonValue.Unsigned8;
+            Program->SecondCompare[Position] = WDTEntry->SecondComparisonValue.Unsigned8;
+            Kind                             = LC_WP_OPCODE_UNSIGNED;
+            break;
+
+        case LC_DATA_WATCH_WORD_BE:
+        case LC_DATA_WATCH_WORD_LE:
+            Program->Extract[Position] = (WDTEntry->DataType == LC_DATA_WATCH_WORD_BE) ? LC_WP_EXTRACT_S16_BE
+                                                                                        : LC_WP_EXTRACT_S16_LE;
+            Program->Compare[Position]       = (uint32)((int32)WDTEntry->ComparisonValue.Signed16);
+            Program->SecondCompare[Position] = (uint32)((int32)WDTEntry->SecondComparisonValue.Signed16);
+            Kind                             = LC_WP_OPCODE_SIGNED;
+            break;
+
+        case LC_DATA_WATCH_UWORD_BE:
+        case LC_DATA_WATCH_UWORD_LE:
+            Program->Extract[Position] = (WDTEntry->DataType == LC_DATA_WATCH_UWORD_BE) ? LC_WP_EXTRACT_U16_BE
+                                                                                         : LC_WP_EXTRACT_U16_LE;
+            Program->Compare[Position]       = WDTEntry->ComparisonValue.Unsigned16;
+            Program->SecondCompare[Position] = WDTEntry->SecondComparisonValue.Unsigned16;
+            Kind                             = LC_WP_OPCODE_UNSIGNED;
+            break;
+
+        case LC_DATA_WATCH_DWORD_BE:
+        case LC_DATA_WATCH_DWORD_LE:
+            Program->Extract[Position] = (WDTEntry->DataType == LC_DATA_WATCH_DWORD_BE) ? LC_WP_EXTRACT_U32_BE
+                                                                                         : LC_WP_EXTRACT_U32_LE;
+            Program->Compare[Position]       = WDTEntry->ComparisonValue.Unsigned32;
+            Program->SecondCompare[Position] = WDTEntry->SecondComparisonValue.Unsigned32;
+            Kind                             = LC_WP_OPCODE_SIGNED;
+            break;
+
+        case LC_DATA_WATCH_UDWORD_BE:
+        case LC_DATA_WATCH_UDWORD_LE:
+            Program->Extract[Position] = (WDTEntry->DataType == LC_DATA_WATCH_UDWORD_BE) ? LC_WP_EXTRACT_U32_BE
+                                                                                          : LC_WP_EXTRACT_U32_LE;
+            Program->Compare[Position]       = WDTEntry->ComparisonValue.Unsigned32;
+            Program->SecondCompare[Position] = WDTEntry->SecondComparisonValue.Unsigned32;
+            Kind                             = LC_WP_OPCODE_UNSIGNED;
+            break;
+
+        case LC_DATA_WATCH_FLOAT_BE:
+        case LC_DATA_WATCH_FLOAT_LE:
+            Program->Extract[Position] = (WDTEntry->DataType == LC_DATA_WATCH_FLOAT_BE) ? LC_WP_EXTRACT_U32_BE
+                                                                                         : LC_WP_EXTRACT_U32_LE;
+            Program->Compare[Position]       = WDTEntry->ComparisonValue.Unsigned32;
+            Program->SecondCompare[Position] = WDTEntry->SecondComparisonValue.Unsigned32;
+            Kind                             = LC_WP_OPCODE_FLOAT;
+            break;
+
+        case LC_DATA_WATCH_QWORD_BE:
+        case LC_DATA_WATCH_QWORD_LE:
+        case LC_DATA_WATCH_UQWORD_BE:
+        case LC_DATA_WATCH_UQWORD_LE:
+        case LC_DATA_WATCH_DOUBLE_BE:
+        case LC_DATA_WATCH_DOUBLE_LE:
+            /*
+            ** 64 bit values don't fit the 32 bit program lanes,
+            ** evaluate them with LC_ProcessWP instead
+            */
+            Kind = LC_WP_OPCODE_LEGACY;
+            break;
+
+        default:
+            /* Let LC_ProcessWP report the error */
+            Kind = LC_WP_OPCODE_LEGACY;
+            break;
+    }
+
+    if (Kind == LC_WP_OPCODE_LEGACY)
+    {
+        Program->Opcode[Position] = LC_WP_OPCODE_LEGACY;
+    }
+    else if (WDTEntry->OperatorID == LC_OPER_CUSTOM)
+    {
+        Program->Opcode[Position] = LC_WP_OPCODE_CUSTOM;
+    }
+    else if (((WDTEntry->OperatorID >= LC_OPER_LT) && (WDTEntry->OperatorID <= LC_OPER_GT)) ||
+             ((WDTEntry->OperatorID >= LC_OPER_IN_RANGE) && (WDTEntry->OperatorID <= LC_OPER_HYSTERESIS)))
+    {
+        Program->Opcode[Position] = Kind | WDTEntry->OperatorID;
+
+        /* Resolve the hysteresis direction once, not per sample */
+        if ((WDTEntry->OperatorID == LC_OPER_HYSTERESIS) &&
+            (LC_CompareCompiledValue(Kind | LC_OPER_GE, Program->Compare[Position], Program->SecondCompare[Position]) !=
+             LC_WATCH_TRUE))
+        {
+            Program->Opcode[Position] = Kind | LC_WP_OPER_HYSTERESIS_LOW;
+        }
+    }
+    else
+    {
+        Program->Opcode[Position] = LC_WP_OPCODE_LEGACY;
+    }
+
+    Program->RunLength[Position] = 1;
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_GroupWatchpoints() - group like watchpoints into batches     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_GroupWatchpoints(void)
+{
+    LC_HashBuild_t    *Build   = &LC_OperData.HashBuild;
+    LC_MsgIndex_t     *Index   = Build->Index;
+    LC_WatchProgram_t *Program = &Index->Program;
+    uint16             GroupFill[LC_WP_GROUP_KEYS];
+    uint32             MessageIndex;
+    uint32             Position;
+    uint32             WatchStart;
+    uint32             WatchEnd;
+    uint32             Key;
+    uint32             Count;
+    uint32             Sum;
+    uint8              Kind;
+
+    for (MessageIndex = 0; MessageIndex < Index->MessageIDsCount; MessageIndex++)
+    {
+        WatchStart = Index->MessageList[MessageIndex].WatchStart;
+        WatchEnd   = WatchStart + Index->MessageList[MessageIndex].WatchCount;
+
+        /*
+        ** Stable counting sort of the span on opcode and extractor,
+        ** so table order is kept for watchpoints in the same group
+        */
+        memset(GroupFill, 0, sizeof(GroupFill));
+
+        for (Position = WatchStart; Position < WatchEnd; Position++)
+        {
+            GroupFill[LC_WP_GROUP_KEY(Program->Opcode[Position], Program->Extract[Position])]++;
+        }
+
+        Sum = WatchStart;
+        for (Key = 0; Key < LC_WP_GROUP_KEYS; Key++)
+        {
+            Count          = GroupFill[Key];
+            GroupFill[Key] = Sum;
+            Sum += Count;
+        }
+
+        for (Position = WatchStart; Position < WatchEnd; Position++)
+        {
+            Key = LC_WP_GROUP_KEY(Program->Opcode[Position], Program->Extract[Position]);
+
+            Build->GroupOrder[GroupFill[Key]++] = Index->WatchPtList[Position];
+        }
+
+        for (Position = WatchStart; Position < WatchEnd; Position++)
+        {
+            Index->WatchPtList[Position] = Build->GroupOrder[Position];
+            LC_CompileWatchpoint(Position);
+        }
+
+        /*
+        ** Working back from the end of the span, count the like
+        ** watchpoints left in each run. Custom and uncompiled
+        ** watchpoints are never batched and keep a length of 1.
+        */
+        Position = WatchEnd;
+        while (Position > (WatchStart + 1))
+        {
+            Position--;
+            Kind = Program->Opcode[Position - 1] & ~LC_WP_OPCODE_OPERMASK;
+
+            if ((Kind >= LC_WP_OPCODE_SIGNED) && (Kind <= LC_WP_OPCODE_FLOAT) &&
+                (Program->Opcode[Position - 1] == Program->Opcode[Position]) &&
+                (Program->Extract[Position - 1] == Program->Extract[Position]))
+            {
+                Program->RunLength[Position - 1] = Program->RunLength[Position] + 1;
+            }
+        }
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Handle a message with possible watchpoints                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
+{
+    LC_CheckIndexedMsgForWPs(MessageID, LC_FindMessageIndex(MessageID), BufPtr);
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Handle a message already looked up in the dispatch index        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CheckIndexedMsgForWPs(CFE_SB_MsgId_t MessageID, const LC_MessageList_t *MessageList,
+                              const CFE_SB_Buffer_t *BufPtr)
+{
+    LC_PacketTime_t PacketTime;
+    uint32          Position;
+    uint32          WatchPtEnd;
+    uint32          RunLength;
+    size_t          MsgLength    = 0;
+    bool            WatchPtFound = false;
+
+    /* Do nothing if disabled at the application level */
+    if (LC_AppData.CurrentLCState != LC_STATE_DISABLED)
+    {
+        /* Only a watchpoint transition or RTS request reads the time */
+        PacketTime.BufPtr   = BufPtr;
+        PacketTime.Resolved = false;
+
+        /* Performance Log (start time counter) */
+        CFE_ES_PerfLogEntry(LC_WDT_SEARCH_PERF_ID);
+
+        /* Should be non-NULL - else wouldn't subscribe to MessageID */
+        if (MessageList != (LC_MessageList_t *)NULL)
+        {
+            WatchPtEnd   = MessageList->WatchStart + MessageList->WatchCount;
+            WatchPtFound = (MessageList->WatchCount > 0);
+
+            /* One length check covers every WP that references MessageID */
+            CFE_MSG_GetSize(&BufPtr->Msg, &MsgLength);
+
+            if (MsgLength < MessageList->MaxExtent)
+            {
+                /* Short packet - check each WP so the ones out of bounds are reported */
+                LC_OperData.MsgDigest[MessageList - LC_OperData.MsgIndex->MessageList].Valid = false;
+
+                for (Position = MessageList->WatchStart; Position < WatchPtEnd; Position++)
+                {
+                    if (LC_WPOffsetValid(LC_OperData.MsgIndex->WatchPtList[Position], BufPtr) == true)
+                    {
+                        LC_ProcessCompiledWP(Position, BufPtr, &PacketTime);
+                    }
+                }
+            }
+            else if (LC_CheckMsgDigest(MessageList, BufPtr) == true)
+            {
+                /* Watched bytes unchanged since the last packet */
+                LC_ReuseWatchResults(MessageList, BufPtr, &PacketTime);
+            }
+            else
+            {
+                /* No limit to how many WP's can reference one MessageID */
+                for (Position = MessageList->WatchStart; Position < WatchPtEnd; Position += RunLength)
+                {
+                    RunLength = LC_OperData.MsgIndex->Program.RunLength[Position];
+
+                    if (RunLength >= LC_WATCH_BATCH_MIN)
+                    {
+                        /* Evaluate a run of like WP's together */
+                        if (RunLength > LC_WP_BATCH_LANES)
+                        {
+                            RunLength = LC_WP_BATCH_LANES;
+                        }
+
+                        LC_ProcessWatchBatch(Position, RunLength, BufPtr, &PacketTime);
+                    }
+                    else
+                    {
+                        RunLength = 1;
+
+                        LC_ProcessCompiledWP(Position, BufPtr, &PacketTime);
+                    }
+                }
+            }
+        }
+
+        /* Performance Log (stop time counter) */
+        CFE_ES_PerfLogExit(LC_WDT_SEARCH_PERF_ID);
+
+        if (WatchPtFound == true)
+        {
+            LC_AppData.MonitoredMsgCount++;
+
+            /* Actionpoints that need not wait for the next sample request */
+            LC_RunImmediateAPs(&PacketTime);
+        }
+        else
+        {
+            /* MessageID with no defined watchpoints */
+            LC_HandleUnreferencedMsg(MessageID);
+        }
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count, report and drop messages no watchpoint references        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_HandleUnreferencedMsg(CFE_SB_MsgId_t MessageID)
+{
+    LC_UnrefMsgs_t *UnrefMsgs = &LC_OperData.UnrefMsgs;
+    LC_UnrefMsg_t  *Entry;
+    uint32         *MsgCount;
+    CFE_Status_t    Result;
+
+    LC_OperData.UnrefMsgCount++;
+
+    Entry = LC_TrackUnrefMsg(MessageID);
+
+    /* MessageIDs that did not fit in the table share one throttle */
+    MsgCount = (Entry != NULL) ? &Entry->MsgCount : &UnrefMsgs->UntrackedCount;
+    (*MsgCount)++;
+
+    if (((*MsgCount - 1) % LC_UNREF_EVENT_INTERVAL) == 0)
+    {
+        CFE_EVS_SendEvent(LC_MID_INF_EID,
+                          CFE_EVS_EventType_INFORMATION,
+                          "Msg with unreferenced message ID rcvd: ID = 0x%08lX, count = %lu",
+                          (unsigned long)CFE_SB_MsgIdToValue(MessageID),
+                          (unsigned long)*MsgCount);
+    }
+
+    /* Only try once, a failure would otherwise repeat at telemetry rate */
+    if ((LC_UNREF_UNSUB_LIMIT > 0) && (Entry != NULL) && (Entry->MsgCount == LC_UNREF_UNSUB_LIMIT))
+    {
+        Result = CFE_SB_Unsubscribe(MessageID, LC_OperData.CmdPipe);
+
+        if (Result == CFE_SUCCESS)
+        {
+            UnrefMsgs->UnsubscribedCount++;
+            Entry->Subscribed = false;
+
+            CFE_EVS_SendEvent(LC_UNREF_UNSUB_INF_EID,
+                              CFE_EVS_EventType_INFORMATION,
+                              "Unsubscribed from unreferenced message ID 0x%08lX after %lu msgs",
+                              (unsigned long)CFE_SB_MsgIdToValue(MessageID),
+                              (unsigned long)Entry->MsgCount);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(LC_UNREF_UNSUB_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "Error unsubscribing unreferenced message ID 0x%08lX, RC=0x%08X",
+                              (unsigned long)CFE_SB_MsgIdToValue(MessageID),
+                              (unsigned int)Result);
+        }
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find or add the unreferenced message entry for a MessageID      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+LC_UnrefMsg_t *LC_TrackUnrefMsg(CFE_SB_MsgId_t MessageID)
+{
+    LC_UnrefMsgs_t *UnrefMsgs = &LC_OperData.UnrefMsgs;
+    LC_UnrefMsg_t  *Entry     = NULL;
+    uint16          i;
+
+    for (i = 0; i < UnrefMsgs->EntryCount; i++)
+    {
+        if (CFE_SB_MsgId_Equal(UnrefMsgs->Entry[i].MessageID, MessageID))
+        {
+            Entry = &UnrefMsgs->Entry[i];
+            break;
+        }
+    }
+
+    if ((Entry == NULL) && (UnrefMsgs->EntryCount < LC_MAX_UNREF_MSGIDS))
+    {
+        Entry            = &UnrefMsgs->Entry[UnrefMsgs->EntryCount++];
+        Entry->MessageID = MessageID;
+    }
+
+    return Entry;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count a watchpoint evaluation error against its event budget    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_CountWPError(uint16 WatchIndex)
+{
+    uint32 ErrorCount;
+
+    ErrorCount = ++LC_OperData.WRTPtr[WatchIndex].ErrorCount;
+
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_WRT;
+
+    /* Report the first few errors, then one per interval */
+    if (ErrorCount <= LC_WP_ERR_EVENT_LIMIT)
+    {
+        return true;
+    }
+
+    return (((ErrorCount - LC_WP_ERR_EVENT_LIMIT) % LC_WP_ERR_EVENT_INTERVAL) == 0);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a packet digest with the last one for its MessageID     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_CheckMsgDigest(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr)
+{
+    LC_MsgDigest_t *MsgDigest;
+    const uint8    *SpanPtr;
+    uint32          SpanSize;
+    uint64          Digest;
+    bool            DigestMatch = false;
+
+    if (MessageList->DigestStart != LC_MSG_DIGEST_OFF)
+    {
+        MsgDigest = &LC_OperData.MsgDigest[MessageList - LC_OperData.MsgIndex->MessageList];
+
+        /* Only the bytes between the first and last watched byte count */
+        SpanPtr  = ((const uint8 *)BufPtr) + MessageList->DigestStart;
+        SpanSize = MessageList->MaxExtent - MessageList->DigestStart;
+        Digest   = LC_DigestRange(SpanPtr, SpanSize);
+
+        /*
+        ** A matching digest is confirmed with the saved bytes so a
+        ** collision is treated as a changed packet
+        */
+        if ((MsgDigest->Valid == true) && (MsgDigest->Digest == Digest) &&
+            (memcmp(MsgDigest->Bytes, SpanPtr, SpanSize) == 0))
+        {
+            LC_OperData.DigestHitCount++;
+            DigestMatch = true;
+        }
+        else
+        {
+            LC_OperData.DigestMissCount++;
+            MsgDigest->Digest = Digest;
+            MsgDigest->Valid  = true;
+            memcpy(MsgDigest->Bytes, SpanPtr, SpanSize);
+        }
+    }
+
+    return DigestMatch;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reuse the results of every watchpoint on an unchanged packet    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ReuseWatchResults(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr,
+                          LC_PacketTime_t *PacketTime)
+{
+    uint32 Position;
+    uint32 WatchPtEnd;
+    uint16 WatchIndex;
+    uint8  WatchResult;
+
+    WatchPtEnd = MessageList->WatchStart + MessageList->WatchCount;
+
+    for (Position = MessageList->WatchStart; Position < WatchPtEnd; Position++)
+    {
+        WatchIndex  = LC_OperData.MsgIndex->WatchPtList[Position];
+        WatchResult = LC_OperData.WRTPtr[WatchIndex].WatchResult;
+
+        if ((WatchResult == LC_WATCH_TRUE) || (WatchResult == LC_WATCH_FALSE))
+        {
+            /* Same data gives the same result, only the statistics advance */
+            LC_UpdateWatchResult(WatchIndex, WatchResult, LC_OperData.WatchCache[WatchIndex].RawValue, PacketTime);
+        }
+        else
+        {
+            /* Stale, reset or in error - evaluate it again */
+            LC_ProcessCompiledWP(Position, BufPtr, PacketTime);
+        }
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Digest a range of packet bytes                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint64 LC_DigestRange(const uint8 *DataPtr, uint32 Length)
+{
+    uint64 Digest;
+    uint64 Word;
+
+    /*
+    ** Each 8 byte word is folded in with a multiply and xor shift,
+    ** both of which are one-to-one, so a change confined to a single
+    ** word always changes the digest. The finalizer is the 64 bit
+    ** one from MurmurHash3.
+    */
+    Digest = LC_DIGEST_SEED ^ Length;
+
+    while (Length >= sizeof(Word))
+    {
+        memcpy(&Word, DataPtr, sizeof(Word));
+        Digest = (Digest ^ Word) * LC_DIGEST_PRIME;
+        Digest ^= Digest >> 32;
+
+        DataPtr += sizeof(Word);
+        Length -= sizeof(Word);
+    }
+
+    if (Length > 0)
+    {
+        Word = 0;
+        memcpy(&Word, DataPtr, Length);
+        Digest = (Digest ^ Word) * LC_DIGEST_PRIME;
+        Digest ^= Digest >> 32;
+    }
+
+    Digest ^= Digest >> 33;
+    Digest *= 0xFF51AFD7ED558CCDULL;
+    Digest ^= Digest >> 33;
+    Digest *= 0xC4CEB9FE1A85EC53ULL;
+    Digest ^= Digest >> 33;
+
+    return Digest;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a single compiled watchpoint                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessCompiledWP(uint32 Position, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime)
+{
+    const LC_WatchProgram_t *Program = &LC_OperData.MsgIndex->Program;
+    uint16                   WatchIndex;
+    uint8                    Opcode;
+    uint8                    Extract;
+    uint8                    WPEvalResult;
+    uint32                   MaskedWPData;
+    uint32                   Value;
+
+    WatchIndex = LC_OperData.MsgIndex->WatchPtList[Position];
+    Opcode     = Program->Opcode[Position];
+
+    if (Opcode == LC_WP_OPCODE_LEGACY)
+    {
+        LC_ProcessWP(WatchIndex, BufPtr, PacketTime);
+        return;
+    }
+
+    Extract = Program->Extract[Position];
+
+    MaskedWPData =
+        LC_ExtractWPData(Extract, ((const uint8 *)BufPtr) + Program->Offset[Position]) & Program->BitMask[Position];
+
+    /* Truncate to the watchpoint size, then sign or zero extend */
+    Value = ((MaskedWPData & LC_WP_EXTRACT_WIDTH[Extract]) ^ LC_WP_EXTRACT_SIGN[Extract]) -
+            LC_WP_EXTRACT_SIGN[Extract];
+
+    if (LC_CheckWatchCache(WatchIndex, MaskedWPData, &WPEvalResult) == true)
+    {
+        /* Unchanged since the last sample, the previous result stands */
+    }
+    else if (Opcode == LC_WP_OPCODE_CUSTOM)
+    {
+        WPEvalResult = LC_CustomFunction(WatchIndex, MaskedWPData, BufPtr,
+                                         LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument);
+    }
+    else if (((Opcode & ~LC_WP_OPCODE_OPERMASK) == LC_WP_OPCODE_FLOAT) &&
+             ((Value & LC_IEEE_EXPONENT_MASK) == LC_IEEE_EXPONENT_MASK) && ((Value & LC_IEEE_FRACTION_MASK) != 0))
+    {
+        /* Let the reference comparison report the NAN */
+        WPEvalResult = LC_OperatorCompare(WatchIndex, MaskedWPData);
+    }
+    else if ((Opcode & LC_WP_OPCODE_OPERMASK) >= LC_OPER_IN_RANGE)
+    {
+        WPEvalResult = LC_CompareCompiledRange(Opcode, Value, Program->Compare[Position],
+                                               Program->SecondCompare[Position],
+                                               LC_OperData.WRTPtr[WatchIndex].WatchResult);
+    }
+    else
+    {
+        WPEvalResult = LC_CompareCompiledValue(Opcode, Value, Program->Compare[Position]);
+    }
+
+    LC_UpdateWatchResult(WatchIndex, WPEvalResult, MaskedWPData, PacketTime);
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a batch of compiled watchpoints                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessWatchBatch(uint32 Position, uint32 Count, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime)
+{
+    const LC_WatchProgram_t *Program = &LC_OperData.MsgIndex->Program;
+    const uint16            *WatchPtList;
+    uint8                    Opcode;
+    uint8                    Extract;
+    uint8                    WPEvalResult;
+    uint32                   Lane;
+    uint32                   LaneBit;
+    uint32                   TrueMask;
+    uint32                   NanMask;
+    uint32                   HoldMask;
+    uint32                   MaskedWPData[LC_WP_BATCH_LANES];
+    uint32                   Values[LC_WP_BATCH_LANES] = { 0 };
+
+    WatchPtList = &LC_OperData.MsgIndex->WatchPtList[Position];
+    Opcode      = Program->Opcode[Position];
+    Extract     = Program->Extract[Position];
+
+    /*
+    ** Gather every watchpoint value in the batch before any
+    ** comparison, so the compares can run on whole vectors
+    */
+    for (Lane = 0; Lane < Count; Lane++)
+    {
+        MaskedWPData[Lane] = LC_ExtractWPData(Extract, ((const uint8 *)BufPtr) + Program->Offset[Position + Lane]) &
+                             Program->BitMask[Position + Lane];
+
+        Values[Lane] = ((MaskedWPData[Lane] & LC_WP_EXTRACT_WIDTH[Extract]) ^ LC_WP_EXTRACT_SIGN[Extract]) -
+                       LC_WP_EXTRACT_SIGN[Extract];
+    }
+
+    if ((Opcode & LC_WP_OPCODE_OPERMASK) >= LC_OPER_IN_RANGE)
+    {
+        /* Hysteresis lanes between thresholds hold their last result */
+        HoldMask = 0;
+        for (Lane = 0; Lane < Count; Lane++)
+        {
+            if (LC_OperData.WRTPtr[WatchPtList[Lane]].WatchResult == LC_WATCH_TRUE)
+            {
+                HoldMask |= (uint32)1 << Lane;
+            }
+        }
+
+        TrueMask = LC_CompareWatchBatchRange(Opcode, Values, &Program->Compare[Position],
+                                             &Program->SecondCompare[Position], HoldMask, Count, &NanMask);
+    }
+    else
+    {
+        TrueMask = LC_CompareWatchBatch(Opcode, Values, &Program->Compare[Position], Count, &NanMask);
+    }
+
+    /* Apply the results in watchpoint list order */
+    for (Lane = 0; Lane < Count; Lane++)
+    {
+        LaneBit = (uint32)1 << Lane;
+
+        if ((NanMask & LaneBit) != 0)
+        {
+            /* Let the reference comparison report the NAN */
+            WPEvalResult = LC_OperatorCompare(WatchPtList[Lane], MaskedWPData[Lane]);
+        }
+        else
+        {
+            WPEvalResult = ((TrueMask & LaneBit) != 0) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+        }
+
+        LC_UpdateWatchResult(WatchPtList[Lane], WPEvalResult, MaskedWPData[Lane], PacketTime);
+    }
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a batch of compiled watchpoint values                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_CompareWatchBatch(uint8 Opcode, const uint32 *Values, const uint32 *Compare, uint32 Count,
+                            uint32 *NanMaskPtr)
+{
+    uint32 TrueMask = 0;
+    uint32 NanMask  = 0;
+    uint32 TailNanMask;
+    uint32 Lane = 0;
+    uint8  Kind = Opcode & ~LC_WP_OPCODE_OPERMASK;
+    uint8  Oper = Opcode & LC_WP_OPCODE_OPERMASK;
+
+#if defined(LC_WATCH_SIMD_SSE2)
+    const __m128i SignFlip  = _mm_set1_epi32((int32)0x80000000);
+    const __m128  AbsMask   = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128  Tolerance = _mm_set1_ps((float)LC_FLOAT_TOLERANCE);
+    __m128i       VecValue;
+    __m128i       VecCompare;
+    __m128i       VecResult;
+    __m128        FltValue;
+    __m128        FltCompare;
+    __m128        FltResult;
+    uint32        LaneBits;
+
+    for (Lane = 0; (Lane + 4) <= Count; Lane += 4)
+    {
+        /* memcpy avoids casting the uint32 arrays to a more aligned type */
+        memcpy(&VecValue, &Values[Lane], sizeof(VecValue));
+        memcpy(&VecCompare, &Compare[Lane], sizeof(VecCompare));
+
+        if (Kind == LC_WP_OPCODE_FLOAT)
+        {
+            FltValue   = _mm_castsi128_ps(VecValue);
+            FltCompare = _mm_castsi128_ps(VecCompare);
+
+            switch (Oper)
+            {
+                case LC_OPER_LT:
+                    FltResult = _mm_cmplt_ps(FltValue, FltCompare);
+                    break;
+
+                case LC_OPER_LE:
+                    FltResult = _mm_cmple_ps(FltValue, FltCompare);
+                    break;
+
+                case LC_OPER_NE:
+                    /* |a - b| is the same value the scalar code computes */
+                    FltResult = _mm_cmpgt_ps(_mm_and_ps(_mm_sub_ps(FltValue, FltCompare), AbsMask), Tolerance);
+                    break;
+
+                case LC_OPER_EQ:
+                    FltResult = _mm_cmple_ps(_mm_and_ps(_mm_sub_ps(FltValue, FltCompare), AbsMask), Tolerance);
+                    break;
+
+                case LC_OPER_GE:
+                    FltResult = _mm_cmpge_ps(FltValue, FltCompare);
+                    break;
+
+                case LC_OPER_GT:
+                default:
+                    FltResult = _mm_cmpgt_ps(FltValue, FltCompare);
+                    break;
+            }
+
+            LaneBits = (uint32)_mm_movemask_ps(FltResult);
+            NanMask |= (uint32)_mm_movemask_ps(_mm_cmpunord_ps(FltValue, FltValue)) << Lane;
+        }
+        else
+        {
+            /* SSE2 only has signed compares, so bias unsigned values */
+            if (Kind == LC_WP_OPCODE_UNSIGNED)
+            {
+                VecValue   = _mm_xor_si128(VecValue, SignFlip);
+                VecCompare = _mm_xor_si128(VecCompare, SignFlip);
+            }
+
+            switch (Oper)
+            {
+                case LC_OPER_LT:
+                case LC_OPER_GE:
+                    VecResult = _mm_cmplt_epi32(VecValue, VecCompare);
+                    break;
+
+                case LC_OPER_NE:
+                case LC_OPER_EQ:
+                    VecResult = _mm_cmpeq_epi32(VecValue, VecCompare);
+                    break;
+
+                case LC_OPER_LE:
+                case LC_OPER_GT:
+                default:
+                    VecResult = _mm_cmpgt_epi32(VecValue, VecCompare);
+                    break;
+            }
+
+            LaneBits = (uint32)_mm_movemask_ps(_mm_castsi128_ps(VecResult));
+
+            /* GE, NE and LE are the complements of LT, EQ and GT */
+            if ((Oper == LC_OPER_GE) || (Oper == LC_OPER_NE) || (Oper == LC_OPER_LE))
+            {
+                LaneBits ^= 0xF;
+            }
+        }
+
+        TrueMask |= LaneBits << Lane;
+    }
+#elif defined(LC_WATCH_SIMD_NEON)
+    static const uint32 LC_NEON_LANE_BITS[4] = { 1, 2, 4, 8 };
+    const uint32x4_t    LaneSelect           = vld1q_u32(LC_NEON_LANE_BITS);
+    const float32x4_t   Tolerance            = vdupq_n_f32((float)LC_FLOAT_TOLERANCE);
+    uint32x4_t          VecValue;
+    uint32x4_t          VecCompare;
+    uint32x4_t          VecResult;
+    float32x4_t         FltValue;
+    float32x4_t         FltCompare;
+    int32x4_t           IntValue;
+    int32x4_t           IntCompare;
+
+    for (Lane = 0; (Lane + 4) <= Count; Lane += 4)
+    {
+        VecValue   = vld1q_u32(&Values[Lane]);
+        VecCompare = vld1q_u32(&Compare[Lane]);
+
+        if (Kind == LC_WP_OPCODE_FLOAT)
+        {
+            FltValue   = vreinterpretq_f32_u32(VecValue);
+            FltCompare = vreinterpretq_f32_u32(VecCompare);
+
+            switch (Oper)
+            {
+                case LC_OPER_LT:
+                    VecResult = vcltq_f32(FltValue, FltCompare);
+                    break;
+
+                case LC_OPER_LE:
+                    VecResult = vcleq_f32(FltValue, FltCompare);
+                    break;
+
+                case LC_OPER_NE:
+                    /* |a - b| is the same value the scalar code computes */
+                    VecResult = vcgtq_f32(vabdq_f32(FltValue, FltCompare), Tolerance);
+                    break;
+
+                case LC_OPER_EQ:
+                    VecResult = vcleq_f32(vabdq_f32(FltValue, FltCompare), Tolerance);
+                    break;
+
+                case LC_OPER_GE:
+                    VecResult = vcgeq_f32(FltValue, FltCompare);
+                    break;
+
+                case LC_OPER_GT:
+                default:
+                    VecResult = vcgtq_f32(FltValue, FltCompare);
+                    break;
+            }
+
+            NanMask |= vaddvq_u32(vandq_u32(vmvnq_u32(vceqq_f32(FltValue, FltValue)), LaneSelect)) << Lane;
+        }
+        else if (Kind == LC_WP_OPCODE_SIGNED)
+        {
+            IntValue   = vreinterpretq_s32_u32(VecValue);
+            IntCompare = vreinterpretq_s32_u32(VecCompare);
+
+            switch (Oper)
+            {
+                case LC_OPER_LT:
+                    VecResult = vcltq_s32(IntValue, IntCompare);
+                    break;
+
+                case LC_OPER_LE:
+                    VecResult = vcleq_s32(IntValue, IntCompare);
+                    break;
+
+                case LC_OPER_NE:
+                    VecResult = vmvnq_u32(vceqq_s32(IntValue, IntCompare));
+                    break;
+
+                case LC_OPER_EQ:
+                    VecResult = vceqq_s32(IntValue, IntCompare);
+                    break;
+
+                case LC_OPER_GE:
+                    VecResult = vcgeq_s32(IntValue, IntCompare);
+                    break;
+
+                case LC_OPER_GT:
+                default:
+                    VecResult = vcgtq_s32(IntValue, IntCompare);
+                    break;
+            }
+        }
+        else
+        {
+            switch (Oper)
+            {
+                case LC_OPER_LT:
+                    VecResult = vcltq_u32(VecValue, VecCompare);
+                    break;
+
+                case LC_OPER_LE:
+                    VecResult = vcleq_u32(VecValue, VecCompare);
+                    break;
+
+                case LC_OPER_NE:
+                    VecResult = vmvnq_u32(vceqq_u32(VecValue, VecCompare));
+                    break;
+
+                case LC_OPER_EQ:
+                    VecResult = vceqq_u32(VecValue, VecCompare);
+                    break;
+
+                case LC_OPER_GE:
+                    VecResult = vcgeq_u32(VecValue, VecCompare);
+                    break;
+
+                case LC_OPER_GT:
+                default:
+                    VecResult = vcgtq_u32(VecValue, VecCompare);
+                    break;
+            }
+        }
+
+        TrueMask |= vaddvq_u32(vandq_u32(VecResult, LaneSelect)) << Lane;
+    }
+#else
+    (void)Kind;
+    (void)Oper;
+#endif
+
+    /* Lanes that do not fill a vector */
+    if (Lane < Count)
+    {
+        TrueMask |= LC_CompareWatchBatchScalar(Opcode, &Values[Lane], &Compare[Lane], Count - Lane, &TailNanMask)
+                    << Lane;
+        NanMask |= TailNanMask << Lane;
+    }
+
+    *NanMaskPtr = NanMask;
+
+    return TrueMask;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a batch of compiled watchpoint values one at a time     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_CompareWatchBatchScalar(uint8 Opcode, const uint32 *Values, const uint32 *Compare, uint32 Count,
+                                  uint32 *NanMaskPtr)
+{
+    uint32 TrueMask = 0;
+    uint32 NanMask  = 0;
+    uint32 Lane;
+    bool   IsFloat;
+
+    IsFloat = ((Opcode & ~LC_WP_OPCODE_OPERMASK) == LC_WP_OPCODE_FLOAT);
+
+    for (Lane = 0; Lane < Count; Lane++)
+    {
+        if (IsFloat && ((Values[Lane] & LC_IEEE_EXPONENT_MASK) == LC_IEEE_EXPONENT_MASK) &&
+            ((Values[Lane] & LC_IEEE_FRACTION_MASK) != 0))
+        {
+            NanMask |= (uint32)1 << Lane;
+        }
+        else if (LC_CompareCompiledValue(Opcode, Values[Lane], Compare[Lane]) == LC_WATCH_TRUE)
+        {
+            TrueMask |= (uint32)1 << Lane;
+        }
+    }
+
+    *NanMaskPtr = NanMask;
+
+    return TrueMask;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare one compiled watchpoint value                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_CompareCompiledValue(uint8 Opcode, uint32 Value, uint32 CompareValue)
+{
+    uint8 WPEvalResult;
+    float WPFloat;
+    float CompareFloat;
+    float Diff;
+
+    switch (Opcode)
+    {
+        case LC_WP_OPCODE_SIGNED | LC_OPER_LT:
+            WPEvalResult = ((int32)Value < (int32)CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_SIGNED | LC_OPER_LE:
+            WPEvalResult = ((int32)Value <= (int32)CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_SIGNED | LC_OPER_NE:
+        case LC_WP_OPCODE_UNSIGNED | LC_OPER_NE:
+            WPEvalResult = (Value != CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_SIGNED | LC_OPER_EQ:
+        case LC_WP_OPCODE_UNSIGNED | LC_OPER_EQ:
+            WPEvalResult = (Value == CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_SIGNED | LC_OPER_GE:
+            WPEvalResult = ((int32)Value >= (int32)CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_SIGNED | LC_OPER_GT:
+            WPEvalResult = ((int32)Value > (int32)CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_UNSIGNED | LC_OPER_LT:
+            WPEvalResult = (Value < CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_UNSIGNED | LC_OPER_LE:
+            WPEvalResult = (Value <= CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_UNSIGNED | LC_OPER_GE:
+            WPEvalResult = (Value >= CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        case LC_WP_OPCODE_UNSIGNED | LC_OPER_GT:
+            WPEvalResult = (Value > CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            break;
+
+        default:
+            memcpy(&WPFloat, &Value, sizeof(float));
+            memcpy(&CompareFloat, &CompareValue, sizeof(float));
+
+            switch (Opcode & LC_WP_OPCODE_OPERMASK)
+            {
+                case LC_OPER_LT:
+                    WPEvalResult = (WPFloat < CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                    break;
+
+                case LC_OPER_LE:
+                    WPEvalResult = (WPFloat <= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                    break;
+
+                case LC_OPER_NE:
+                    Diff         = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat) : (CompareFloat - WPFloat);
+                    WPEvalResult = (Diff > (float)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                    break;
+
+                case LC_OPER_EQ:
+                    Diff         = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat) : (CompareFloat - WPFloat);
+                    WPEvalResult = (Diff <= (float)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                    break;
+
+                case LC_OPER_GE:
+                    WPEvalResult = (WPFloat >= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                    break;
+
+                case LC_OPER_GT:
+                default:
+                    WPEvalResult = (WPFloat > CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                    break;
+            }
+            break;
+    }
+
+    return WPEvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a batch of compiled values against two thresholds       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_CompareWatchBatchRange(uint8 Opcode, const uint32 *Values, const uint32 *Low, const uint32 *High,
+                                 uint32 HoldMask, uint32 Count, uint32 *NanMaskPtr)
+{
+    uint32 TrueMask;
+    uint32 LowMask;
+    uint32 HighMask;
+    uint8  Kind = Opcode & ~LC_WP_OPCODE_OPERMASK;
+
+    /*
+    ** Each range operator is two relational compares on the
+    ** same values, so both run as full batches and only the
+    ** masks are combined here. NAN lanes are the same in both.
+    */
+    switch (Opcode & LC_WP_OPCODE_OPERMASK)
+    {
+        case LC_OPER_IN_RANGE:
+            LowMask  = LC_CompareWatchBatch(Kind | LC_OPER_GE, Values, Low, Count, NanMaskPtr);
+            HighMask = LC_CompareWatchBatch(Kind | LC_OPER_LE, Values, High, Count, NanMaskPtr);
+            TrueMask = LowMask & HighMask;
+            break;
+
+        case LC_OPER_OUT_OF_RANGE:
+            LowMask  = LC_CompareWatchBatch(Kind | LC_OPER_LT, Values, Low, Count, NanMaskPtr);
+            HighMask = LC_CompareWatchBatch(Kind | LC_OPER_GT, Values, High, Count, NanMaskPtr);
+            TrueMask = LowMask | HighMask;
+            break;
+
+        case LC_OPER_HYSTERESIS:
+            LowMask  = LC_CompareWatchBatch(Kind | LC_OPER_GE, Values, Low, Count, NanMaskPtr);
+            HighMask = LC_CompareWatchBatch(Kind | LC_OPER_LE, Values, High, Count, NanMaskPtr);
+            TrueMask = LowMask | (HoldMask & ~HighMask);
+            break;
+
+        case LC_WP_OPER_HYSTERESIS_LOW:
+        default:
+            LowMask  = LC_CompareWatchBatch(Kind | LC_OPER_LE, Values, Low, Count, NanMaskPtr);
+            HighMask = LC_CompareWatchBatch(Kind | LC_OPER_GE, Values, High, Count, NanMaskPtr);
+            TrueMask = LowMask | (HoldMask & ~HighMask);
+            break;
+    }
+
+    return TrueMask;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare one compiled value against two thresholds               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_CompareCompiledRange(uint8 Opcode, uint32 Value, uint32 Low, uint32 High, uint8 PreviousResult)
+{
+    uint8 WPEvalResult;
+    uint8 Kind = Opcode & ~LC_WP_OPCODE_OPERMASK;
+    bool  SetHit;
+    bool  ClearHit;
+
+    switch (Opcode & LC_WP_OPCODE_OPERMASK)
+    {
+        case LC_OPER_IN_RANGE:
+            WPEvalResult = ((LC_CompareCompiledValue(Kind | LC_OPER_GE, Value, Low) == LC_WATCH_TRUE) &&
+                            (LC_CompareCompiledValue(Kind | LC_OPER_LE, Value, High) == LC_WATCH_TRUE))
+                               ? LC_WATCH_TRUE
+                               : LC_WATCH_FALSE;
+            break;
+
+        case LC_OPER_OUT_OF_RANGE:
+            WPEvalResult = ((LC_CompareCompiledValue(Kind | LC_OPER_LT, Value, Low) == LC_WATCH_TRUE) ||
+                            (LC_CompareCompiledValue(Kind | LC_OPER_GT, Value, High) == LC_WATCH_TRUE))
+                               ? LC_WATCH_TRUE
+                               : LC_WATCH_FALSE;
+            break;
+
+        case LC_OPER_HYSTERESIS:
+        case LC_WP_OPER_HYSTERESIS_LOW:
+        default:
+            if ((Opcode & LC_WP_OPCODE_OPERMASK) == LC_OPER_HYSTERESIS)
+            {
+                SetHit   = (LC_CompareCompiledValue(Kind | LC_OPER_GE, Value, Low) == LC_WATCH_TRUE);
+                ClearHit = (LC_CompareCompiledValue(Kind | LC_OPER_LE, Value, High) == LC_WATCH_TRUE);
+            }
+            else
+            {
+                SetHit   = (LC_CompareCompiledValue(Kind | LC_OPER_LE, Value, Low) == LC_WATCH_TRUE);
+                ClearHit = (LC_CompareCompiledValue(Kind | LC_OPER_GE, Value, High) == LC_WATCH_TRUE);
+            }
+
+            /* Between the thresholds the last result is held */
+            if (SetHit)
+            {
+                WPEvalResult = LC_WATCH_TRUE;
+            }
+            else if (ClearHit || (PreviousResult != LC_WATCH_TRUE))
+            {
+                WPEvalResult = LC_WATCH_FALSE;
+            }
+            else
+            {
+                WPEvalResult = LC_WATCH_TRUE;
+            }
+            break;
+    }
+
+    return WPEvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Extract watchpoint data with a compiled extractor               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_ExtractWPData(uint8 Extract, const uint8 *WPDataPtr)
+{
+    uint32 SizedData;
+
+    switch (Extract)
+    {
+        case LC_WP_EXTRACT_U8:
+            SizedData = WPDataPtr[0];
+            break;
+
+        case LC_WP_EXTRACT_S8:
+            SizedData = (uint32)((int32)((int8)WPDataPtr[0]));
+            break;
+
+        case LC_WP_EXTRACT_U16_BE:
+            SizedData = LC_LoadBE16(WPDataPtr);
+            break;
+
+        case LC_WP_EXTRACT_U16_LE:
+            SizedData = LC_LoadLE16(WPDataPtr);
+            break;
+
+        case LC_WP_EXTRACT_S16_BE:
+            SizedData = (uint32)((int32)((int16)LC_LoadBE16(WPDataPtr)));
+            break;
+
+        case LC_WP_EXTRACT_S16_LE:
+            SizedData = (uint32)((int32)((int16)LC_LoadLE16(WPDataPtr)));
+            break;
+
+        case LC_WP_EXTRACT_U32_LE:
+            SizedData = LC_LoadLE32(WPDataPtr);
+            break;
+
+        case LC_WP_EXTRACT_U32_BE:
+        default:
+            SizedData = LC_LoadBE32(WPDataPtr);
+            break;
+    }
+
+    return SizedData;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load packet data of a fixed byte order                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 LC_LoadBE16(const uint8 *DataPtr)
+{
+#if defined(LC_HOST_LITTLE_ENDIAN) || defined(LC_HOST_BIG_ENDIAN)
+    uint16 Data;
+
+    memcpy(&Data, DataPtr, sizeof(Data));
+
+#ifdef LC_HOST_LITTLE_ENDIAN
+    Data = __builtin_bswap16(Data);
+#endif
+
+    return Data;
+#else
+    return (uint16)(((uint16)DataPtr[0] << 8) | DataPtr[1]);
+#endif
+}
+
+uint16 LC_LoadLE16(const uint8 *DataPtr)
+{
+#if defined(LC_HOST_LITTLE_ENDIAN) || defined(LC_HOST_BIG_ENDIAN)
+    uint16 Data;
+
+    memcpy(&Data, DataPtr, sizeof(Data));
+
+#ifdef LC_HOST_BIG_ENDIAN
+    Data = __builtin_bswap16(Data);
+#endif
+
+    return Data;
+#else
+    return (uint16)(((uint16)DataPtr[1] << 8) | DataPtr[0]);
+#endif
+}
+
+uint32 LC_LoadBE32(const uint8 *DataPtr)
+{
+#if defined(LC_HOST_LITTLE_ENDIAN) || defined(LC_HOST_BIG_ENDIAN)
+    uint32 Data;
+
+    memcpy(&Data, DataPtr, sizeof(Data));
+
+#ifdef LC_HOST_LITTLE_ENDIAN
+    Data = __builtin_bswap32(Data);
+#endif
+
+    return Data;
+#else
+    return ((uint32)DataPtr[0] << 24) | ((uint32)DataPtr[1] << 16) | ((uint32)DataPtr[2] << 8) | DataPtr[3];
+#endif
+}
+
+uint32 LC_LoadLE32(const uint8 *DataPtr)
+{
+#if defined(LC_HOST_LITTLE_ENDIAN) || defined(LC_HOST_BIG_ENDIAN)
+    uint32 Data;
+
+    memcpy(&Data, DataPtr, sizeof(Data));
+
+#ifdef LC_HOST_BIG_ENDIAN
+    Data = __builtin_bswap32(Data);
+#endif
+
+    return Data;
+#else
+    return ((uint32)DataPtr[3] << 24) | ((uint32)DataPtr[2] << 16) | ((uint32)DataPtr[1] << 8) | DataPtr[0];
+#endif
+}
+
+uint64 LC_LoadBE64(const uint8 *DataPtr)
+{
+#if defined(LC_HOST_LITTLE_ENDIAN) || defined(LC_HOST_BIG_ENDIAN)
+    uint64 Data;
+
+    memcpy(&Data, DataPtr, sizeof(Data));
+
+#ifdef LC_HOST_LITTLE_ENDIAN
+    Data = __builtin_bswap64(Data);
+#endif
+
+    return Data;
+#else
+    return ((uint64)LC_LoadBE32(DataPtr) << 32) | LC_LoadBE32(DataPtr + 4);
+#endif
+}
+
+uint64 LC_LoadLE64(const uint8 *DataPtr)
+{
+#if defined(LC_HOST_LITTLE_ENDIAN) || defined(LC_HOST_BIG_ENDIAN)
+    uint64 Data;
+
+    memcpy(&Data, DataPtr, sizeof(Data));
+
+#ifdef LC_HOST_BIG_ENDIAN
+    Data = __builtin_bswap64(Data);
+#endif
+
+    return Data;
+#else
+    return ((uint64)LC_LoadLE32(DataPtr + 4) << 32) | LC_LoadLE32(DataPtr);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a single watchpoint                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime)
+{
+    uint8 *WPDataPtr;
+    uint8  WPEvalResult;
+    uint64 SizedWPData;
+    uint64 MaskedWPData;
+    bool   SizedDataValid;
+
+    /*
+    ** Setup the pointer and get the massaged data
+    */
+    WPDataPtr = ((uint8 *)BufPtr) + LC_OperData.WDTPtr[WatchIndex].WatchpointOffset;
+
+    SizedDataValid = LC_GetSizedWPData(WatchIndex, WPDataPtr, &SizedWPData);
+    if (SizedDataValid == true)
+    {
+        /*
+        ** Apply the defined bitmask for this watchpoint and then
+        ** call the mission defined custom function or do our own
+        ** relational comparison.
+        **
+        ** The bitmask is 32 bits wide and applies to the lower
+        ** half of 64 bit data, the upper half passes through as is.
+        ** The custom function only ever sees the lower 32 bits.
+        */
+        MaskedWPData = SizedWPData & (LC_WP_UPPER_HALF | LC_OperData.WDTPtr[WatchIndex].BitMask);
+
+        if (LC_CheckWatchCache(WatchIndex, MaskedWPData, &WPEvalResult) == true)
+        {
+            /* Unchanged since the last sample, the previous result stands */
+        }
+        else if (LC_OperData.WDTPtr[WatchIndex].OperatorID == LC_OPER_CUSTOM)
+        {
+            WPEvalResult = LC_CustomFunction(WatchIndex, (uint32)MaskedWPData, BufPtr,
+                                             LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument);
+        }
+        else
+        {
+            WPEvalResult = LC_OperatorCompare(WatchIndex, MaskedWPData);
+        }
+
+        /*
+        ** Update the watch result and statistics
+        */
+        LC_UpdateWatchResult(WatchIndex, WPEvalResult, MaskedWPData, PacketTime);
+
+    } /* end SizedDataValid if */
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update watchpoint results and statistics                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_UpdateWatchResult(uint16 WatchIndex, uint8 WPEvalResult, uint64 MaskedWPData, LC_PacketTime_t *PacketTime)
+{
+    LC_WatchCache_t   *Cache = &LC_OperData.WatchCache[WatchIndex];
+    CFE_TIME_SysTime_t Timestamp;
+    uint8              PreviousResult;
+
+    /*
+    ** Every evaluation updates the statistics saved to the CDS
+    */
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_WRT;
+
+    /*
+    ** Get the last evaluation result for this watchpoint
+    */
+    PreviousResult = LC_OperData.WRTPtr[WatchIndex].WatchResult;
+
+    /*
+    ** Update the watch result
+    */
+    LC_OperData.WRTPtr[WatchIndex].WatchResult = WPEvalResult;
+
+    if (WPEvalResult != PreviousResult)
+    {
+        LC_WatchResultChanged(WatchIndex);
+        LC_QueueImmediateAPs(WatchIndex);
+    }
+
+    /*
+    ** Update the watchpoint statistics based on the evaluation
+    ** result
+    */
+    LC_OperData.WRTPtr[WatchIndex].EvaluationCount++;
+
+    if (WPEvalResult == LC_WATCH_TRUE)
+    {
+        LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount++;
+        LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount++;
+        LC_ArmStaleTimer(WatchIndex, LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale);
+
+        if ((PreviousResult == LC_WATCH_FALSE) || (PreviousResult == LC_WATCH_STALE))
+        {
+            Timestamp = LC_GetPacketTime(PacketTime);
+
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.DataType = LC_OperData.WDTPtr[WatchIndex].DataType;
+
+            LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount++;
+
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value      = (uint32)MaskedWPData;
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.ValueUpper = (uint32)(MaskedWPData >> 32);
+
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds = Timestamp.Seconds;
+
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds = Timestamp.Subseconds;
+        }
+    }
+    else if (WPEvalResult == LC_WATCH_FALSE)
+    {
+        LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount = 0;
+        LC_ArmStaleTimer(WatchIndex, LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale);
+
+        if ((PreviousResult == LC_WATCH_TRUE) || (PreviousResult == LC_WATCH_STALE))
+        {
+            Timestamp = LC_GetPacketTime(PacketTime);
+
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.DataType = LC_OperData.WDTPtr[WatchIndex].DataType;
+
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value      = (uint32)MaskedWPData;
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.ValueUpper = (uint32)(MaskedWPData >> 32);
+
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds = Timestamp.Seconds;
+
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds = Timestamp.Subseconds;
+        }
+    }
+    else
+    {
+        /*
+        ** WPEvalResult is STALE or ERROR
+        */
+        LC_DisarmStaleTimer(WatchIndex);
+    }
+
+    /*
+    ** Remember the sample for digest matches and change-only reuse,
+    ** an error is never reused so it is reported again next sample
+    */
+    Cache->RawValue = MaskedWPData;
+    Cache->Result   = WPEvalResult;
+    Cache->Valid    = (LC_WatchChangeOnly(WatchIndex) == true) &&
+                      ((WPEvalResult == LC_WATCH_TRUE) || (WPEvalResult == LC_WATCH_FALSE));
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the time stamp of the packet being processed                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_TIME_SysTime_t LC_GetPacketTime(LC_PacketTime_t *PacketTime)
+{
+    if (PacketTime->Resolved == false)
+    {
+        /* Use message timestamp - if none, use current time */
+        PacketTime->Timestamp.Seconds    = 0;
+        PacketTime->Timestamp.Subseconds = 0;
+
+        CFE_MSG_GetMsgTime(&PacketTime->BufPtr->Msg, &PacketTime->Timestamp);
+
+        if ((PacketTime->Timestamp.Seconds == 0) && (PacketTime->Timestamp.Subseconds == 0))
+        {
+            PacketTime->Timestamp = CFE_TIME_GetTime();
+        }
+
+        PacketTime->Resolved = true;
+    }
+
+    return PacketTime->Timestamp;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check if a watchpoint is evaluated only on change               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_WatchChangeOnly(uint16 WatchIndex)
+{
+    return ((LC_WATCH_CHANGE_ONLY == true) ||
+            ((LC_OperData.WDTPtr[WatchIndex].WatchOptions & LC_WATCH_OPT_CHANGE_ONLY) != 0));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reuse the previous result of an unchanged watchpoint            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_CheckWatchCache(uint16 WatchIndex, uint64 MaskedWPData, uint8 *WPEvalResultPtr)
+{
+    const LC_WatchCache_t *Cache    = &LC_OperData.WatchCache[WatchIndex];
+    bool                   CacheHit = false;
+
+    if ((Cache->Valid == true) && (Cache->RawValue == MaskedWPData) &&
+        (Cache->Result == LC_OperData.WRTPtr[WatchIndex].WatchResult))
+    {
+        *WPEvalResultPtr = Cache->Result;
+        LC_OperData.SkippedEvalCount++;
+        CacheHit = true;
+    }
+
+    return CacheHit;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start the countdown to stale of a watchpoint result             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ArmStaleTimer(uint16 WatchIndex, uint32 Countdown)
+{
+    LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+    uint32           Deadline;
+    uint32           Slot;
+    bool             Linked;
+
+    if (Countdown == 0)
+    {
+        LC_DisarmStaleTimer(WatchIndex);
+    }
+    else
+    {
+        Deadline = Wheel->AgeTick + Countdown;
+        Slot     = Deadline & LC_STALE_WHEEL_MASK;
+        Linked   = (Wheel->Armed[LC_BIT_WORD(WatchIndex)] & LC_BIT_MASK(WatchIndex)) != 0;
+
+        /*
+        ** A watchpoint sampled at a steady rate usually lands back in
+        ** the slot it is already linked into
+        */
+        if ((Linked == true) && ((Wheel->Deadline[WatchIndex] & LC_STALE_WHEEL_MASK) != Slot))
+        {
+            LC_DisarmStaleTimer(WatchIndex);
+            Linked = false;
+        }
+
+        if (Linked == false)
+        {
+            Wheel->Next[WatchIndex] = Wheel->Head[Slot];
+            Wheel->Prev[WatchIndex] = 0;
+
+            if (Wheel->Head[Slot] != 0)
+            {
+                Wheel->Prev[Wheel->Head[Slot] - 1] = WatchIndex + 1;
+            }
+
+            Wheel->Head[Slot] = WatchIndex + 1;
+            Wheel->Armed[LC_BIT_WORD(WatchIndex)] |= LC_BIT_MASK(WatchIndex);
+        }
+
+        Wheel->Deadline[WatchIndex]                     = Deadline;
+        LC_OperData.WRTPtr[WatchIndex].CountdownToStale = Countdown;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop the countdown to stale of a watchpoint result              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_DisarmStaleTimer(uint16 WatchIndex)
+{
+    LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+    uint16           Next;
+    uint16           Prev;
+
+    if ((Wheel->Armed[LC_BIT_WORD(WatchIndex)] & LC_BIT_MASK(WatchIndex)) != 0)
+    {
+        Next = Wheel->Next[WatchIndex];
+        Prev = Wheel->Prev[WatchIndex];
+
+        if (Prev == 0)
+        {
+            Wheel->Head[Wheel->Deadline[WatchIndex] & LC_STALE_WHEEL_MASK] = Next;
+        }
+        else
+        {
+            Wheel->Next[Prev - 1] = Next;
+        }
+
+        if (Next != 0)
+        {
+            Wheel->Prev[Next - 1] = Prev;
+        }
+
+        Wheel->Armed[LC_BIT_WORD(WatchIndex)] &= ~LC_BIT_MASK(WatchIndex);
+    }
+
+    LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Age watchpoint results by one sample request                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_AgeWatchResults(void)
+{
+    LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+    uint16           WatchIndex;
+    uint16           Link;
+
+    Wheel->AgeTick++;
+
+    Link = Wheel->Head[Wheel->AgeTick & LC_STALE_WHEEL_MASK];
+
+    while (Link != 0)
+    {
+        WatchIndex = Link - 1;
+        Link       = Wheel->Next[WatchIndex];
+
+        /*
+        ** Countdowns longer than the wheel share the slot with
+        ** watchpoints that go stale on a later lap
+        */
+        if (Wheel->Deadline[WatchIndex] == Wheel->AgeTick)
+        {
+            LC_DisarmStaleTimer(WatchIndex);
+
+            LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_STALE;
+            LC_WatchResultChanged(WatchIndex);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the remaining countdowns to the watchpoint results table  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SyncStaleCountdowns(void)
+{
+    const LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+    uint32                 WordIndex;
+    uint32                 Armed;
+    uint32                 Countdown;
+    uint16                 WatchIndex;
+
+    /*
+    ** Words with no running countdown are skipped whole
+    */
+    for (WordIndex = 0; WordIndex < LC_WATCH_PLANE_WORDS; WordIndex++)
+    {
+        Armed = Wheel->Armed[WordIndex];
 
-                LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds = Timestamp.Seconds;
+        for (WatchIndex = WordIndex * 32; Armed != 0; WatchIndex++, Armed >>= 1)
+        {
+            if ((Armed & 1) != 0)
+            {
+                Countdown = Wheel->Deadline[WatchIndex] - Wheel->AgeTick;
 
-                LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds = Timestamp.Subseconds;
+                if (LC_OperData.WRTPtr[WatchIndex].CountdownToStale != Countdown)
+                {
+                    LC_OperData.WRTPtr[WatchIndex].CountdownToStale = Countdown;
+                    LC_OperData.CDSDirty |= LC_CDS_DIRTY_WRT;
+                }
             }
         }
-        else
-        {
-            /*
-            ** WPEvalResult is STALE or ERROR
-            */
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
-        }
+    }
+}
 
-    } /* end SizedDataValid if */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rebuild the stale wheel from the watchpoint results table       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_BuildStaleWheel(void)
+{
+    uint16 WatchIndex;
 
-    return;
+    memset(&LC_OperData.StaleWheel, 0, sizeof(LC_OperData.StaleWheel));
+
+    for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++)
+    {
+        LC_ArmStaleTimer(WatchIndex, LC_OperData.WRTPtr[WatchIndex].CountdownToStale);
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -461,15 +2489,17 @@ void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_Sys
 /* Perform a watchpoint relational comparison                      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData)
+uint8 LC_OperatorCompare(uint16 WatchIndex, uint64 ProcessedWPData)
 {
     uint8          EvalResult;
     LC_MultiType_t WatchpointValue;
     LC_MultiType_t ComparisonValue;
+    LC_MultiType_t SecondComparisonValue;
+    uint8          OperatorID;
 
     /*
      * The "ProcessedWPData" has been already normalized to be
-     * 32 bits wide and in the native CPU byte order.  For actual
+     * 64 bits wide and in the native CPU byte order.  For actual
      * comparison, it needs to be truncated back down to the same
      * size as the reference value.
      */
@@ -494,75 +2524,115 @@ uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData)
         case LC_DATA_WATCH_FLOAT_BE:
         case LC_DATA_WATCH_FLOAT_LE:
         default:
-            WatchpointValue.Unsigned32 = ProcessedWPData;
+            WatchpointValue.Unsigned32 = (uint32)ProcessedWPData;
+            break;
+
+        case LC_DATA_WATCH_QWORD_BE:
+        case LC_DATA_WATCH_QWORD_LE:
+        case LC_DATA_WATCH_UQWORD_BE:
+        case LC_DATA_WATCH_UQWORD_LE:
+        case LC_DATA_WATCH_DOUBLE_BE:
+        case LC_DATA_WATCH_DOUBLE_LE:
+            WatchpointValue.Unsigned64 = ProcessedWPData;
             break;
     }
     /* SAD: Using memcpy to safely copy the float value from LC_MultiType_t to ComparisonValue, preserving bitwise
      * representation */
     memcpy(&ComparisonValue, &LC_OperData.WDTPtr[WatchIndex].ComparisonValue, sizeof(LC_MultiType_t));
 
-    /*
-    ** Handle the comparison appropriately depending on the data type
-    ** Any endian difference was handled when the watchpoint
-    ** data was extracted from the SB message
-    */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType)
+    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+
+    if ((OperatorID >= LC_OPER_IN_RANGE) && (OperatorID <= LC_OPER_HYSTERESIS) &&
+        (LC_GetWPDataSize(LC_OperData.WDTPtr[WatchIndex].DataType) != 0))
+    {
+        memcpy(&SecondComparisonValue, &LC_OperData.WDTPtr[WatchIndex].SecondComparisonValue,
+               sizeof(LC_MultiType_t));
+
+        EvalResult = LC_RangeCompare(WatchIndex, &WatchpointValue, &ComparisonValue, &SecondComparisonValue);
+    }
+    else
     {
         /*
-        ** Signed integer types will get sign extended
+        ** Handle the comparison appropriately depending on the data type
+        ** Any endian difference was handled when the watchpoint
+        ** data was extracted from the SB message
         */
-        case LC_DATA_WATCH_BYTE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed8, ComparisonValue.Signed8);
-            break;
+        switch (LC_OperData.WDTPtr[WatchIndex].DataType)
+        {
+            /*
+            ** Signed integer types will get sign extended
+            */
+            case LC_DATA_WATCH_BYTE:
+                EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed8, ComparisonValue.Signed8);
+                break;
 
-        case LC_DATA_WATCH_WORD_BE:
-        case LC_DATA_WATCH_WORD_LE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed16, ComparisonValue.Signed16);
-            break;
+            case LC_DATA_WATCH_WORD_BE:
+            case LC_DATA_WATCH_WORD_LE:
+                EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed16, ComparisonValue.Signed16);
+                break;
 
-        case LC_DATA_WATCH_DWORD_BE:
-        case LC_DATA_WATCH_DWORD_LE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed32, ComparisonValue.Signed32);
-            break;
+            case LC_DATA_WATCH_DWORD_BE:
+            case LC_DATA_WATCH_DWORD_LE:
+                EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed32, ComparisonValue.Signed32);
+                break;
 
-        /*
-        ** Unsigned integer types will get zero extended
-        */
-        case LC_DATA_WATCH_UBYTE:
-            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned8, ComparisonValue.Unsigned8);
-            break;
+            case LC_DATA_WATCH_QWORD_BE:
+            case LC_DATA_WATCH_QWORD_LE:
+                EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed64, ComparisonValue.Signed64);
+                break;
 
-        case LC_DATA_WATCH_UWORD_BE:
-        case LC_DATA_WATCH_UWORD_LE:
-            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned16, ComparisonValue.Unsigned16);
-            break;
+            /*
+            ** Unsigned integer types will get zero extended
+            */
+            case LC_DATA_WATCH_UBYTE:
+                EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned8, ComparisonValue.Unsigned8);
+                break;
 
-        case LC_DATA_WATCH_UDWORD_BE:
-        case LC_DATA_WATCH_UDWORD_LE:
-            EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned32, ComparisonValue.Unsigned32);
-            break;
+            case LC_DATA_WATCH_UWORD_BE:
+            case LC_DATA_WATCH_UWORD_LE:
+                EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned16, ComparisonValue.Unsigned16);
+                break;
 
-        /*
-        ** Floating point values are handled separately
-        */
-        case LC_DATA_WATCH_FLOAT_BE:
-        case LC_DATA_WATCH_FLOAT_LE:
-            EvalResult = LC_FloatCompare(WatchIndex, &WatchpointValue, &ComparisonValue);
-            break;
+            case LC_DATA_WATCH_UDWORD_BE:
+            case LC_DATA_WATCH_UDWORD_LE:
+                EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned32, ComparisonValue.Unsigned32);
+                break;
+
+            case LC_DATA_WATCH_UQWORD_BE:
+            case LC_DATA_WATCH_UQWORD_LE:
+                EvalResult = LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned64, ComparisonValue.Unsigned64);
+                break;
 
-        default:
             /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
+            ** Floating point values are handled separately
             */
-            CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "WP has undefined data type: WP = %d, DataType = %d",
-                              WatchIndex,
-                              LC_OperData.WDTPtr[WatchIndex].DataType);
+            case LC_DATA_WATCH_FLOAT_BE:
+            case LC_DATA_WATCH_FLOAT_LE:
+                EvalResult = LC_FloatCompare(WatchIndex, &WatchpointValue, &ComparisonValue);
+                break;
 
-            EvalResult = LC_WATCH_ERROR;
-            break;
+            case LC_DATA_WATCH_DOUBLE_BE:
+            case LC_DATA_WATCH_DOUBLE_LE:
+                EvalResult = LC_DoubleCompare(WatchIndex, &WatchpointValue, &ComparisonValue);
+                break;
+
+            default:
+                /*
+                ** This should have been caught before now, but we'll
+                ** handle it just in case we ever get here.
+                */
+                if (LC_CountWPError(WatchIndex) == true)
+                {
+                    CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID,
+                                      CFE_EVS_EventType_ERROR,
+                                      "WP has undefined data type: WP = %d, DataType = %d",
+                                      WatchIndex,
+                                      LC_OperData.WDTPtr[WatchIndex].DataType);
+                }
+
+                EvalResult = LC_WATCH_ERROR;
+                break;
+        }
     }
 
     return EvalResult;
@@ -573,7 +2643,7 @@ uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData)
 /* Perform a watchpoint signed integer comparison                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue)
+uint8 LC_SignedCompare(uint16 WatchIndex, int64 WPValue, int64 CompareValue)
 {
     uint8 EvalResult;
     uint8 OperatorID;
@@ -611,11 +2681,14 @@ uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue)
             ** This should have been caught before now, but we'll
             ** handle it just in case we ever get here.
             */
-            CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "WP has invalid operator ID: WP = %d, OperID = %d",
-                              WatchIndex,
-                              OperatorID);
+            if (LC_CountWPError(WatchIndex) == true)
+            {
+                CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "WP has invalid operator ID: WP = %d, OperID = %d",
+                                  WatchIndex,
+                                  OperatorID);
+            }
 
             EvalResult = LC_WATCH_ERROR;
             break;
@@ -629,7 +2702,7 @@ uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue)
 /* Perform a watchpoint unsigned integer comparison                */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue, uint32 CompareValue)
+uint8 LC_UnsignedCompare(uint16 WatchIndex, uint64 WPValue, uint64 CompareValue)
 {
     uint8 EvalResult;
     uint8 OperatorID;
@@ -667,11 +2740,14 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue, uint32 CompareValue)
             ** This should have been caught before now, but we'll
             ** handle it just in case we ever get here.
             */
-            CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "WP has invalid operator ID: WP = %d, OperID = %d",
-                              WatchIndex,
-                              OperatorID);
+            if (LC_CountWPError(WatchIndex) == true)
+            {
+                CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "WP has invalid operator ID: WP = %d, OperID = %d",
+                                  WatchIndex,
+                                  OperatorID);
+            }
 
             EvalResult = LC_WATCH_ERROR;
             break;
@@ -698,50 +2774,259 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiTy
     /* SAD: Using memcpy to safely copy the float value from LC_MultiType_t to WPFloat, preserving bitwise
      * representation */
     memcpy(&WPFloat, WPMultiType, sizeof(float));
-    /* SAD: Using memcpy to safely copy the float value from LC_MultiType_t to CompareFloat, preserving bitwise
-     * representation */
-    memcpy(&CompareFloat, CompareMultiType, sizeof(float));
+    /* SAD: Using memcpy to safely copy the float value from LC_MultiType_t to CompareFloat, preserving bitwise
+     * representation */
+    memcpy(&CompareFloat, CompareMultiType, sizeof(float));
+
+    /*
+    ** Before we do any comparison, check the watchpoint value for
+    ** a floating point NAN (not-a-number). NAN comparisons don't
+    ** work and can generate floating point exceptions. By contrast
+    ** comparisons with infinite numbers will behave as they should
+    ** so we don't try to catch those (we would rather they generate
+    ** watchpoint violations).
+    **
+    ** The comparison (threshold) value comes from the Watchpoint
+    ** Definition Table (WDT) and any weird values should get nailed
+    ** during table validation.
+    */
+    if (!isnan(WPFloat))
+    {
+        switch (OperatorID)
+        {
+            case LC_OPER_LE:
+                EvalResult = (WPFloat <= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_LT:
+                EvalResult = (WPFloat < CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_EQ:
+                Diff       = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat) : (CompareFloat - WPFloat);
+                EvalResult = (Diff <= (float)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_NE:
+                Diff       = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat) : (CompareFloat - WPFloat);
+                EvalResult = (Diff > (float)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_GT:
+                EvalResult = (WPFloat > CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_GE:
+                EvalResult = (WPFloat >= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            default:
+                /*
+                ** This should have been caught before now, but we'll
+                ** handle it just in case we ever get here.
+                */
+                if (LC_CountWPError(WatchIndex) == true)
+                {
+                    CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
+                                      CFE_EVS_EventType_ERROR,
+                                      "WP has invalid operator ID: WP = %d, OperID = %d",
+                                      WatchIndex,
+                                      OperatorID);
+                }
+
+                EvalResult = LC_WATCH_ERROR;
+                break;
+
+        } /*  end of switch  */
+
+    } /* end LC_WPIsNAN if */
+    else
+    {
+        if (LC_CountWPError(WatchIndex) == true)
+        {
+            CFE_EVS_SendEvent(LC_WP_NAN_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "WP data value is a float NAN: WP = %d, Value = 0x%08X",
+                              WatchIndex,
+                              *((unsigned int *)WPMultiType));
+        }
+
+        EvalResult = LC_WATCH_ERROR;
+    }
+
+    return EvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a double precision floating point number comparison     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_DoubleCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType)
+{
+    uint8  EvalResult;
+    uint8  OperatorID;
+    double WPDouble;
+    double CompareDouble;
+    double Diff;
+
+    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+
+    memcpy(&WPDouble, WPMultiType, sizeof(double));
+    memcpy(&CompareDouble, CompareMultiType, sizeof(double));
+
+    /*
+    ** Same NAN handling as LC_FloatCompare
+    */
+    if (!isnan(WPDouble))
+    {
+        switch (OperatorID)
+        {
+            case LC_OPER_LE:
+                EvalResult = (WPDouble <= CompareDouble) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_LT:
+                EvalResult = (WPDouble < CompareDouble) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_EQ:
+                Diff       = (WPDouble > CompareDouble) ? (WPDouble - CompareDouble) : (CompareDouble - WPDouble);
+                EvalResult = (Diff <= (double)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_NE:
+                Diff       = (WPDouble > CompareDouble) ? (WPDouble - CompareDouble) : (CompareDouble - WPDouble);
+                EvalResult = (Diff > (double)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_GT:
+                EvalResult = (WPDouble > CompareDouble) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            case LC_OPER_GE:
+                EvalResult = (WPDouble >= CompareDouble) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                break;
+
+            default:
+                /*
+                ** This should have been caught before now, but we'll
+                ** handle it just in case we ever get here.
+                */
+                if (LC_CountWPError(WatchIndex) == true)
+                {
+                    CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
+                                      CFE_EVS_EventType_ERROR,
+                                      "WP has invalid operator ID: WP = %d, OperID = %d",
+                                      WatchIndex,
+                                      OperatorID);
+                }
+
+                EvalResult = LC_WATCH_ERROR;
+                break;
+
+        } /*  end of switch  */
+
+    } /* end isnan if */
+    else
+    {
+        if (LC_CountWPError(WatchIndex) == true)
+        {
+            CFE_EVS_SendEvent(LC_WP_NAN_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "WP data value is a float NAN: WP = %d, Value = 0x%08X%08X",
+                              WatchIndex,
+                              (unsigned int)(WPMultiType->Unsigned64 >> 32),
+                              (unsigned int)WPMultiType->Unsigned64);
+        }
+
+        EvalResult = LC_WATCH_ERROR;
+    }
+
+    return EvalResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a watchpoint range or hysteresis comparison             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_RangeCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType,
+                      LC_MultiType_t *SecondMultiType)
+{
+    uint8 EvalResult;
+    uint8 OperatorID;
+    uint8 DataType;
+    bool  SetHit;
+    bool  ClearHit;
+    float WPFloat;
+
+    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+    DataType   = LC_OperData.WDTPtr[WatchIndex].DataType;
+
+    /* SAD: Using memcpy to safely copy the float value from LC_MultiType_t to WPFloat, preserving bitwise
+     * representation */
+    memcpy(&WPFloat, WPMultiType, sizeof(float));
 
     /*
-    ** Before we do any comparison, check the watchpoint value for
-    ** a floating point NAN (not-a-number). NAN comparisons don't
-    ** work and can generate floating point exceptions. By contrast
-    ** comparisons with infinite numbers will behave as they should
-    ** so we don't try to catch those (we would rather they generate
-    ** watchpoint violations).
-    **
-    ** The comparison (threshold) value comes from the Watchpoint
-    ** Definition Table (WDT) and any weird values should get nailed
-    ** during table validation.
+    ** A NAN is neither inside nor outside any range, let the
+    ** relational comparison report it the usual way
     */
-    if (!isnan(WPFloat))
+    if (((DataType == LC_DATA_WATCH_FLOAT_BE) || (DataType == LC_DATA_WATCH_FLOAT_LE)) && isnan(WPFloat))
+    {
+        EvalResult = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    }
+    else if (((DataType == LC_DATA_WATCH_DOUBLE_BE) || (DataType == LC_DATA_WATCH_DOUBLE_LE)) &&
+             isnan(WPMultiType->Float64))
+    {
+        EvalResult = LC_DoubleCompare(WatchIndex, WPMultiType, CompareMultiType);
+    }
+    else
     {
         switch (OperatorID)
         {
-            case LC_OPER_LE:
-                EvalResult = (WPFloat <= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
-
-            case LC_OPER_LT:
-                EvalResult = (WPFloat < CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
-
-            case LC_OPER_EQ:
-                Diff       = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat) : (CompareFloat - WPFloat);
-                EvalResult = (Diff <= (float)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            case LC_OPER_IN_RANGE:
+                EvalResult = (LC_MultiTypeCompare(DataType, LC_OPER_GE, WPMultiType, CompareMultiType) &&
+                              LC_MultiTypeCompare(DataType, LC_OPER_LE, WPMultiType, SecondMultiType))
+                                 ? LC_WATCH_TRUE
+                                 : LC_WATCH_FALSE;
                 break;
 
-            case LC_OPER_NE:
-                Diff       = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat) : (CompareFloat - WPFloat);
-                EvalResult = (Diff > (float)LC_FLOAT_TOLERANCE) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            case LC_OPER_OUT_OF_RANGE:
+                EvalResult = (LC_MultiTypeCompare(DataType, LC_OPER_LT, WPMultiType, CompareMultiType) ||
+                              LC_MultiTypeCompare(DataType, LC_OPER_GT, WPMultiType, SecondMultiType))
+                                 ? LC_WATCH_TRUE
+                                 : LC_WATCH_FALSE;
                 break;
 
-            case LC_OPER_GT:
-                EvalResult = (WPFloat > CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
+            case LC_OPER_HYSTERESIS:
+                /*
+                ** The set threshold may be above or below the clear
+                ** threshold, between the two the last result is held
+                */
+                if (LC_MultiTypeCompare(DataType, LC_OPER_GE, CompareMultiType, SecondMultiType))
+                {
+                    SetHit   = LC_MultiTypeCompare(DataType, LC_OPER_GE, WPMultiType, CompareMultiType);
+                    ClearHit = LC_MultiTypeCompare(DataType, LC_OPER_LE, WPMultiType, SecondMultiType);
+                }
+                else
+                {
+                    SetHit   = LC_MultiTypeCompare(DataType, LC_OPER_LE, WPMultiType, CompareMultiType);
+                    ClearHit = LC_MultiTypeCompare(DataType, LC_OPER_GE, WPMultiType, SecondMultiType);
+                }
 
-            case LC_OPER_GE:
-                EvalResult = (WPFloat >= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                if (SetHit)
+                {
+                    EvalResult = LC_WATCH_TRUE;
+                }
+                else if (ClearHit || (LC_OperData.WRTPtr[WatchIndex].WatchResult != LC_WATCH_TRUE))
+                {
+                    EvalResult = LC_WATCH_FALSE;
+                }
+                else
+                {
+                    EvalResult = LC_WATCH_TRUE;
+                }
                 break;
 
             default:
@@ -749,27 +3034,18 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiTy
                 ** This should have been caught before now, but we'll
                 ** handle it just in case we ever get here.
                 */
-                CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
-                                  CFE_EVS_EventType_ERROR,
-                                  "WP has invalid operator ID: WP = %d, OperID = %d",
-                                  WatchIndex,
-                                  OperatorID);
+                if (LC_CountWPError(WatchIndex) == true)
+                {
+                    CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID,
+                                      CFE_EVS_EventType_ERROR,
+                                      "WP has invalid operator ID: WP = %d, OperID = %d",
+                                      WatchIndex,
+                                      OperatorID);
+                }
 
                 EvalResult = LC_WATCH_ERROR;
                 break;
-
-        } /*  end of switch  */
-
-    } /* end LC_WPIsNAN if */
-    else
-    {
-        CFE_EVS_SendEvent(LC_WP_NAN_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "WP data value is a float NAN: WP = %d, Value = 0x%08X",
-                          WatchIndex,
-                          *((unsigned int *)WPMultiType));
-
-        EvalResult = LC_WATCH_ERROR;
+        }
     }
 
     return EvalResult;
@@ -777,67 +3053,159 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiTy
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Checks if a defined watchpoint offset will send us past the     */
-/* end of the received message                                     */
+/* Compare two watchpoint values of the same data type             */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
+bool LC_MultiTypeCompare(uint8 DataType, uint8 OperatorID, const LC_MultiType_t *Value,
+                         const LC_MultiType_t *Reference)
 {
-    size_t         MsgLength = 0;
-    uint32         Offset;
-    uint32         NumOfDataBytes = 0;
-    bool           OffsetValid    = true;
-    CFE_SB_MsgId_t MessageID      = CFE_SB_INVALID_MSG_ID;
-
-    /*
-    ** Check the message length against the watchpoint
-    ** offset and data type to make sure we won't
-    ** try to read past it.
-    */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType)
+    bool   Result;
+    bool   Unordered = false;
+    int32  Order;
+    float  ValueFloat;
+    float  ReferenceFloat;
+    double ValueDouble;
+    double ReferenceDouble;
+
+    switch (DataType)
     {
         case LC_DATA_WATCH_BYTE:
+            Order = (Value->Signed8 > Reference->Signed8) - (Value->Signed8 < Reference->Signed8);
+            break;
+
         case LC_DATA_WATCH_UBYTE:
-            NumOfDataBytes = sizeof(uint8);
+            Order = (Value->Unsigned8 > Reference->Unsigned8) - (Value->Unsigned8 < Reference->Unsigned8);
             break;
 
         case LC_DATA_WATCH_WORD_BE:
         case LC_DATA_WATCH_WORD_LE:
+            Order = (Value->Signed16 > Reference->Signed16) - (Value->Signed16 < Reference->Signed16);
+            break;
+
         case LC_DATA_WATCH_UWORD_BE:
         case LC_DATA_WATCH_UWORD_LE:
-            NumOfDataBytes = sizeof(uint16);
+            Order = (Value->Unsigned16 > Reference->Unsigned16) - (Value->Unsigned16 < Reference->Unsigned16);
             break;
 
         case LC_DATA_WATCH_DWORD_BE:
         case LC_DATA_WATCH_DWORD_LE:
-        case LC_DATA_WATCH_UDWORD_BE:
-        case LC_DATA_WATCH_UDWORD_LE:
-            NumOfDataBytes = sizeof(uint32);
+            Order = (Value->Signed32 > Reference->Signed32) - (Value->Signed32 < Reference->Signed32);
+            break;
+
+        case LC_DATA_WATCH_QWORD_BE:
+        case LC_DATA_WATCH_QWORD_LE:
+            Order = (Value->Signed64 > Reference->Signed64) - (Value->Signed64 < Reference->Signed64);
+            break;
+
+        case LC_DATA_WATCH_UQWORD_BE:
+        case LC_DATA_WATCH_UQWORD_LE:
+            Order = (Value->Unsigned64 > Reference->Unsigned64) - (Value->Unsigned64 < Reference->Unsigned64);
             break;
 
         case LC_DATA_WATCH_FLOAT_BE:
         case LC_DATA_WATCH_FLOAT_LE:
-            NumOfDataBytes = sizeof(float);
+        case LC_DATA_WATCH_DOUBLE_BE:
+        case LC_DATA_WATCH_DOUBLE_LE:
+            if ((DataType == LC_DATA_WATCH_FLOAT_BE) || (DataType == LC_DATA_WATCH_FLOAT_LE))
+            {
+                /* SAD: Using memcpy to safely copy the float values from LC_MultiType_t, preserving bitwise
+                 * representation */
+                memcpy(&ValueFloat, Value, sizeof(float));
+                memcpy(&ReferenceFloat, Reference, sizeof(float));
+                ValueDouble     = ValueFloat;
+                ReferenceDouble = ReferenceFloat;
+            }
+            else
+            {
+                ValueDouble     = Value->Float64;
+                ReferenceDouble = Reference->Float64;
+            }
+
+            /* A NAN is unordered, every relation with it is false */
+            Unordered = (isnan(ValueDouble) || isnan(ReferenceDouble));
+            Order     = (ValueDouble > ReferenceDouble) - (ValueDouble < ReferenceDouble);
             break;
 
+        case LC_DATA_WATCH_UDWORD_BE:
+        case LC_DATA_WATCH_UDWORD_LE:
         default:
-            /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
-            */
+            Order = (Value->Unsigned32 > Reference->Unsigned32) - (Value->Unsigned32 < Reference->Unsigned32);
+            break;
+    }
+
+    switch (OperatorID)
+    {
+        case LC_OPER_LT:
+            Result = !Unordered && (Order < 0);
+            break;
+
+        case LC_OPER_LE:
+            Result = !Unordered && (Order <= 0);
+            break;
+
+        case LC_OPER_NE:
+            Result = Unordered || (Order != 0);
+            break;
+
+        case LC_OPER_EQ:
+            Result = !Unordered && (Order == 0);
+            break;
+
+        case LC_OPER_GE:
+            Result = !Unordered && (Order >= 0);
+            break;
+
+        case LC_OPER_GT:
+        default:
+            Result = !Unordered && (Order > 0);
+            break;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Checks if a defined watchpoint offset will send us past the     */
+/* end of the received message                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t         MsgLength = 0;
+    uint32         Offset;
+    uint32         NumOfDataBytes = 0;
+    bool           OffsetValid    = true;
+    CFE_SB_MsgId_t MessageID      = CFE_SB_INVALID_MSG_ID;
+
+    /*
+    ** Check the message length against the watchpoint
+    ** offset and data type to make sure we won't
+    ** try to read past it.
+    */
+    NumOfDataBytes = LC_GetWPDataSize(LC_OperData.WDTPtr[WatchIndex].DataType);
+
+    if (NumOfDataBytes == 0)
+    {
+        /*
+        ** This should have been caught before now, but we'll
+        ** handle it just in case we ever get here.
+        */
+        if (LC_CountWPError(WatchIndex) == true)
+        {
             CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID,
                               CFE_EVS_EventType_ERROR,
                               "WP has undefined data type: WP = %d, DataType = %d",
                               WatchIndex,
                               LC_OperData.WDTPtr[WatchIndex].DataType);
+        }
 
-            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
-
-            return false;
-            break;
+        LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_ERROR;
+        LC_DisarmStaleTimer(WatchIndex);
+        LC_WatchResultChanged(WatchIndex);
 
-    } /* end switch */
+        return false;
+    }
 
     CFE_MSG_GetSize(&BufPtr->Msg, &MsgLength);
 
@@ -847,19 +3215,23 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
     {
         OffsetValid = false;
 
-        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+        if (LC_CountWPError(WatchIndex) == true)
+        {
+            CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
 
-        CFE_EVS_SendEvent(LC_WP_OFFSET_ERR_EID,
-                          CFE_EVS_EventType_ERROR,
-                          "WP offset error: MID = 0x%08lX, WP = %d, Offset = %d, DataSize = %d, MsgLen = %d",
-                          (unsigned long)CFE_SB_MsgIdToValue(MessageID),
-                          WatchIndex,
-                          (int)Offset,
-                          (int)NumOfDataBytes,
-                          (int)MsgLength);
+            CFE_EVS_SendEvent(LC_WP_OFFSET_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "WP offset error: MID = 0x%08lX, WP = %d, Offset = %d, DataSize = %d, MsgLen = %d",
+                              (unsigned long)CFE_SB_MsgIdToValue(MessageID),
+                              WatchIndex,
+                              (int)Offset,
+                              (int)NumOfDataBytes,
+                              (int)MsgLength);
+        }
 
-        LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-        LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+        LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_ERROR;
+        LC_DisarmStaleTimer(WatchIndex);
+        LC_WatchResultChanged(WatchIndex);
     }
 
     return OffsetValid;
@@ -867,21 +3239,57 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Copy a single watchpoint datum and simultaneously byteswap it   */
+/* Get the number of message bytes read for a watchpoint data type */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void LC_CopyBytesWithSwap(LC_MultiType_t *DestBuffer, const uint8 *SrcPtr, LC_MultiType_t *SwapMap, uint32 NumBytes)
+uint32 LC_GetWPDataSize(uint8 DataType)
 {
-    uint8       *DestPtr;
-    const uint8 *SwapMapPtr;
+    uint32 NumOfDataBytes;
 
-    DestPtr    = (uint8 *)DestBuffer;
-    SwapMapPtr = (const uint8 *)SwapMap;
-    while (NumBytes > 0)
+    switch (DataType)
     {
-        --NumBytes;
-        DestPtr[NumBytes] = SrcPtr[SwapMapPtr[NumBytes] & 0x3];
+        case LC_DATA_WATCH_BYTE:
+        case LC_DATA_WATCH_UBYTE:
+            NumOfDataBytes = sizeof(uint8);
+            break;
+
+        case LC_DATA_WATCH_WORD_BE:
+        case LC_DATA_WATCH_WORD_LE:
+        case LC_DATA_WATCH_UWORD_BE:
+        case LC_DATA_WATCH_UWORD_LE:
+            NumOfDataBytes = sizeof(uint16);
+            break;
+
+        case LC_DATA_WATCH_DWORD_BE:
+        case LC_DATA_WATCH_DWORD_LE:
+        case LC_DATA_WATCH_UDWORD_BE:
+        case LC_DATA_WATCH_UDWORD_LE:
+            NumOfDataBytes = sizeof(uint32);
+            break;
+
+        case LC_DATA_WATCH_FLOAT_BE:
+        case LC_DATA_WATCH_FLOAT_LE:
+            NumOfDataBytes = sizeof(float);
+            break;
+
+        case LC_DATA_WATCH_QWORD_BE:
+        case LC_DATA_WATCH_QWORD_LE:
+        case LC_DATA_WATCH_UQWORD_BE:
+        case LC_DATA_WATCH_UQWORD_LE:
+            NumOfDataBytes = sizeof(uint64);
+            break;
+
+        case LC_DATA_WATCH_DOUBLE_BE:
+        case LC_DATA_WATCH_DOUBLE_LE:
+            NumOfDataBytes = sizeof(double);
+            break;
+
+        default:
+            NumOfDataBytes = 0;
+            break;
     }
+
+    return NumOfDataBytes;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -889,69 +3297,66 @@ void LC_CopyBytesWithSwap(LC_MultiType_t *DestBuffer, const uint8 *SrcPtr, LC_Mu
 /* Get sized watchpoint data                                       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedDataPtr)
+bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint64 *SizedDataPtr)
 {
-    bool           Success = true;
-    LC_MultiType_t ConvBuffer;
-    LC_MultiType_t TempBuffer;
-
-    ConvBuffer.Unsigned32 = 0;
-    TempBuffer.Unsigned32 = 0;
+    bool Success = true;
 
     /*
     ** Get the watchpoint data value (which may be on a misaligned
     ** address boundary) and put it into an unsigned 32 properly
-    ** handling endian and sign extension issues
+    ** handling endian and sign extension issues. 64 bit types
+    ** fill the whole unsigned 64, all others are zero extended.
     */
     switch (LC_OperData.WDTPtr[WatchIndex].DataType)
     {
         case LC_DATA_WATCH_BYTE:
-            TempBuffer.Signed8 = *WPDataPtr;
-            *SizedDataPtr      = TempBuffer.Signed8; /* Extend signed 8 bit value to 32 bits */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_S8, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_UBYTE:
-            *SizedDataPtr = *WPDataPtr; /* Extend unsigned 8 bit value to 32 bits */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_U8, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_WORD_BE:
-            ConvBuffer.Unsigned16 = LC_16BIT_BE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(int16));
-            *SizedDataPtr = TempBuffer.Signed16; /* Extend signed 16 bit value to 32 bits */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_S16_BE, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_WORD_LE:
-            ConvBuffer.Unsigned16 = LC_16BIT_LE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(int16));
-            *SizedDataPtr = TempBuffer.Signed16; /* Extend signed 16 bit value to 32 bits */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_S16_LE, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_UWORD_BE:
-            ConvBuffer.Unsigned16 = LC_16BIT_BE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint16));
-            *SizedDataPtr = TempBuffer.Unsigned16; /* Extend unsigned 16 bit value to 32 bits */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_U16_BE, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_UWORD_LE:
-            ConvBuffer.Unsigned16 = LC_16BIT_LE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint16));
-            *SizedDataPtr = TempBuffer.Unsigned16; /* Extend unsigned 16 bit value to 32 bits */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_U16_LE, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_DWORD_BE:
         case LC_DATA_WATCH_UDWORD_BE:
         case LC_DATA_WATCH_FLOAT_BE:
-            ConvBuffer.Unsigned32 = LC_32BIT_BE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint32));
-            *SizedDataPtr = TempBuffer.Unsigned32; /* Straight copy - no extension (signed or unsigned) */
+            /* Straight copy - no extension (signed or unsigned) */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_U32_BE, WPDataPtr);
             break;
 
         case LC_DATA_WATCH_DWORD_LE:
         case LC_DATA_WATCH_UDWORD_LE:
         case LC_DATA_WATCH_FLOAT_LE:
-            ConvBuffer.Unsigned32 = LC_32BIT_LE_VAL;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint32));
-            *SizedDataPtr = TempBuffer.Unsigned32; /* Straight copy - no extension (signed or unsigned) */
+            /* Straight copy - no extension (signed or unsigned) */
+            *SizedDataPtr = LC_ExtractWPData(LC_WP_EXTRACT_U32_LE, WPDataPtr);
+            break;
+
+        case LC_DATA_WATCH_QWORD_BE:
+        case LC_DATA_WATCH_UQWORD_BE:
+        case LC_DATA_WATCH_DOUBLE_BE:
+            *SizedDataPtr = LC_LoadBE64(WPDataPtr);
+            break;
+
+        case LC_DATA_WATCH_QWORD_LE:
+        case LC_DATA_WATCH_UQWORD_LE:
+        case LC_DATA_WATCH_DOUBLE_LE:
+            *SizedDataPtr = LC_LoadLE64(WPDataPtr);
             break;
 
         default:
@@ -959,14 +3364,18 @@ bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedD
             ** This should have been caught before now, but we'll
             ** handle it just in case we ever get here.
             */
-            CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID,
-                              CFE_EVS_EventType_ERROR,
-                              "WP has undefined data type: WP = %d, DataType = %d",
-                              WatchIndex,
-                              LC_OperData.WDTPtr[WatchIndex].DataType);
+            if (LC_CountWPError(WatchIndex) == true)
+            {
+                CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "WP has undefined data type: WP = %d, DataType = %d",
+                                  WatchIndex,
+                                  LC_OperData.WDTPtr[WatchIndex].DataType);
+            }
 
-            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+            LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_ERROR;
+            LC_DisarmStaleTimer(WatchIndex);
+            LC_WatchResultChanged(WatchIndex);
 
             Success       = false;
             *SizedDataPtr = 0;
@@ -993,11 +3402,16 @@ int32 LC_ValidateWDT(void *TableData)
     int32 TableResult = CFE_SUCCESS;
     int32 TableIndex;
 
-    uint8          DataType;
-    uint8          OperatorID;
-    CFE_SB_MsgId_t MessageID;
-    uint32         PrintableBits;
-    float          FloatValue;
+    uint8           DataType;
+    uint8           OperatorID;
+    CFE_SB_MsgId_t  MessageID;
+    uint32          PrintableBits;
+    float           FloatValue;
+    float           SecondFloatValue;
+    double          DoubleValue;
+    double          SecondDoubleValue;
+    bool            IsRangeOper;
+    LC_MultiType_t *FPValuePtr;
 
     int32 GoodCount   = 0;
     int32 BadCount    = 0;
@@ -1012,6 +3426,9 @@ int32 LC_ValidateWDT(void *TableData)
         OperatorID = TableArray[TableIndex].OperatorID;
         MessageID  = TableArray[TableIndex].MessageID;
 
+        IsRangeOper = ((OperatorID >= LC_OPER_IN_RANGE) && (OperatorID <= LC_OPER_HYSTERESIS));
+        FPValuePtr  = &TableArray[TableIndex].ComparisonValue;
+
         if (DataType == LC_DATA_WATCH_NOT_USED)
         {
             /*
@@ -1019,12 +3436,7 @@ int32 LC_ValidateWDT(void *TableData)
             */
             UnusedCount++;
         }
-        else if ((DataType != LC_DATA_WATCH_BYTE) && (DataType != LC_DATA_WATCH_UBYTE)
-                 && (DataType != LC_DATA_WATCH_WORD_BE) && (DataType != LC_DATA_WATCH_WORD_LE)
-                 && (DataType != LC_DATA_WATCH_UWORD_BE) && (DataType != LC_DATA_WATCH_UWORD_LE)
-                 && (DataType != LC_DATA_WATCH_DWORD_BE) && (DataType != LC_DATA_WATCH_DWORD_LE)
-                 && (DataType != LC_DATA_WATCH_UDWORD_BE) && (DataType != LC_DATA_WATCH_UDWORD_LE)
-                 && (DataType != LC_DATA_WATCH_FLOAT_BE) && (DataType != LC_DATA_WATCH_FLOAT_LE))
+        else if (LC_GetWPDataSize(DataType) == 0)
         {
             /*
             ** Invalid data type
@@ -1034,7 +3446,7 @@ int32 LC_ValidateWDT(void *TableData)
         }
         else if ((OperatorID != LC_OPER_LT) && (OperatorID != LC_OPER_LE) && (OperatorID != LC_OPER_NE)
                  && (OperatorID != LC_OPER_EQ) && (OperatorID != LC_OPER_GE) && (OperatorID != LC_OPER_GT)
-                 && (OperatorID != LC_OPER_CUSTOM))
+                 && (OperatorID != LC_OPER_CUSTOM) && !IsRangeOper)
         {
             /*
             ** Invalid operator
@@ -1050,15 +3462,36 @@ int32 LC_ValidateWDT(void *TableData)
             BadCount++;
             EntryResult = LC_WDTVAL_ERR_MID;
         }
+        else if ((TableArray[TableIndex].WatchOptions & ~LC_WATCH_OPT_MASK) != 0)
+        {
+            /*
+            ** Option bits this version does not define
+            */
+            BadCount++;
+            EntryResult = LC_WDTVAL_ERR_OPTIONS;
+        }
+        else if (((OperatorID == LC_OPER_IN_RANGE) || (OperatorID == LC_OPER_OUT_OF_RANGE)) &&
+                 LC_MultiTypeCompare(DataType, LC_OPER_GT, &TableArray[TableIndex].ComparisonValue,
+                                     &TableArray[TableIndex].SecondComparisonValue))
+        {
+            /*
+            ** Range bounds out of order, nothing could ever be
+            ** in range
+            */
+            BadCount++;
+            EntryResult = LC_WDTVAL_ERR_RANGE;
+        }
         else if ((DataType == LC_DATA_WATCH_FLOAT_BE) || (DataType == LC_DATA_WATCH_FLOAT_LE))
         {
             /* SAD: Using memcpy to safely copy the float value from LC_MultiType_t to FloatValue, preserving bitwise
              * representation */
             memcpy(&FloatValue, &TableArray[TableIndex].ComparisonValue, sizeof(FloatValue));
+            memcpy(&SecondFloatValue, &TableArray[TableIndex].SecondComparisonValue, sizeof(SecondFloatValue));
 
             /*
             ** Check the floating point comparison value for
-            ** NAN (not-a-number) or infinite values
+            ** NAN (not-a-number) or infinite values, and the
+            ** second one too when the operator uses it
             */
             if (isnan(FloatValue))
             {
@@ -1070,6 +3503,12 @@ int32 LC_ValidateWDT(void *TableData)
                 BadCount++;
                 EntryResult = LC_WDTVAL_ERR_FPINF;
             }
+            else if (IsRangeOper && !isfinite(SecondFloatValue))
+            {
+                BadCount++;
+                EntryResult = isnan(SecondFloatValue) ? LC_WDTVAL_ERR_FPNAN : LC_WDTVAL_ERR_FPINF;
+                FPValuePtr  = &TableArray[TableIndex].SecondComparisonValue;
+            }
             else
             {
                 /*
@@ -1078,6 +3517,32 @@ int32 LC_ValidateWDT(void *TableData)
                 GoodCount++;
             }
         }
+        else if ((DataType == LC_DATA_WATCH_DOUBLE_BE) || (DataType == LC_DATA_WATCH_DOUBLE_LE))
+        {
+            memcpy(&DoubleValue, &TableArray[TableIndex].ComparisonValue, sizeof(DoubleValue));
+            memcpy(&SecondDoubleValue, &TableArray[TableIndex].SecondComparisonValue, sizeof(SecondDoubleValue));
+
+            if (isnan(DoubleValue))
+            {
+                BadCount++;
+                EntryResult = LC_WDTVAL_ERR_FPNAN;
+            }
+            else if (!LC_ISFINITE_DOUBLE(DoubleValue))
+            {
+                BadCount++;
+                EntryResult = LC_WDTVAL_ERR_FPINF;
+            }
+            else if (IsRangeOper && !LC_ISFINITE_DOUBLE(SecondDoubleValue))
+            {
+                BadCount++;
+                EntryResult = isnan(SecondDoubleValue) ? LC_WDTVAL_ERR_FPNAN : LC_WDTVAL_ERR_FPINF;
+                FPValuePtr  = &TableArray[TableIndex].SecondComparisonValue;
+            }
+            else
+            {
+                GoodCount++;
+            }
+        }
         else
         {
             /*
@@ -1091,11 +3556,22 @@ int32 LC_ValidateWDT(void *TableData)
         */
         if ((EntryResult != LC_WDTVAL_ERR_NONE) && (TableResult == CFE_SUCCESS))
         {
-            if ((EntryResult == LC_WDTVAL_ERR_FPNAN) || (EntryResult == LC_WDTVAL_ERR_FPINF))
+            if (((EntryResult == LC_WDTVAL_ERR_FPNAN) || (EntryResult == LC_WDTVAL_ERR_FPINF))
+                && ((DataType == LC_DATA_WATCH_DOUBLE_BE) || (DataType == LC_DATA_WATCH_DOUBLE_LE)))
+            {
+                CFE_EVS_SendEvent(LC_WDTVAL_FPERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "WDT verify float err: WP = %d, Err = %d, ComparisonValue = 0x%08X%08X",
+                                  (int)TableIndex,
+                                  (int)EntryResult,
+                                  (unsigned int)(FPValuePtr->Unsigned64 >> 32),
+                                  (unsigned int)FPValuePtr->Unsigned64);
+            }
+            else if ((EntryResult == LC_WDTVAL_ERR_FPNAN) || (EntryResult == LC_WDTVAL_ERR_FPINF))
             {
                 /* SAD: Using memcpy to safely copy the uint32 value from LC_MultiType_t to PrintableBits, preserving
                  * bitwise representation */
-                memcpy(&PrintableBits, &TableArray[TableIndex].ComparisonValue, sizeof(PrintableBits));
+                memcpy(&PrintableBits, FPValuePtr, sizeof(PrintableBits));
                 CFE_EVS_SendEvent(LC_WDTVAL_FPERR_EID,
                                   CFE_EVS_EventType_ERROR,
                                   "WDT verify float err: WP = %d, Err = %d, ComparisonValue = 0x%08X",
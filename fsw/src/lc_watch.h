@@ -35,13 +35,75 @@
  *************************************************************************/
 
 /**
- * \name Values used when converting watchpoint values to correctly sized data
+ * \name Compiled watchpoint data extractors
+ *
+ * Each extractor reads the watchpoint data and widens it to 32 bits
+ * exactly as #LC_GetSizedWPData does for the corresponding data types
+ * \{
+ */
+#define LC_WP_EXTRACT_U8     0 /**< \brief 8 bit, zero extended                    */
+#define LC_WP_EXTRACT_S8     1 /**< \brief 8 bit, sign extended                    */
+#define LC_WP_EXTRACT_U16_BE 2 /**< \brief 16 bit big endian, zero extended        */
+#define LC_WP_EXTRACT_U16_LE 3 /**< \brief 16 bit little endian, zero extended     */
+#define LC_WP_EXTRACT_S16_BE 4 /**< \brief 16 bit big endian, sign extended        */
+#define LC_WP_EXTRACT_S16_LE 5 /**< \brief 16 bit little endian, sign extended     */
+#define LC_WP_EXTRACT_U32_BE 6 /**< \brief 32 bit big endian                       */
+#define LC_WP_EXTRACT_U32_LE 7 /**< \brief 32 bit little endian                    */
+#define LC_WP_EXTRACT_COUNT  8 /**< \brief Number of extractors                    */
+/**\}*/
+
+/**
+ * \name Compiled watchpoint opcodes
+ *
+ * Relational opcodes combine a comparison kind with the WDT OperatorID
+ * (#LC_OPER_LT through #LC_OPER_GT, or one of the range operators) in
+ * the low bits
  * \{
  */
-#define LC_16BIT_BE_VAL 0x0001     /**< \brief 16 bit big endian conversion value */
-#define LC_16BIT_LE_VAL 0x0100     /**< \brief 16 bit little endian conversion value */
-#define LC_32BIT_BE_VAL 0x00010203 /**< \brief 32 bit big endian conversion value */
-#define LC_32BIT_LE_VAL 0x03020100 /**< \brief 32 bit little endian conversion value */
+#define LC_WP_OPCODE_LEGACY   0x00 /**< \brief Evaluate with #LC_ProcessWP           */
+#define LC_WP_OPCODE_SIGNED   0x10 /**< \brief Signed integer comparison             */
+#define LC_WP_OPCODE_UNSIGNED 0x20 /**< \brief Unsigned integer comparison           */
+#define LC_WP_OPCODE_FLOAT    0x30 /**< \brief Single precision float comparison     */
+#define LC_WP_OPCODE_CUSTOM   0x40 /**< \brief Call #LC_CustomFunction               */
+#define LC_WP_OPCODE_OPERMASK 0x0F /**< \brief OperatorID bits of a relational opcode */
+/**\}*/
+
+/**
+ * \brief Compiled operator for #LC_OPER_HYSTERESIS with a set threshold
+ *        below the clear threshold
+ *
+ * #LC_OPER_HYSTERESIS is compiled to this when the watchpoint goes true
+ * at or below ComparisonValue, so batches never mix the two directions
+ */
+#define LC_WP_OPER_HYSTERESIS_LOW 0x0B
+
+/**
+ * \brief Upper half of 64 bit watchpoint data
+ *
+ * The WDT bitmask is 32 bits wide; it is applied to the lower half of
+ * 64 bit watchpoint data and the upper half is always kept
+ */
+#define LC_WP_UPPER_HALF 0xFFFFFFFF00000000ULL
+
+/**
+ * \name Compiled watchpoint batches
+ * \{
+ */
+#define LC_WP_BATCH_LANES 32 /**< \brief Most watchpoints compared in one batch */
+
+/** \brief Key that orders watchpoints on the same message into batchable groups */
+#define LC_WP_GROUP_KEY(Opcode, Extract) (((uint32)(Opcode) * LC_WP_EXTRACT_COUNT) + (Extract))
+
+/** \brief Number of distinct #LC_WP_GROUP_KEY values */
+#define LC_WP_GROUP_KEYS ((LC_WP_OPCODE_CUSTOM + 1) * LC_WP_EXTRACT_COUNT)
+/**\}*/
+
+/**
+ * \name Packet digest constants
+ * \{
+ */
+#define LC_DIGEST_SEED  0xCBF29CE484222325ULL /**< \brief Initial digest value      */
+#define LC_DIGEST_PRIME 0x9E3779B97F4A7C15ULL /**< \brief Odd multiplier per word   */
 /**\}*/
 
 /**
@@ -76,6 +138,26 @@
  */
 void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Check an indexed message for watchpoints
+ *
+ *  \par Description
+ *       Same as #LC_CheckMsgForWPs for a message whose dispatch index
+ *       entry has already been found, so the command pipe can resolve
+ *       the handler and the watchpoint span with a single lookup.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A NULL MessageList is a message no watchpoint references
+ *
+ *  \param[in] MessageID   Message ID
+ *  \param[in] MessageList Dispatch index entry for MessageID, or NULL
+ *  \param[in] BufPtr      Pointer to Software Bus buffer
+ *
+ *  \sa #LC_FindMessageIndex
+ */
+void LC_CheckIndexedMsgForWPs(CFE_SB_MsgId_t MessageID, const LC_MessageList_t *MessageList,
+                              const CFE_SB_Buffer_t *BufPtr);
+
 /**
  * \brief Validate watchpoint definition table (WDT)
  *
@@ -95,26 +177,56 @@ void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr);
  *  \retval #LC_WDTVAL_ERR_MID      \copydoc LC_WDTVAL_ERR_MID
  *  \retval #LC_WDTVAL_ERR_FPNAN    \copydoc LC_WDTVAL_ERR_FPNAN
  *  \retval #LC_WDTVAL_ERR_FPINF    \copydoc LC_WDTVAL_ERR_FPINF
+ *  \retval #LC_WDTVAL_ERR_RANGE    \copydoc LC_WDTVAL_ERR_RANGE
+ *  \retval #LC_WDTVAL_ERR_OPTIONS  \copydoc LC_WDTVAL_ERR_OPTIONS
  *
  *  \sa #LC_ValidateADT
  */
 int32 LC_ValidateWDT(void *TableData);
 
 /**
- * \brief Create watchpoint hash table
+ * \brief Create watchpoint dispatch index
  *
  *  \par Description
- *       Creates a hash table to optimize the process of getting direct
- *       access to all the watchpoint table entries that reference a
- *       particular MessageID without having to search the entire table.
+ *       Creates the dispatch index that gives direct access to all the
+ *       watchpoint table entries that reference a particular MessageID
+ *       without having to search the entire table. The watchpoints for
+ *       each MessageID are stored as one contiguous span, and a perfect
+ *       hash over the referenced MessageIDs locates that span with a
+ *       single probe. The index is built in the buffer packet
+ *       processing is not using and then published with
+ *       #LC_PublishIndex, so a packet never sees a partly built index.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       If no collision-free hash is found, the index still works but
+ *       MessageIDs are matched by linear search. Subscriptions are only
+ *       changed for MessageIDs added or removed since the previous index
+ *       was built.
  *
- *  \sa #LC_GetHashTableIndex, #LC_AddWatchpoint
+ *  \sa #LC_GetHashTableIndex, #LC_AddWatchpoint, #LC_BuildPerfectHash,
+ *      #LC_UpdateSubscriptions
  */
 void LC_CreateHashTable(void);
 
+/**
+ * \brief Reset results of watchpoints changed by a table load
+ *
+ *  \par Description
+ *       Compares each entry of a newly loaded watchpoint definition
+ *       table with the definition the dispatch index was last built
+ *       from, and resets the results and statistics of only the
+ *       entries that differ.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before #LC_CreateHashTable, which saves the
+ *       new definitions for the next comparison
+ *
+ *  \return Number of watchpoints that were reset
+ *
+ *  \sa #LC_ResetResultsWP
+ */
+uint16 LC_ResetChangedWatchpoints(void);
+
 /**
  * \brief Process a single watchpoint
  *
@@ -130,11 +242,566 @@ void LC_CreateHashTable(void);
  *
  *  \param [in]   BufPtr      Pointer to Software Bus buffer
  *
- *  \param [in]   Timestamp   A #CFE_TIME_SysTime_t timestamp to use
- *                            to update the watchpoint results data
+ *  \param [in]   PacketTime  Time stamp of the packet, resolved only
+ *                            if a state transition is detected
+ */
+void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Process a single compiled watchpoint
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that will evaluate
+ *       a single watchpoint using the compiled watchpoint program. The
+ *       extractor, mask, comparison value and opcode were resolved when
+ *       the table was loaded, so the Watchpoint Definition Table is not
+ *       read. Results are identical to #LC_ProcessWP.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Watchpoints that could not be compiled are passed to
+ *       #LC_ProcessWP, which reports the error.
+ *
+ *  \param [in]   Position    Position of the watchpoint in the dispatch
+ *                            index watchpoint list and compiled program
+ *
+ *  \param [in]   BufPtr      Pointer to Software Bus buffer
+ *
+ *  \param [in]   PacketTime  Time stamp of the packet, resolved only
+ *                            if a state transition is detected
+ *
+ *  \sa #LC_CompileWatchpoints
+ */
+void LC_ProcessCompiledWP(uint32 Position, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Update watchpoint results
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that stores a new
+ *       evaluation result in the Watchpoint Results Table and updates
+ *       the watchpoint statistics and transition data
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The change-only cache of the watchpoint is refreshed here, so
+ *       every evaluation path keeps it current. Only #LC_WATCH_TRUE and
+ *       #LC_WATCH_FALSE results are cached.
+ *
+ *  \param [in]   WatchIndex    The watchpoint number that was evaluated
+ *                              (zero based watchpoint definition table index)
+ *
+ *  \param [in]   WPEvalResult  The evaluation result (#LC_WATCH_TRUE, #LC_WATCH_FALSE, etc.)
+ *
+ *  \param [in]   MaskedWPData  The watchpoint data after the bitmask was
+ *                              applied, saved if a transition is detected.
+ *                              The upper half is only non-zero for 64 bit
+ *                              data types.
+ *
+ *  \param [in]   PacketTime    Time stamp of the packet, resolved only
+ *                              if a state transition is detected
+ */
+void LC_UpdateWatchResult(uint16 WatchIndex, uint8 WPEvalResult, uint64 MaskedWPData, LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Get packet time stamp
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that returns the
+ *       time stamp of the packet being processed. The time stamp of
+ *       the packet is used, or the current time if it has none.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The time is read on the first call for a packet and the same
+ *       value is returned by later calls, so a packet that changes no
+ *       watchpoint result and requests no RTS reads no time at all.
+ *
+ *  \param [in,out] PacketTime  Time stamp of the packet being processed
+ *
+ *  \return The packet time stamp
+ */
+CFE_TIME_SysTime_t LC_GetPacketTime(LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Check if a watchpoint is evaluated only on change
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that reports whether
+ *       a watchpoint may reuse its previous result while its masked
+ *       data is unchanged
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       True for every watchpoint when #LC_WATCH_CHANGE_ONLY is set
+ *
+ *  \param [in]   WatchIndex    The watchpoint number to check
+ *                              (zero based watchpoint definition table index)
+ *
+ *  \return Change-only status
+ *  \retval true   Watchpoint is evaluated only on change
+ *  \retval false  Watchpoint is evaluated on every sample
+ */
+bool LC_WatchChangeOnly(uint16 WatchIndex);
+
+/**
+ * \brief Reuse the previous result of an unchanged watchpoint
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that looks up the
+ *       change-only cache of a watchpoint. When the masked data matches
+ *       the last evaluated sample the previous result is returned and
+ *       the comparison or custom function does not need to run.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A cached result is only reused while it is still the current
+ *       watch result, so a result that went stale or was reset is
+ *       evaluated again. Each reuse increments the skipped evaluation
+ *       housekeeping counter.
+ *
+ *  \param [in]   WatchIndex       The watchpoint number to check
+ *                                 (zero based watchpoint definition table index)
+ *
+ *  \param [in]   MaskedWPData     The watchpoint data after the bitmask was
+ *                                 applied
+ *
+ *  \param [out]  WPEvalResultPtr  The previous result, only set when the
+ *                                 cache was used
+ *
+ *  \return Cache status
+ *  \retval true   Previous result reused
+ *  \retval false  Watchpoint must be evaluated
+ */
+bool LC_CheckWatchCache(uint16 WatchIndex, uint64 MaskedWPData, uint8 *WPEvalResultPtr);
+
+/**
+ * \brief Start the countdown to stale of a watchpoint result
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that sets the
+ *       countdown to stale of a watchpoint and links the watchpoint
+ *       into the stale wheel slot of the age tick on which it ends,
+ *       replacing any countdown already running
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A countdown of zero means the result never goes stale and is
+ *       the same as calling #LC_DisarmStaleTimer
+ *
+ *  \param [in]   WatchIndex    The watchpoint number to arm
+ *                              (zero based watchpoint definition table index)
+ *
+ *  \param [in]   Countdown     Sample requests that update result ages
+ *                              before the result goes stale
+ */
+void LC_ArmStaleTimer(uint16 WatchIndex, uint32 Countdown);
+
+/**
+ * \brief Stop the countdown to stale of a watchpoint result
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that unlinks a
+ *       watchpoint from the stale wheel and clears its countdown to
+ *       stale in the Watchpoint Results Table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   WatchIndex    The watchpoint number to disarm
+ *                              (zero based watchpoint definition table index)
+ */
+void LC_DisarmStaleTimer(uint16 WatchIndex);
+
+/**
+ * \brief Age watchpoint results by one sample request
+ *
+ *  \par Description
+ *       Advances the stale wheel by one age tick and sets the result
+ *       of each watchpoint whose countdown ends on that tick to
+ *       #LC_WATCH_STALE
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the watchpoints linked into one wheel slot are visited,
+ *       so the countdowns kept in the Watchpoint Results Table are
+ *       not decremented here. #LC_SyncStaleCountdowns brings them up
+ *       to date before the table is dumped or saved.
+ */
+void LC_AgeWatchResults(void);
+
+/**
+ * \brief Write the remaining countdowns to the watchpoint results table
+ *
+ *  \par Description
+ *       Sets the countdown to stale of every watchpoint linked into the
+ *       stale wheel to the number of age ticks it has left
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void LC_SyncStaleCountdowns(void);
+
+/**
+ * \brief Rebuild the stale wheel from the watchpoint results table
+ *
+ *  \par Description
+ *       Empties the stale wheel and links every watchpoint with a
+ *       nonzero countdown to stale in the Watchpoint Results Table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Used at startup, after the results table has been restored
+ *       from the Critical Data Store or set to defaults
+ */
+void LC_BuildStaleWheel(void);
+
+/**
+ * \brief Handle a message no watchpoint references
+ *
+ *  \par Description
+ *       Support function for #LC_CheckMsgForWPs that counts a message
+ *       whose MessageID no watchpoint references, reports it with a
+ *       throttled event and, when configured, unsubscribes from the
+ *       MessageID once enough such messages have been received
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The counts are kept for up to #LC_MAX_UNREF_MSGIDS MessageIDs
+ *       and are cleared when a new dispatch index is published.
+ *       #LC_MID_INF_EID is issued for the first message and then every
+ *       #LC_UNREF_EVENT_INTERVAL messages. LC unsubscribes once
+ *       #LC_UNREF_UNSUB_LIMIT messages have been received, unless the
+ *       limit is zero.
+ *
+ *  \param [in]   MessageID  MessageID of the received message
+ *
+ *  \sa #LC_UNREF_UNSUB_INF_EID, #LC_UNREF_UNSUB_ERR_EID
+ */
+void LC_HandleUnreferencedMsg(CFE_SB_MsgId_t MessageID);
+
+/**
+ * \brief Find the unreferenced message entry for a MessageID
+ *
+ *  \par Description
+ *       Support function for #LC_HandleUnreferencedMsg and
+ *       #LC_UpdateSubscriptions that returns the entry tracking a
+ *       MessageID no watchpoint references, adding one if needed
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A new entry starts with a zero message count and not marked as
+ *       subscribed
+ *
+ *  \param [in]   MessageID  MessageID to track
+ *
+ *  \return Pointer to the entry, or NULL when all
+ *          #LC_MAX_UNREF_MSGIDS entries are in use
+ */
+LC_UnrefMsg_t *LC_TrackUnrefMsg(CFE_SB_MsgId_t MessageID);
+
+/**
+ * \brief Count a watchpoint evaluation error
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that counts an
+ *       evaluation error in the watchpoint results and decides whether
+ *       the error is reported with an event
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The first #LC_WP_ERR_EVENT_LIMIT errors of a watchpoint are
+ *       reported, then one of every #LC_WP_ERR_EVENT_INTERVAL. Resetting
+ *       the watchpoint statistics clears the count and so restores the
+ *       budget.
+ *
+ *  \param [in]   WatchIndex  Watchpoint table index of the watchpoint
+ *
+ *  \return Event status
+ *  \retval true   Report the error with an event
+ *  \retval false  Only count the error
+ */
+bool LC_CountWPError(uint16 WatchIndex);
+
+/**
+ * \brief Compare a packet digest with the last one for its MessageID
+ *
+ *  \par Description
+ *       Support function for #LC_CheckMsgForWPs that digests the watched
+ *       bytes of a packet, from the first watched byte to the end of the
+ *       last one, and compares the result with the digest of the last
+ *       fully evaluated packet with the same MessageID
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing and returns false when the MessageID does not use
+ *       a digest. Otherwise the digest hit or miss housekeeping counter
+ *       is incremented, and on a miss the new digest and the watched
+ *       bytes are saved. A digest match only counts as a hit when the
+ *       saved bytes match too. The packet must be at least MaxExtent
+ *       bytes long.
+ *
+ *  \param [in]   MessageList  Dispatch index entry for the packet MessageID
+ *
+ *  \param [in]   BufPtr       Pointer to Software Bus buffer
+ *
+ *  \return Digest status
+ *  \retval true   Watched bytes unchanged, results may be reused
+ *  \retval false  Watchpoints must be evaluated
+ */
+bool LC_CheckMsgDigest(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Reuse the results of every watchpoint on an unchanged packet
+ *
+ *  \par Description
+ *       Support function for #LC_CheckMsgForWPs that applies the current
+ *       result of each watchpoint in a span again, which advances the
+ *       watchpoint statistics and stale countdown without extracting or
+ *       comparing any data
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Watchpoints whose result is stale or an error are evaluated
+ *       normally with #LC_ProcessCompiledWP
+ *
+ *  \param [in]   MessageList  Dispatch index entry for the packet MessageID
+ *
+ *  \param [in]   BufPtr       Pointer to Software Bus buffer
+ *
+ *  \param [in]   PacketTime   Time stamp of the packet, resolved only
+ *                             if a state transition is detected
+ */
+void LC_ReuseWatchResults(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr,
+                          LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Digest a range of packet bytes
+ *
+ *  \par Description
+ *       Utility function that reduces a byte range to a 64 bit digest,
+ *       reading the data a word at a time
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A change confined to one 8 byte word of the range always
+ *       changes the digest. The digest depends on the host byte order
+ *       and is only compared with digests from the same host.
+ *
+ *  \param [in]   DataPtr  Pointer to the first byte of the range
+ *
+ *  \param [in]   Length   Number of bytes in the range
+ *
+ *  \return The 64 bit digest of the range
+ */
+uint64 LC_DigestRange(const uint8 *DataPtr, uint32 Length);
+
+/**
+ * \brief Extract watchpoint data with a compiled extractor
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that reads the
+ *       watchpoint data, which may be on a misaligned address, and
+ *       widens it to 32 bits in native byte order. This is the one
+ *       extractor used by #LC_GetSizedWPData, the compiled watchpoint
+ *       program, and batch evaluation.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Extract     Extractor, one of the LC_WP_EXTRACT values
+ *
+ *  \param [in]   WPDataPtr   A pointer to the first byte of the
+ *                            watchpoint data as it exists in the
+ *                            software bus message it was received in
+ *
+ *  \return The sized watchpoint data
+ */
+uint32 LC_ExtractWPData(uint8 Extract, const uint8 *WPDataPtr);
+
+/**
+ * \name Load packet data of a fixed byte order
+ *
+ *  \par Description
+ *       Support functions for watchpoint processing that read a big
+ *       or little endian value from a possibly misaligned address and
+ *       return it in host byte order. When the host byte order is known
+ *       at compile time this is a single load, plus a byte swap if the
+ *       data order differs from the host.
+ *
+ *  \param [in]   DataPtr     Pointer to the first byte of the data
+ *
+ *  \return The value in host byte order
+ * \{
+ */
+uint16 LC_LoadBE16(const uint8 *DataPtr);
+uint16 LC_LoadLE16(const uint8 *DataPtr);
+uint32 LC_LoadBE32(const uint8 *DataPtr);
+uint32 LC_LoadLE32(const uint8 *DataPtr);
+uint64 LC_LoadBE64(const uint8 *DataPtr);
+uint64 LC_LoadLE64(const uint8 *DataPtr);
+/**\}*/
+
+/**
+ * \brief Process a batch of compiled watchpoints
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that will evaluate
+ *       a run of watchpoints that share an opcode and extractor. The
+ *       data for every watchpoint is gathered from the packet first,
+ *       the comparisons are made together by #LC_CompareWatchBatch,
+ *       and the results table is then updated from the result bitmask
+ *       in watchpoint list order. Results are identical to calling
+ *       #LC_ProcessCompiledWP for each watchpoint.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Count must not exceed #LC_WP_BATCH_LANES and the opcode must
+ *       be a relational opcode. The caller has verified the packet is
+ *       at least as long as the messageID's extent, so every watchpoint
+ *       in the batch is in bounds.
+ *
+ *  \param [in]   Position    Position of the first watchpoint in the
+ *                            dispatch index watchpoint list
+ *
+ *  \param [in]   Count       Number of watchpoints in the batch
+ *
+ *  \param [in]   BufPtr      Pointer to Software Bus buffer
+ *
+ *  \param [in]   PacketTime  Time stamp of the packet, resolved only
  *                            if a state transition is detected
+ *
+ *  \sa #LC_GroupWatchpoints
  */
-void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_SysTime_t Timestamp);
+void LC_ProcessWatchBatch(uint32 Position, uint32 Count, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime);
+
+/**
+ * \brief Compare a batch of compiled watchpoint values
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that applies one
+ *       relational opcode to each pair of values and comparison values.
+ *       Uses SSE2 or NEON instructions when the target supports them,
+ *       and #LC_CompareWatchBatchScalar for the remaining lanes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Count must not exceed #LC_WP_BATCH_LANES. Float lanes whose
+ *       value is NAN are reported in the NAN mask and must be evaluated
+ *       by #LC_OperatorCompare; their result bit is not meaningful.
+ *
+ *  \param [in]   Opcode      Relational opcode shared by every lane
+ *
+ *  \param [in]   Values      Watchpoint values, truncated to size and
+ *                            sign or zero extended
+ *
+ *  \param [in]   Compare     Compiled comparison values
+ *
+ *  \param [in]   Count       Number of lanes to compare
+ *
+ *  \param [out]  NanMaskPtr  Bit N set if lane N is a float NAN
+ *
+ *  \return Bit N set if lane N evaluated to #LC_WATCH_TRUE
+ */
+uint32 LC_CompareWatchBatch(uint8 Opcode, const uint32 *Values, const uint32 *Compare, uint32 Count,
+                            uint32 *NanMaskPtr);
+
+/**
+ * \brief Compare a batch of compiled watchpoint values one at a time
+ *
+ *  \par Description
+ *       Portable equivalent of #LC_CompareWatchBatch, used on targets
+ *       without SIMD support and for lanes that do not fill a vector
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Count must not exceed #LC_WP_BATCH_LANES
+ *
+ *  \param [in]   Opcode      Relational opcode shared by every lane
+ *
+ *  \param [in]   Values      Watchpoint values, truncated to size and
+ *                            sign or zero extended
+ *
+ *  \param [in]   Compare     Compiled comparison values
+ *
+ *  \param [in]   Count       Number of lanes to compare
+ *
+ *  \param [out]  NanMaskPtr  Bit N set if lane N is a float NAN
+ *
+ *  \return Bit N set if lane N evaluated to #LC_WATCH_TRUE
+ */
+uint32 LC_CompareWatchBatchScalar(uint8 Opcode, const uint32 *Values, const uint32 *Compare, uint32 Count,
+                                  uint32 *NanMaskPtr);
+
+/**
+ * \brief Compare one compiled watchpoint value
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that applies a
+ *       relational opcode to a watchpoint value the same way
+ *       #LC_SignedCompare, #LC_UnsignedCompare and #LC_FloatCompare do
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Float values must not be NAN
+ *
+ *  \param [in]   Opcode        Relational opcode
+ *
+ *  \param [in]   Value         Watchpoint value, truncated to size and
+ *                              sign or zero extended
+ *
+ *  \param [in]   CompareValue  Compiled comparison value
+ *
+ *  \return Comparison result
+ *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
+ *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
+ */
+uint8 LC_CompareCompiledValue(uint8 Opcode, uint32 Value, uint32 CompareValue);
+
+/**
+ * \brief Compare one compiled watchpoint value against two thresholds
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that applies a
+ *       range or hysteresis opcode to a watchpoint value the same way
+ *       #LC_RangeCompare does
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Float values must not be NAN
+ *
+ *  \param [in]   Opcode          Range or hysteresis opcode
+ *
+ *  \param [in]   Value           Watchpoint value, truncated to size
+ *                                and sign or zero extended
+ *
+ *  \param [in]   Low             Compiled comparison value
+ *
+ *  \param [in]   High            Compiled second comparison value
+ *
+ *  \param [in]   PreviousResult  Last result of the watchpoint, held by
+ *                                hysteresis between its thresholds
+ *
+ *  \return Comparison result
+ *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
+ *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
+ */
+uint8 LC_CompareCompiledRange(uint8 Opcode, uint32 Value, uint32 Low, uint32 High, uint8 PreviousResult);
+
+/**
+ * \brief Compare a batch of compiled watchpoint values against two thresholds
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that evaluates a
+ *       range or hysteresis opcode for every lane as two relational
+ *       batches through #LC_CompareWatchBatch
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Count must not exceed #LC_WP_BATCH_LANES. NAN lanes are
+ *       reported the same way as #LC_CompareWatchBatch.
+ *
+ *  \param [in]   Opcode      Range or hysteresis opcode shared by
+ *                            every lane
+ *
+ *  \param [in]   Values      Watchpoint values, truncated to size and
+ *                            sign or zero extended
+ *
+ *  \param [in]   Low         Compiled comparison values
+ *
+ *  \param [in]   High        Compiled second comparison values
+ *
+ *  \param [in]   HoldMask    Bit N set if lane N was last
+ *                            #LC_WATCH_TRUE, used by hysteresis
+ *
+ *  \param [in]   Count       Number of lanes to compare
+ *
+ *  \param [out]  NanMaskPtr  Bit N set if lane N is a float NAN
+ *
+ *  \return Bit N set if lane N evaluated to #LC_WATCH_TRUE
+ */
+uint32 LC_CompareWatchBatchRange(uint8 Opcode, const uint32 *Values, const uint32 *Low, const uint32 *High,
+                                 uint32 HoldMask, uint32 Count, uint32 *NanMaskPtr);
 
 /**
  * \brief Operator comparison
@@ -157,10 +824,11 @@ void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_Sys
  *                                 fixing that LC might have done
  *                                 according to the watchpoint definition
  *
- *  \return Operation comparison result from #LC_SignedCompare, #LC_UnsignedCompare, #LC_FloatCompare
+ *  \return Operation comparison result from #LC_SignedCompare, #LC_UnsignedCompare, #LC_FloatCompare,
+ *          #LC_DoubleCompare
  *  \retval #LC_WATCH_ERROR \copydoc LC_WATCH_ERROR
  */
-uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData);
+uint8 LC_OperatorCompare(uint16 WatchIndex, uint64 ProcessedWPData);
 
 /**
  * \brief Signed comparison
@@ -185,14 +853,14 @@ uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData);
  *
  *  \param [in] CompareValue  The comparison value specified in the
  *                            watchpoint definition table (sign
- *                            extended, if needed, in an int32)
+ *                            extended, if needed, in an int64)
  *
  *  \return Comparison result
  *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
  *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
  *  \retval #LC_WATCH_ERROR \copydoc LC_WATCH_ERROR
  */
-uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue);
+uint8 LC_SignedCompare(uint16 WatchIndex, int64 WPValue, int64 CompareValue);
 
 /**
  * \brief Unsigned comparison
@@ -217,14 +885,14 @@ uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue);
  *
  *  \param [in] CompareValue  The comparison value specified in the
  *                            watchpoint definition table (zero
- *                            extended, if needed, in an uint32)
+ *                            extended, if needed, in an uint64)
  *
  *  \return Comparison result
  *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
  *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
  *  \retval #LC_WATCH_ERROR \copydoc LC_WATCH_ERROR
  */
-uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue, uint32 CompareValue);
+uint8 LC_UnsignedCompare(uint16 WatchIndex, uint64 WPValue, uint64 CompareValue);
 
 /**
  * \brief Float comparison
@@ -261,6 +929,100 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue, uint32 CompareValue)
  */
 uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType);
 
+/**
+ * \brief Double comparison
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that will perform
+ *       a double precision floating point watchpoint data comparison
+ *       based upon the operator specified in the watchpoint definition
+ *       table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Uses the same #LC_FLOAT_TOLERANCE as #LC_FloatCompare
+ *
+ *  \param [in] WatchIndex        The watchpoint number to compare (zero
+ *                                based watchpoint definition table index)
+ *
+ *  \param [in] WPMultiType       The watchpoint data extracted from
+ *                                the message that it was contained
+ *                                in. Stored in a multi-type union.
+ *
+ *  \param [in] CompareMultiType  The comparison value specified in the
+ *                                watchpoint definition table. Stored
+ *                                in a muti-type union.
+ *
+ *  \return Comparison result
+ *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
+ *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
+ *  \retval #LC_WATCH_ERROR \copydoc LC_WATCH_ERROR
+ */
+uint8 LC_DoubleCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType);
+
+/**
+ * \brief Range comparison
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that will perform
+ *       an #LC_OPER_IN_RANGE, #LC_OPER_OUT_OF_RANGE or
+ *       #LC_OPER_HYSTERESIS comparison of watchpoint data against the
+ *       two comparison values in the watchpoint definition table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Range bounds are inclusive and use no float tolerance.
+ *       Between its thresholds a hysteresis watchpoint keeps its
+ *       last result from the watchpoint results table.
+ *
+ *  \param [in] WatchIndex        The watchpoint number to compare (zero
+ *                                based watchpoint definition table index)
+ *
+ *  \param [in] WPMultiType       The watchpoint data extracted from
+ *                                the message that it was contained
+ *                                in. Stored in a multi-type union.
+ *
+ *  \param [in] CompareMultiType  The comparison value specified in the
+ *                                watchpoint definition table. Stored
+ *                                in a muti-type union.
+ *
+ *  \param [in] SecondMultiType   The second comparison value specified
+ *                                in the watchpoint definition table.
+ *                                Stored in a muti-type union.
+ *
+ *  \return Comparison result
+ *  \retval #LC_WATCH_TRUE  \copydoc LC_WATCH_TRUE
+ *  \retval #LC_WATCH_FALSE \copydoc LC_WATCH_FALSE
+ *  \retval #LC_WATCH_ERROR \copydoc LC_WATCH_ERROR
+ */
+uint8 LC_RangeCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType,
+                      LC_MultiType_t *SecondMultiType);
+
+/**
+ * \brief Compare two watchpoint values of the same data type
+ *
+ *  \par Description
+ *       Applies a relational operator to two values of the same
+ *       watchpoint data type, reading the member of the multi-type
+ *       union that the data type uses
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Uses no float tolerance. A float NAN is unordered, so every
+ *       relation with it is false except #LC_OPER_NE.
+ *
+ *  \param [in] DataType    Watchpoint data type of both values
+ *
+ *  \param [in] OperatorID  #LC_OPER_LT through #LC_OPER_GT
+ *
+ *  \param [in] Value       Left hand value
+ *
+ *  \param [in] Reference   Right hand value
+ *
+ *  \return Boolean comparison result
+ *  \retval true  Value OperatorID Reference holds
+ *  \retval false It does not
+ */
+bool LC_MultiTypeCompare(uint8 DataType, uint8 OperatorID, const LC_MultiType_t *Value,
+                         const LC_MultiType_t *Reference);
+
 /**
  * \brief Watchpoint offset valid
  *
@@ -283,6 +1045,22 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiTy
  */
 bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Get watchpoint data size
+ *
+ *  \par Description
+ *       Support function for watchpoint processing that returns the
+ *       number of message bytes read for a watchpoint data type
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   DataType    Watchpoint data type
+ *
+ *  \return Data size in bytes, or 0 if the data type is undefined
+ */
+uint32 LC_GetWPDataSize(uint8 DataType);
+
 /**
  * \brief Get sized data
  *
@@ -290,8 +1068,10 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr);
  *       Support function for watchpoint processing that will extract
  *       the watchpoint data from a software bus message based upon the
  *       data type specified in the watchpoint definition table and
- *       store it in a uint32. If there are any endian differences between
+ *       store it in a uint64. If there are any endian differences between
  *       LC and the watchpoint data, this is where it will get fixed up.
+ *       Data types narrower than 64 bits are widened to 32 bits and
+ *       then zero extended.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -310,88 +1090,245 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr);
  *  \retval true No error
  *  \retval false An error occurred
  */
-bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedDataPtr);
+bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint64 *SizedDataPtr);
 
 /**
- * \brief Convert messageID into hash table index
+ * \brief Mix messageID bits for the dispatch index
  *
  *  \par Description
- *       Utility function for watchpoint processing that converts a
- *       messageID into an index into the watchpoint hash table.
+ *       Utility function that converts a messageID and seed into a
+ *       well mixed 32 bit value. Distinct messageIDs always produce
+ *       distinct results for the same seed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  *
- *       The following code supports use of the watchpoint hash table:
+ *  \param [in]  MessageID   SoftwareBus packet message ID
+ *
+ *  \param [in]  Seed        Hash seed
+ *
+ *  \return Mixed hash value
+ */
+uint32 LC_HashMessageID(CFE_SB_MsgId_t MessageID, uint32 Seed);
+
+/**
+ * \brief Convert messageID into hash table slot
  *
- *       1) #LC_GetHashTableIndex - convert messageID to hash table index
- *       2) #LC_CreateHashTable   - after load Watchpoint Definition Table
- *       3) #LC_AddWatchpoint     - add one watchpoint to hash table
- *       4) #LC_CheckMsgForWPs    - process all WP's that reference messageID
+ *  \par Description
+ *       Utility function for watchpoint processing that converts a
+ *       messageID into a slot in the watchpoint dispatch index.
  *
- *       The following data structures support the hash table:
+ *       The following code supports use of the dispatch index:
  *
- *       1) Hash table (256 entries)
- *       2) Array of links for messageID linked lists (LC_MAX_WATCHPOINTS)
- *       3) Array of links for watchpoint linked lists (LC_MAX_WATCHPOINTS)
+ *       1) #LC_CreateHashTable   - after load Watchpoint Definition Table
+ *       2) #LC_AddWatchpoint     - count one watchpoint for a messageID
+ *       3) #LC_BuildPerfectHash  - assign each messageID its own slot
+ *       4) #LC_GetHashTableIndex - convert messageID to hash table slot
+ *       5) #LC_FindMessageIndex  - get handler and watchpoint span for messageID
+ *       6) #LC_CheckMsgForWPs    - process all WP's that reference messageID
  *
  *       Rather than search the entire Watchpoint Definition Table to find
  *       the watchpoints that reference a particular messageID, LC does
  *       the following:
  *
- *       1) Call hash table function (convert messageID to hash table index)
- *       2) Get messageID linked list from indexed hash table entry
- *       3) Search messageID list (max 8) for matching messageID
- *       4) Get watchpoint linked list from matching messageID link
- *       5) Done - only watchpoints that reference messageID are in list
+ *       1) Hash the messageID, the low bits select a displacement bucket
+ *       2) Combine the high bits with the bucket displacement to get a slot
+ *       3) Compare the messageID stored for that slot (one compare)
+ *       4) Process the contiguous span of watchpoints for that messageID
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The result is only meaningful for messageIDs that were in the
+ *       table when the index was built. Other messageIDs map to an empty
+ *       slot or to a slot owned by a different messageID.
  *
  *  \param [in]  MessageID   SoftwareBus packet message ID
  *
- *  \return Index into watchpoint hash table
+ *  \return Index into watchpoint hash table slots
  */
 uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID);
 
 /**
- * \brief Add one watchpoint linked list entry during creation of hash table
+ * \brief Find the dispatch index entry for a messageID
  *
  *  \par Description
- *       Utility function that adds another link to the watchpoint linked list
- *       for the specified messageID. The function will also add a messageID
- *       linked list entry to the hash table if this is the first reference
- *       to that messageID. The function will also subscribe to the messageID
- *       if this is the first reference to that messageID. The function will
- *       return a pointer to the watchpoint linked list entry just added.
+ *       Utility function that returns the dispatch index entry holding
+ *       the handler for the specified messageID and the span of
+ *       watchpoints that reference it.
  *
- *       The following code supports use of the watchpoint hash table:
+ *  \par Assumptions, External Events, and Notes:
+ *       None
  *
- *       1) #LC_GetHashTableIndex - convert messageID to hash table index
- *       2) #LC_CreateHashTable   - after load Watchpoint Definition Table
- *       3) #LC_AddWatchpoint     - add one watchpoint to hash table
- *       4) #LC_CheckMsgForWPs    - process all WP's that reference messageID
+ *  \param [in]  MessageID   SoftwareBus packet message ID
  *
- *       The following data structures support the hash table:
+ *  \return Pointer to the dispatch index entry, NULL if the messageID
+ *           is neither referenced by any watchpoint nor handled by LC
+ */
+LC_MessageList_t *LC_FindMessageIndex(CFE_SB_MsgId_t MessageID);
+
+/**
+ * \brief Find the build lookup slot for a messageID
  *
- *       1) Hash table (256 entries)
- *       2) Array of links for messageID linked lists (LC_MAX_WATCHPOINTS)
- *       3) Array of links for watchpoint linked lists (LC_MAX_WATCHPOINTS)
+ *  \par Description
+ *       Utility function used while the dispatch index is created. It
+ *       returns the build lookup slot that either already holds the
+ *       message index for the messageID or is empty and may be used
+ *       to add it.
  *
- *       Rather than search the entire Watchpoint Definition Table to find
- *       the watchpoints that reference a particular messageID, LC does
- *       the following:
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  MessageID   SoftwareBus packet message ID
  *
- *       1) Call hash table function (convert messageID to hash table index)
- *       2) Get messageID linked list from indexed hash table entry
- *       3) Search messageID list (max 8) for matching messageID
- *       4) Get watchpoint linked list from matching messageID link
- *       5) Done - only watchpoints that reference messageID are in list
+ *  \return Index into the build lookup table
+ */
+uint32 LC_FindBuildSlot(CFE_SB_MsgId_t MessageID);
+
+/**
+ * \brief Add one watchpoint during creation of the dispatch index
+ *
+ *  \par Description
+ *       Utility function that counts another watchpoint for the specified
+ *       messageID. The function will also add a dispatch index entry
+ *       if this is the first reference to that messageID. The watchpoint
+ *       spans are assigned after all watchpoints have been counted.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
  *  \param [in]  MessageID   SoftwareBus packet message ID
  *
- *  \return Pointer to the watchpoint linked list entry just added
+ *  \return Index of the dispatch index entry for the messageID
+ */
+uint16 LC_AddWatchpoint(const CFE_SB_MsgId_t MessageID);
+
+/**
+ * \brief Add one of LC's own MessageIDs to the dispatch index
+ *
+ *  \par Description
+ *       Utility function that adds a dispatch index entry for one of
+ *       the MessageIDs LC handles itself and records its handler, so
+ *       the command pipe resolves every MessageID with one lookup.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #LC_CreateHashTable after all watchpoints have been
+ *       counted. Watchpoints that reference the MessageID keep their
+ *       span but are not evaluated, as the handler takes precedence.
+ *
+ *  \param [in]  MessageID   SoftwareBus packet message ID
+ *
+ *  \param [in]  Handler     How the MessageID is processed, one of
+ *                           the LC_MSG_HANDLER definitions
+ */
+void LC_AddHandlerMID(CFE_SB_MsgId_t MessageID, uint8 Handler);
+
+/**
+ * \brief Bring the watchpoint subscriptions up to date
+ *
+ *  \par Description
+ *       Utility function that unsubscribes from the messageIDs of the
+ *       active dispatch index that the index being built no longer
+ *       references, and subscribes to the messageIDs that are new to
+ *       it. MessageIDs referenced by both are left subscribed, so their
+ *       packets keep flowing while a table is loaded.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #LC_CreateHashTable while the build lookup table still
+ *       holds the new messageIDs. A messageID that could not be
+ *       unsubscribed from is marked in the unreferenced message table,
+ *       and is not subscribed to again when a later table references
+ *       it. A messageID LC unsubscribed from because it was unreferenced
+ *       is subscribed to again.
+ */
+void LC_UpdateSubscriptions(void);
+
+/**
+ * \brief Switch packet processing to the newly built dispatch index
+ *
+ *  \par Description
+ *       Utility function that makes the index built by
+ *       #LC_CreateHashTable the active one with a single pointer
+ *       store. The previously active index becomes the buffer the
+ *       next table load is built into.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packet digests are cleared because they are kept by message
+ *       list position, which the new index may assign differently.
+ *       Unreferenced message counts start over, keeping only the
+ *       messageIDs still subscribed to after a failed unsubscribe.
+ */
+void LC_PublishIndex(void);
+
+/**
+ * \brief Build the perfect hash over the referenced messageIDs
+ *
+ *  \par Description
+ *       Utility function that assigns every referenced messageID its own
+ *       hash table slot using hash and displace. MessageIDs are grouped
+ *       into buckets, largest buckets are placed first, and each bucket
+ *       gets the first displacement that moves all of its members into
+ *       empty slots. If a bucket cannot be placed, a new seed is tried,
+ *       up to #LC_HASH_MAX_SEEDS times.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Boolean build result
+ *  \retval true  Every messageID has its own slot
+ *  \retval false No seed produced a collision-free hash
+ */
+bool LC_BuildPerfectHash(void);
+
+/**
+ * \brief Compile the watchpoint definitions
+ *
+ *  \par Description
+ *       Utility function that turns the watchpoints in the dispatch
+ *       index into the compiled watchpoint program. Each entry gets
+ *       its packet offset, bitmask, extractor, and opcode, plus the
+ *       comparison value widened to 32 bits. The entries are stored
+ *       in the same order as the dispatch index watchpoint list, so
+ *       the watchpoints for one messageID occupy contiguous memory.
+ *       Each messageID's extent, the packet length that puts all of its
+ *       watchpoints in bounds, is also computed here.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #LC_CreateHashTable after the dispatch index is built
+ *
+ *  \sa #LC_ProcessCompiledWP
+ */
+void LC_CompileWatchpoints(void);
+
+/**
+ * \brief Compile one watchpoint definition
+ *
+ *  \par Description
+ *       Utility function that fills in the compiled watchpoint program
+ *       entry for one position of the dispatch index watchpoint list
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The run length is reset to 1; #LC_GroupWatchpoints sets it
+ *
+ *  \param [in]   Position    Position in the dispatch index watchpoint list
+ *
+ *  \sa #LC_CompileWatchpoints
+ */
+void LC_CompileWatchpoint(uint32 Position);
+
+/**
+ * \brief Group each messageID's watchpoints for batch evaluation
+ *
+ *  \par Description
+ *       Utility function that sorts the watchpoints in each messageID's
+ *       span of the dispatch index so watchpoints with the same opcode
+ *       and extractor are adjacent, keeping table order within a group.
+ *       The run length of each relational watchpoint is then set to the
+ *       number of like watchpoints from it to the end of its group.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #LC_CreateHashTable after #LC_CompileWatchpoints
+ *
+ *  \sa #LC_ProcessWatchBatch
  */
-LC_WatchPtList_t *LC_AddWatchpoint(const CFE_SB_MsgId_t MessageID);
+void LC_GroupWatchpoints(void);
 
 #endif
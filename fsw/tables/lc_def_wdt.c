@@ -81,6 +81,23 @@
 **        .ComparisonValue.Unsigned32 = 1050000,
 **    },
 **
+** A temperature that sets its watchpoint when it rises to 45 degrees
+** and clears it only once it falls back to 40 degrees, so a reading
+** that hovers at the limit does not toggle the result:
+**
+**    ** #160 (Battery - over temperature with hysteresis) **
+**    {
+**        .DataType                   = LC_DATA_WATCH_FLOAT_BE,
+**        .OperatorID                 = LC_OPER_HYSTERESIS,
+**        .MessageID                  = EPS_HK_TLM_MID,
+**        .WatchpointOffset           = 40,
+**        .BitMask                    = LC_BITMASK_NONE,
+**        .CustomFuncArgument         = 0,
+**        .ResultAgeWhenStale         = 0,
+**        .ComparisonValue.Float32    = 45.0,
+**        .SecondComparisonValue.Float32 = 40.0,
+**    },
+**
 *************************************************************************/
 
 /*************************************************************************
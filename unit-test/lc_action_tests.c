@@ -34,6 +34,7 @@
 #include "lc_version.h"
 #include "lc_test_utils.h"
 #include "lc_utils.h"
+#include "lc_watch.h"
 #include "lc_custom.h"
 #include "lc_platform_cfg.h"
 
@@ -44,6 +45,7 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#include <time.h>
 
 uint8 call_count_CFE_EVS_SendEvent;
 
@@ -92,11 +94,111 @@ void LC_SampleAPs_Test_MultiActionPointNominal(void)
     uint16 StartIndex = 0;
     uint16 EndIndex   = 1;
 
+    LC_OperData.APImmediate.EvalCount[0] = 3;
+    LC_OperData.APImmediate.EvalCount[1] = 3;
+    LC_OperData.APImmediate.EvalCount[2] = 3;
+
     /* Execute the function being tested */
     LC_SampleAPs(StartIndex, EndIndex);
 
     /* Verify results */
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 0);
+
+    /* Immediate evaluations renewed for the sampled actionpoints only */
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[2], 3);
+}
+
+void LC_SampleAPs_Test_HighWater(void)
+{
+    LC_OperData.ActionHighWater = 2;
+
+    LC_OperData.APImmediate.EvalCount[0] = 3;
+    LC_OperData.APImmediate.EvalCount[1] = 3;
+    LC_OperData.APImmediate.EvalCount[2] = 3;
+
+    /* Execute the function being tested */
+    LC_SampleAPs(0, LC_MAX_ACTIONPOINTS - 1);
+
+    /* Verify results, nothing past the last actionpoint in use is touched */
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[2], 3);
+}
+
+void LC_SampleAPs_Test_ScalingBenchmark(void)
+{
+    static const uint32 FillPercent[] = { 25, 50, 100 };
+    uint32              Samples       = 20000;
+    uint32              Sample;
+    uint32              Fill;
+    uint32              APCount;
+    uint16              TableIndex;
+    clock_t             Start;
+    double              SingleNs;
+    double              AllNs;
+
+    /* Only the number of events is checked, not their content */
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), NULL, NULL);
+
+    for (Fill = 0; Fill < sizeof(FillPercent) / sizeof(FillPercent[0]); Fill++)
+    {
+        APCount = (LC_MAX_ACTIONPOINTS * FillPercent[Fill]) / 100;
+
+        memset(LC_OperData.ARTPtr, 0, sizeof(LC_ARTEntry_t) * LC_MAX_ACTIONPOINTS);
+        memset(LC_OperData.WRTPtr, 0, sizeof(LC_WRTEntry_t) * LC_MAX_WATCHPOINTS);
+
+        /* Each actionpoint in use watches its own watchpoint, the rest are unused */
+        for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++)
+        {
+            memset(&LC_OperData.ADTPtr[TableIndex], 0, sizeof(LC_ADTEntry_t));
+
+            if (TableIndex < APCount)
+            {
+                LC_OperData.ADTPtr[TableIndex].DefaultState      = LC_APSTATE_ACTIVE;
+                LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 0xFFFF;
+                LC_OperData.ADTPtr[TableIndex].RPNEquation[0]    = TableIndex % LC_MAX_WATCHPOINTS;
+                LC_OperData.ADTPtr[TableIndex].RPNEquation[1]    = LC_RPN_EQUAL;
+                LC_OperData.ARTPtr[TableIndex].CurrentState      = LC_APSTATE_ACTIVE;
+            }
+            else
+            {
+                LC_OperData.ADTPtr[TableIndex].DefaultState = LC_APSTATE_NOT_USED;
+                LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_NOT_USED;
+            }
+        }
+
+        LC_CompileActionpoints();
+        UtAssert_UINT32_EQ(LC_OperData.ActionHighWater, APCount);
+
+        /* One actionpoint whose watchpoint changes before every sample */
+        Start = clock();
+        for (Sample = 0; Sample < Samples; Sample++)
+        {
+            LC_OperData.WRTPtr[0].WatchResult = (uint8)(Sample & 1);
+            LC_WatchResultChanged(0);
+            LC_SampleAPs(0, 0);
+        }
+        SingleNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / Samples;
+
+        UtAssert_UINT32_EQ(LC_OperData.ARTPtr[0].PassToFailCount, Samples / 2);
+
+        /* Every actionpoint in use, reported per actionpoint */
+        Start = clock();
+        for (Sample = 0; Sample < Samples / 10; Sample++)
+        {
+            LC_SampleAPs(0, LC_MAX_ACTIONPOINTS - 1);
+        }
+        AllNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / (Samples / 10) / APCount;
+
+        UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APCount - 1].CumulativeFailCount, 0);
+
+        UtPrintf("Sample at %3u%% fill (%4u APs): one AP %6.2f ns, all APs %6.2f ns per AP",
+                 (unsigned int)FillPercent[Fill], (unsigned int)APCount, SingleNs, AllNs);
+    }
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void LC_SampleAPs_Test_SingleActionPointPermOff(void)
@@ -552,6 +654,54 @@ void LC_SampleSingleAP_Test_ConsecutivePass(void)
                   "LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 0");
 }
 
+void LC_SampleSingleAP_Test_SkipUnchanged(void)
+{
+    uint16 APNumber = 0;
+
+    LC_AppData.CurrentLCState                      = LC_STATE_PASSIVE;
+    LC_OperData.ARTPtr[APNumber].CurrentState      = LC_APSTATE_ACTIVE;
+    LC_OperData.ARTPtr[APNumber].ActionResult      = LC_ACTION_PASS;
+    LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS = 2;
+
+    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+
+    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+
+    LC_CompileActionpoints();
+    LC_OperData.CDSDirty = 0;
+
+    /* Execute the function being tested */
+    LC_SampleSingleAP(APNumber);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_FAIL);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.APSkipCount, 0);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ART);
+
+    /* Watchpoint result unchanged: reuse FAIL, but still count toward the RTS */
+    LC_SampleSingleAP(APNumber);
+
+    UtAssert_UINT32_EQ(LC_AppData.APSampleCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.APSkipCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_FAIL);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].CumulativeFailCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].CurrentState, LC_APSTATE_PASSIVE);
+    UtAssert_UINT32_EQ(LC_AppData.PassiveRTSExecCount, 1);
+
+    /* Watchpoint result changed: evaluate again */
+    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
+    LC_WatchResultChanged(0);
+
+    LC_SampleSingleAP(APNumber);
+
+    UtAssert_UINT32_EQ(LC_OperData.APSkipCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_PASS);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount, 0);
+}
+
 void LC_EvaluateRPN_Test_AndWatchFalseOp1(void)
 {
     uint8  Result;
@@ -1246,6 +1396,546 @@ void LC_EvaluateRPN_Test_PushPopFail(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void LC_EvaluateRPN_Test_Compiled(void)
+{
+    /* Equation no longer legal, but the compiled program is used */
+    LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[0].RPNEquation[1] = 1;
+    LC_OperData.ADTPtr[0].RPNEquation[2] = LC_RPN_OR;
+    LC_OperData.ADTPtr[0].RPNEquation[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
+    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_TRUE;
+
+    LC_CompileActionpoints();
+
+    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_MAX_WATCHPOINTS;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(LC_EvaluateRPN(0), LC_ACTION_FAIL);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_RunRPNProgram_Test_MatchesInterpreter(void)
+{
+    const uint8 Values[] = {LC_WATCH_FALSE, LC_WATCH_TRUE, LC_WATCH_ERROR, LC_WATCH_STALE};
+
+    const uint16 Equations[][LC_MAX_RPN_EQU_SIZE] = {
+        {0, LC_RPN_EQUAL},
+        {0, 1, LC_RPN_AND, 2, LC_RPN_OR, LC_RPN_EQUAL},
+        {0, 1, 2, LC_RPN_AND, LC_RPN_OR, LC_RPN_NOT, LC_RPN_EQUAL},
+        {0, 1, LC_RPN_XOR, 2, LC_RPN_AND, LC_RPN_EQUAL},
+        {0, LC_RPN_NOT, 1, LC_RPN_OR, 2, LC_RPN_OR, LC_RPN_EQUAL},
+        {0, 1, LC_RPN_OR, 2, 1, LC_RPN_AND, LC_RPN_AND, 0, LC_RPN_XOR, LC_RPN_EQUAL},
+        {0, 1, LC_RPN_AND, LC_RPN_NOT, 2, LC_RPN_NOT, LC_RPN_OR, 1, LC_RPN_AND, LC_RPN_EQUAL},
+        {0, 1, 2, LC_RPN_AND, LC_RPN_AND, 1, LC_RPN_AND, LC_RPN_EQUAL},
+        {0, 1, LC_RPN_OR, 2, LC_RPN_OR, 0, LC_RPN_OR, LC_RPN_EQUAL}};
+
+    uint32 NumValues    = sizeof(Values) / sizeof(Values[0]);
+    uint32 NumEquations = sizeof(Equations) / sizeof(Equations[0]);
+    uint32 Equation;
+    uint32 Combination;
+    uint32 Mismatches;
+
+    for (Equation = 0; Equation < NumEquations; Equation++)
+    {
+        memcpy(LC_OperData.ADTPtr[0].RPNEquation, Equations[Equation], sizeof(Equations[Equation]));
+
+        LC_OperData.RPNProgram.Length[0] =
+            LC_CompileRPN(LC_OperData.ADTPtr[0].RPNEquation, LC_OperData.RPNProgram.Code[0]);
+        UtAssert_UINT32_GT(LC_OperData.RPNProgram.Length[0], 0);
+        LC_ClassifyRPN(0);
+
+        /* Every combination of results for watchpoints 0, 1 and 2 */
+        Mismatches = 0;
+        for (Combination = 0; Combination < (NumValues * NumValues * NumValues); Combination++)
+        {
+            LC_OperData.WRTPtr[0].WatchResult = Values[Combination % NumValues];
+            LC_OperData.WRTPtr[1].WatchResult = Values[(Combination / NumValues) % NumValues];
+            LC_OperData.WRTPtr[2].WatchResult = Values[Combination / (NumValues * NumValues)];
+            LC_BuildWatchPlanes();
+
+            if ((LC_RunRPNProgram(0) != LC_InterpretRPN(0)) || (LC_EvaluateRPN(0) != LC_InterpretRPN(0)))
+            {
+                Mismatches++;
+            }
+        }
+
+        UtAssert_UINT32_EQ(Mismatches, 0);
+    }
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CompileRPN_Test_ShortCircuit(void)
+{
+    LC_RPNInstr_t Code[LC_RPN_PROGRAM_SIZE];
+    uint16        Equation[LC_MAX_RPN_EQU_SIZE] = {0, 1, LC_RPN_AND, 2, LC_RPN_AND, 3, LC_RPN_OR, LC_RPN_EQUAL};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(LC_CompileRPN(Equation, Code), 11);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Code[0].Opcode, LC_RPN_OP_LOAD);
+    UtAssert_UINT32_EQ(Code[0].Operand, 0);
+    UtAssert_UINT32_EQ(Code[1].Opcode, LC_RPN_OP_JUMP_FALSE);
+    UtAssert_UINT32_EQ(Code[2].Opcode, LC_RPN_OP_LOAD);
+    UtAssert_UINT32_EQ(Code[2].Operand, 1);
+    UtAssert_UINT32_EQ(Code[3].Opcode, LC_RPN_OP_AND);
+    UtAssert_UINT32_EQ(Code[4].Opcode, LC_RPN_OP_JUMP_FALSE);
+    UtAssert_UINT32_EQ(Code[5].Opcode, LC_RPN_OP_LOAD);
+    UtAssert_UINT32_EQ(Code[5].Operand, 2);
+    UtAssert_UINT32_EQ(Code[6].Opcode, LC_RPN_OP_AND);
+    UtAssert_UINT32_EQ(Code[7].Opcode, LC_RPN_OP_JUMP_TRUE);
+    UtAssert_UINT32_EQ(Code[8].Opcode, LC_RPN_OP_LOAD);
+    UtAssert_UINT32_EQ(Code[8].Operand, 3);
+    UtAssert_UINT32_EQ(Code[9].Opcode, LC_RPN_OP_OR);
+    UtAssert_UINT32_EQ(Code[10].Opcode, LC_RPN_OP_END);
+
+    /* A false first operand skips straight past both ANDs and the OR test */
+    UtAssert_UINT32_EQ(Code[1].Operand, 8);
+    UtAssert_UINT32_EQ(Code[4].Operand, 8);
+    UtAssert_UINT32_EQ(Code[7].Operand, 10);
+}
+
+void LC_CompileRPN_Test_Invalid(void)
+{
+    LC_RPNInstr_t Code[LC_RPN_PROGRAM_SIZE];
+    uint16        Equation[LC_MAX_RPN_EQU_SIZE] = {0, LC_RPN_AND, LC_RPN_EQUAL};
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(LC_CompileRPN(Equation, Code), 0);
+}
+
+void LC_CompileActionpoints_Test_Nominal(void)
+{
+    uint32 TableIndex;
+
+    /* Actionpoint 2 is the last one in use, the gap before it does not matter */
+    for (TableIndex = 1; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++)
+    {
+        if (TableIndex != 2)
+        {
+            LC_OperData.ADTPtr[TableIndex].DefaultState = LC_APSTATE_NOT_USED;
+        }
+    }
+
+    LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[0].ActionOptions = LC_ACTION_OPT_IMMEDIATE;
+
+    /* A stale program for an entry that no longer compiles */
+    LC_OperData.RPNProgram.Length[1] = 2;
+    LC_OperData.ADTPtr[1].ActionOptions = LC_ACTION_OPT_IMMEDIATE;
+
+    /* Left over from the previous table */
+    LC_OperData.APImmediate.Pending[0]   = 0xFFFFFFFF;
+    LC_OperData.APImmediate.EvalCount[0] = 1;
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.Length[0], 2);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.Length[1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.Length[LC_MAX_ACTIONPOINTS - 1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.ActionHighWater, 3);
+
+    /* Only a compiled equation can be evaluated immediately */
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.Enabled[0], LC_BIT_MASK(0));
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.Pending[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.EvalCount[0], 0);
+}
+
+void LC_ClassifyRPN_Test_Forms(void)
+{
+    const uint16 Equations[][LC_MAX_RPN_EQU_SIZE] = {
+        {0, LC_RPN_EQUAL},
+        {0, 40, LC_RPN_AND, LC_MAX_WATCHPOINTS - 1, LC_RPN_AND, LC_RPN_EQUAL},
+        {0, 40, LC_RPN_OR, 0, LC_RPN_OR, LC_RPN_EQUAL},
+        {0, 40, LC_RPN_AND, 1, LC_RPN_OR, LC_RPN_EQUAL},
+        {0, 40, LC_RPN_XOR, LC_RPN_EQUAL},
+        {0, LC_RPN_NOT, LC_RPN_EQUAL}};
+    const uint8 Forms[] = {LC_RPN_FORM_ALL,     LC_RPN_FORM_ALL,     LC_RPN_FORM_ANY,
+                           LC_RPN_FORM_PROGRAM, LC_RPN_FORM_PROGRAM, LC_RPN_FORM_PROGRAM};
+    uint32      Equation;
+
+    for (Equation = 0; Equation < sizeof(Forms); Equation++)
+    {
+        memcpy(LC_OperData.ADTPtr[Equation].RPNEquation, Equations[Equation], sizeof(Equations[Equation]));
+    }
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    for (Equation = 0; Equation < sizeof(Forms); Equation++)
+    {
+        UtAssert_UINT32_EQ(LC_OperData.RPNProgram.Form[Equation], Forms[Equation]);
+    }
+
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.WatchMask[0][0], 1);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.WatchMask[1][0], 1);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.WatchMask[1][1], LC_BIT_MASK(40));
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.WatchMask[1][LC_BIT_WORD(LC_MAX_WATCHPOINTS - 1)],
+                       LC_BIT_MASK(LC_MAX_WATCHPOINTS - 1));
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.WatchMask[2][0], 1);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.WatchMask[2][1], LC_BIT_MASK(40));
+
+    /* The mask words evaluated span the referenced watchpoints */
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.MaskStart[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.MaskEnd[0], 1);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.MaskStart[1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.MaskEnd[1], LC_WATCH_PLANE_WORDS);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.MaskStart[2], 0);
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.MaskEnd[2], 2);
+
+    /* Not compiled */
+    UtAssert_UINT32_EQ(LC_OperData.RPNProgram.Form[LC_MAX_ACTIONPOINTS - 1], LC_RPN_FORM_PROGRAM);
+}
+
+void LC_EvaluateWatchMask_Test_All(void)
+{
+    uint16 APNumber = 0;
+
+    LC_OperData.RPNProgram.Form[APNumber]         = LC_RPN_FORM_ALL;
+    LC_OperData.RPNProgram.WatchMask[APNumber][0] = LC_BIT_MASK(3);
+    LC_OperData.RPNProgram.WatchMask[APNumber][1] = LC_BIT_MASK(40);
+    LC_OperData.RPNProgram.MaskStart[APNumber]    = 0;
+    LC_OperData.RPNProgram.MaskEnd[APNumber]      = 2;
+
+    LC_OperData.WRTPtr[3].WatchResult  = LC_WATCH_TRUE;
+    LC_OperData.WRTPtr[40].WatchResult = LC_WATCH_TRUE;
+    LC_BuildWatchPlanes();
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_FAIL);
+
+    /* Verify results */
+    LC_OperData.WRTPtr[40].WatchResult = LC_WATCH_STALE;
+    LC_WatchResultChanged(40);
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_STALE);
+
+    LC_OperData.WRTPtr[3].WatchResult = LC_WATCH_ERROR;
+    LC_WatchResultChanged(3);
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_ERROR);
+
+    LC_OperData.WRTPtr[40].WatchResult = LC_WATCH_FALSE;
+    LC_WatchResultChanged(40);
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_PASS);
+}
+
+void LC_EvaluateWatchMask_Test_Any(void)
+{
+    uint16 APNumber = 0;
+
+    LC_OperData.RPNProgram.Form[APNumber]         = LC_RPN_FORM_ANY;
+    LC_OperData.RPNProgram.WatchMask[APNumber][0] = LC_BIT_MASK(3);
+    LC_OperData.RPNProgram.WatchMask[APNumber][1] = LC_BIT_MASK(40);
+    LC_OperData.RPNProgram.MaskStart[APNumber]    = 0;
+    LC_OperData.RPNProgram.MaskEnd[APNumber]      = 2;
+
+    /* Watchpoints outside the mask are ignored */
+    LC_OperData.WRTPtr[4].WatchResult = LC_WATCH_TRUE;
+    LC_BuildWatchPlanes();
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_PASS);
+
+    /* Verify results */
+    LC_OperData.WRTPtr[3].WatchResult = LC_WATCH_STALE;
+    LC_WatchResultChanged(3);
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_STALE);
+
+    LC_OperData.WRTPtr[40].WatchResult = LC_WATCH_ERROR;
+    LC_WatchResultChanged(40);
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_ERROR);
+
+    LC_OperData.WRTPtr[3].WatchResult = LC_WATCH_TRUE;
+    LC_WatchResultChanged(3);
+    UtAssert_UINT32_EQ(LC_EvaluateWatchMask(APNumber), LC_ACTION_FAIL);
+}
+
+void LC_BuildWatchPlanes_Test_Nominal(void)
+{
+    LC_OperData.WRTPtr[0].WatchResult                      = LC_WATCH_TRUE;
+    LC_OperData.WRTPtr[33].WatchResult                     = LC_WATCH_ERROR;
+    LC_OperData.WRTPtr[LC_MAX_WATCHPOINTS - 1].WatchResult = LC_WATCH_STALE;
+
+    /* Left over from an earlier table */
+    LC_OperData.WatchPlanes.True[1] = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    LC_BuildWatchPlanes();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.WatchPlanes.True[0], 1);
+    UtAssert_UINT32_EQ(LC_OperData.WatchPlanes.True[1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.WatchPlanes.Error[1], LC_BIT_MASK(33));
+
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(0), LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(1), LC_WATCH_FALSE);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(33), LC_WATCH_ERROR);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(LC_MAX_WATCHPOINTS - 1), LC_WATCH_STALE);
+}
+
+void LC_BuildWatchPlanes_Test_UnknownResult(void)
+{
+    LC_OperData.WRTPtr[0].WatchResult = 99;
+    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_FALSE;
+
+    /* Execute the function being tested */
+    LC_BuildWatchPlanes();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(0), LC_WATCH_ERROR);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(1), LC_WATCH_FALSE);
+}
+
+void LC_BuildAPDepends_Test_Nominal(void)
+{
+    /* AP 0 uses watchpoint 0 twice, AP 1 does not compile */
+    LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[0].RPNEquation[1] = 1;
+    LC_OperData.ADTPtr[0].RPNEquation[2] = LC_RPN_AND;
+    LC_OperData.ADTPtr[0].RPNEquation[3] = 0;
+    LC_OperData.ADTPtr[0].RPNEquation[4] = LC_RPN_OR;
+    LC_OperData.ADTPtr[0].RPNEquation[5] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].RPNEquation[0] = 2;
+    LC_OperData.ADTPtr[1].RPNEquation[1] = LC_RPN_NOT;
+
+    LC_OperData.ADTPtr[2].RPNEquation[0] = 1;
+    LC_OperData.ADTPtr[2].RPNEquation[1] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefStart[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefStart[1], 1);
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefStart[2], 3);
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefStart[3], 3);
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefStart[LC_MAX_WATCHPOINTS], 3);
+
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefList[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefList[1], 0);
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.RefList[2], 2);
+
+    /* Everything is evaluated once after a load */
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(0));
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(2));
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(LC_MAX_ACTIONPOINTS - 1));
+}
+
+void LC_WatchResultChanged_Test_Nominal(void)
+{
+    LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[1].RPNEquation[1] = 1;
+    LC_OperData.ADTPtr[1].RPNEquation[2] = LC_RPN_XOR;
+    LC_OperData.ADTPtr[1].RPNEquation[3] = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+    memset(LC_OperData.APDepends.Dirty, 0, sizeof(LC_OperData.APDepends.Dirty));
+    LC_OperData.CDSDirty = 0;
+
+    /* Execute the function being tested */
+    LC_WatchResultChanged(1);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(LC_APNeedsEval(0));
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(1));
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_WRT);
+
+    LC_WatchResultChanged(0);
+
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(0));
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(1));
+
+    /* Watchpoint with no dependents */
+    LC_WatchResultChanged(2);
+
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.Dirty[0], 0);
+
+    /* The packed result follows the results table */
+    LC_OperData.WRTPtr[2].WatchResult = LC_WATCH_TRUE;
+    LC_WatchResultChanged(2);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(2), LC_WATCH_TRUE);
+
+    LC_OperData.WRTPtr[2].WatchResult = LC_WATCH_STALE;
+    LC_WatchResultChanged(2);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(2), LC_WATCH_STALE);
+    UtAssert_UINT32_EQ(LC_OperData.WatchPlanes.True[0], 0);
+
+    /* A result that is not valid is an error */
+    LC_OperData.WRTPtr[2].WatchResult = 99;
+    LC_WatchResultChanged(2);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(2), LC_WATCH_ERROR);
+    UtAssert_UINT32_EQ(LC_OperData.WatchPlanes.Stale[0], 0);
+
+    LC_OperData.WRTPtr[2].WatchResult = LC_WATCH_FALSE;
+    LC_WatchResultChanged(2);
+    UtAssert_UINT32_EQ(LC_GetPlaneResult(2), LC_WATCH_FALSE);
+}
+
+/* Returns the elapsed time UserObj points to */
+void UT_Handler_CFE_TIME_Subtract(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t Elapsed = *(CFE_TIME_SysTime_t *)UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, Elapsed);
+}
+
+void LC_QueueImmediateAPs_Test_Nominal(void)
+{
+    /* Both reference watchpoint 0, only AP 1 is immediate */
+    LC_OperData.ADTPtr[0].RPNEquation[0] = 0;
+    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].RPNEquation[0] = 1;
+    LC_OperData.ADTPtr[1].RPNEquation[1] = 0;
+    LC_OperData.ADTPtr[1].RPNEquation[2] = LC_RPN_OR;
+    LC_OperData.ADTPtr[1].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_OperData.ADTPtr[1].ActionOptions  = LC_ACTION_OPT_IMMEDIATE;
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested */
+    LC_QueueImmediateAPs(2);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.Pending[0], 0);
+
+    LC_QueueImmediateAPs(0);
+
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.Pending[0], LC_BIT_MASK(1));
+}
+
+void LC_RunImmediateAPs_Test_Nominal(void)
+{
+    LC_PacketTime_t    PacketTime = {.Timestamp = {.Seconds = 3, .Subseconds = 0}, .Resolved = true};
+    CFE_TIME_SysTime_t Elapsed    = {.Seconds = 2, .Subseconds = 0};
+    uint16             APNumber   = 1;
+
+    LC_OperData.ADTPtr[APNumber].RPNEquation[0]    = 0;
+    LC_OperData.ADTPtr[APNumber].RPNEquation[1]    = LC_RPN_EQUAL;
+    LC_OperData.ADTPtr[APNumber].ActionOptions     = LC_ACTION_OPT_IMMEDIATE;
+    LC_OperData.ADTPtr[APNumber].MaxImmediateEvals = 1;
+    LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS = 1;
+
+    LC_OperData.ARTPtr[APNumber].CurrentState = LC_APSTATE_ACTIVE;
+    LC_OperData.ARTPtr[APNumber].ActionResult = LC_ACTION_PASS;
+    LC_AppData.CurrentLCState                 = LC_STATE_ACTIVE;
+
+    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+
+    LC_CompileActionpoints();
+    LC_QueueImmediateAPs(0);
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Elapsed);
+
+    /* Execute the function being tested */
+    LC_RunImmediateAPs(&PacketTime);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.ImmediateAPCount, 1);
+    UtAssert_UINT32_EQ(LC_AppData.APSampleCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].ActionResult, LC_ACTION_FAIL);
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.LastRTSLatency, 2000000);
+    UtAssert_UINT32_EQ(LC_OperData.PeakRTSLatency, 2000000);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.Pending[0], 0);
+
+    /* Over the limit until the next sample request */
+    LC_QueueImmediateAPs(0);
+    LC_RunImmediateAPs(&PacketTime);
+
+    UtAssert_UINT32_EQ(LC_OperData.ImmediateAPCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.ImmediateDeferCount, 1);
+    UtAssert_UINT32_EQ(LC_AppData.APSampleCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.APImmediate.Pending[0], 0);
+
+    LC_SampleAPs(APNumber, APNumber);
+    LC_QueueImmediateAPs(0);
+    LC_RunImmediateAPs(&PacketTime);
+
+    UtAssert_UINT32_EQ(LC_OperData.ImmediateAPCount, 2);
+    UtAssert_UINT32_EQ(LC_AppData.APSampleCount, 3);
+
+    /* Passive now, so no second RTS request */
+    UtAssert_UINT32_EQ(LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 1);
+
+    /* Only the RTS request needed the packet time */
+    UtAssert_STUB_COUNT(LC_GetPacketTime, 1);
+}
+
+void LC_RecordRTSLatency_Test_Nominal(void)
+{
+    CFE_TIME_SysTime_t Timestamp = {.Seconds = 3, .Subseconds = 0};
+    CFE_TIME_SysTime_t Elapsed   = {.Seconds = 2, .Subseconds = 0};
+
+    LC_OperData.PeakRTSLatency = 3000000;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Elapsed);
+
+    /* Execute the function being tested */
+    LC_RecordRTSLatency(Timestamp);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.LastRTSLatency, 2000000);
+    UtAssert_UINT32_EQ(LC_OperData.PeakRTSLatency, 3000000);
+}
+
+void LC_RecordRTSLatency_Test_TooLong(void)
+{
+    CFE_TIME_SysTime_t Timestamp = {.Seconds = 0, .Subseconds = 0};
+    CFE_TIME_SysTime_t Elapsed   = {.Seconds = 5000, .Subseconds = 0};
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Elapsed);
+
+    /* Execute the function being tested */
+    LC_RecordRTSLatency(Timestamp);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.LastRTSLatency, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(LC_OperData.PeakRTSLatency, 0xFFFFFFFF);
+}
+
+void LC_MarkAPDirty_Test_Nominal(void)
+{
+    uint16 APNumber = LC_MAX_ACTIONPOINTS - 1;
+
+    /* Execute the function being tested */
+    LC_MarkAPDirty(APNumber);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.Dirty[LC_BIT_WORD(APNumber)], LC_BIT_MASK(APNumber));
+}
+
+void LC_APNeedsEval_Test_Nominal(void)
+{
+    /* Interpreted equations are always evaluated */
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(0));
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(0));
+
+    LC_OperData.RPNProgram.Length[0] = 2;
+    LC_MarkAPDirty(0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(LC_APNeedsEval(0));
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(LC_APNeedsEval(0));
+    UtAssert_UINT32_EQ(LC_OperData.APDepends.Dirty[0], 0);
+}
+
 void LC_ValidateADT_Test_ActionNotUsed(void)
 {
     uint8  Result;
@@ -1452,6 +2142,31 @@ void LC_ValidateADT_Test_InvalidEventType(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 }
 
+void LC_ValidateADT_Test_BadOptions(void)
+{
+    uint8  Result;
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++)
+    {
+        LC_OperData.ADTPtr[TableIndex].DefaultState      = LC_APSTATE_ACTIVE;
+        LC_OperData.ADTPtr[TableIndex].RTSId             = 1;
+        LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 88;
+        LC_OperData.ADTPtr[TableIndex].EventType         = CFE_EVS_EventType_INFORMATION;
+        LC_OperData.ADTPtr[TableIndex].ActionOptions     = (uint8)~LC_ACTION_OPT_MASK;
+    }
+
+    /* Execute the function being tested */
+    Result = LC_ValidateADT(LC_OperData.ADTPtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, LC_ADTVAL_ERR_OPTIONS);
+
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_ADTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, LC_ADTVAL_INF_EID);
+}
+
 void LC_ValidateADT_Test_ValidateRpnAdtValError(void)
 {
     uint8  Result;
@@ -1765,6 +2480,11 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_SampleAPs_Test_MultiActionPointNominal");
+    UtTest_Add(LC_SampleAPs_Test_HighWater, LC_Test_Setup, LC_Test_TearDown, "LC_SampleAPs_Test_HighWater");
+    UtTest_Add(LC_SampleAPs_Test_ScalingBenchmark,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SampleAPs_Test_ScalingBenchmark");
 
     UtTest_Add(LC_SampleSingleAP_Test_StateChangePassToFail,
                LC_Test_Setup,
@@ -1813,6 +2533,11 @@ void UtTest_Setup(void)
                LC_Test_TearDown,
                "LC_SampleSingleAP_Test_ConsecutivePass");
 
+    UtTest_Add(LC_SampleSingleAP_Test_SkipUnchanged,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SampleSingleAP_Test_SkipUnchanged");
+
     UtTest_Add(LC_EvaluateRPN_Test_AndWatchFalseOp1,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -1879,6 +2604,36 @@ void UtTest_Setup(void)
                LC_Test_TearDown,
                "LC_EvaluateRPN_Test_EndOfBufferWhenNotDone");
     UtTest_Add(LC_EvaluateRPN_Test_PushPopFail, LC_Test_Setup, LC_Test_TearDown, "LC_EvaluateRPN_Test_PushPopFail");
+    UtTest_Add(LC_EvaluateRPN_Test_Compiled, LC_Test_Setup, LC_Test_TearDown, "LC_EvaluateRPN_Test_Compiled");
+    UtTest_Add(LC_RunRPNProgram_Test_MatchesInterpreter,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_RunRPNProgram_Test_MatchesInterpreter");
+    UtTest_Add(LC_CompileRPN_Test_ShortCircuit, LC_Test_Setup, LC_Test_TearDown, "LC_CompileRPN_Test_ShortCircuit");
+    UtTest_Add(LC_CompileRPN_Test_Invalid, LC_Test_Setup, LC_Test_TearDown, "LC_CompileRPN_Test_Invalid");
+    UtTest_Add(LC_CompileActionpoints_Test_Nominal,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompileActionpoints_Test_Nominal");
+    UtTest_Add(LC_BuildAPDepends_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_BuildAPDepends_Test_Nominal");
+    UtTest_Add(LC_ClassifyRPN_Test_Forms, LC_Test_Setup, LC_Test_TearDown, "LC_ClassifyRPN_Test_Forms");
+    UtTest_Add(LC_EvaluateWatchMask_Test_All, LC_Test_Setup, LC_Test_TearDown, "LC_EvaluateWatchMask_Test_All");
+    UtTest_Add(LC_EvaluateWatchMask_Test_Any, LC_Test_Setup, LC_Test_TearDown, "LC_EvaluateWatchMask_Test_Any");
+    UtTest_Add(LC_BuildWatchPlanes_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_BuildWatchPlanes_Test_Nominal");
+    UtTest_Add(LC_BuildWatchPlanes_Test_UnknownResult,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_BuildWatchPlanes_Test_UnknownResult");
+    UtTest_Add(LC_WatchResultChanged_Test_Nominal,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_WatchResultChanged_Test_Nominal");
+    UtTest_Add(LC_QueueImmediateAPs_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_QueueImmediateAPs_Test_Nominal");
+    UtTest_Add(LC_RunImmediateAPs_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_RunImmediateAPs_Test_Nominal");
+    UtTest_Add(LC_RecordRTSLatency_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_RecordRTSLatency_Test_Nominal");
+    UtTest_Add(LC_RecordRTSLatency_Test_TooLong, LC_Test_Setup, LC_Test_TearDown, "LC_RecordRTSLatency_Test_TooLong");
+    UtTest_Add(LC_MarkAPDirty_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_MarkAPDirty_Test_Nominal");
+    UtTest_Add(LC_APNeedsEval_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_APNeedsEval_Test_Nominal");
 
     UtTest_Add(LC_ValidateADT_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_Nominal");
     UtTest_Add(LC_ValidateADT_Test_ActionNotUsed, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_ActionNotUsed");
@@ -1888,6 +2643,7 @@ void UtTest_Setup(void)
                "LC_ValidateADT_Test_InvalidDefaultState");
     UtTest_Add(LC_ValidateADT_Test_BadRtsID, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_BadRtsID");
     UtTest_Add(LC_ValidateADT_Test_BadFailCount, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_BadFailCount");
+    UtTest_Add(LC_ValidateADT_Test_BadOptions, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateADT_Test_BadOptions");
     UtTest_Add(LC_ValidateADT_Test_InvalidEventType,
                LC_Test_Setup,
                LC_Test_TearDown,
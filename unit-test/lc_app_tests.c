@@ -36,6 +36,8 @@
 #include "lc_test_utils.h"
 #include "lc_dispatch.h"
 #include "lc_cmds.h"
+#include "lc_action.h"
+#include "lc_watch.h"
 #include "lc_platform_cfg.h"
 
 #include "cfe.h"
@@ -138,6 +140,49 @@ static void UT_Handler_CFE_ES_RunLoop(void *UserObj, UT_EntryKey_t FuncKey, cons
     UT_Stub_SetReturnValue(FuncKey, Status);
 }
 
+/* Polls find the pipe empty, pends return the status set for the test */
+static void UT_Handler_CFE_SB_ReceiveBuffer_PollEmpty(void *UserObj, UT_EntryKey_t FuncKey,
+                                                      const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtr  = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_SB_Buffer_t **);
+    int32             TimeOut = UT_Hook_GetArgValueByName(Context, "TimeOut", int32);
+    int32             Status  = CFE_SUCCESS;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (TimeOut == CFE_SB_POLL)
+    {
+        Status = CFE_SB_NO_MESSAGE;
+    }
+    else if (Status == CFE_SUCCESS)
+    {
+        *BufPtr = &UT_CmdBuf.Buf;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
+/* Odd calls poll the empty control pipe, even calls the command pipe */
+static void UT_Handler_CFE_SB_ReceiveBuffer_CtrlEmpty(void *UserObj, UT_EntryKey_t FuncKey,
+                                                      const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_SB_Buffer_t **);
+    int32             Status = CFE_SUCCESS;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if ((UT_GetStubCount(FuncKey) % 2) == 1)
+    {
+        Status = CFE_SB_NO_MESSAGE;
+    }
+    else if (Status == CFE_SUCCESS)
+    {
+        *BufPtr = &UT_CmdBuf.Buf;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, Status);
+}
+
 void LC_AppMain_Test_Nominal(void)
 {
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
@@ -147,6 +192,9 @@ void LC_AppMain_Test_Nominal(void)
 
     UT_SetDefaultReturnValue(UT_KEY(LC_AppPipe), CFE_SUCCESS);
 
+    /* Pipe is empty after the first message */
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_PollEmpty, NULL);
+
     LC_AppMain();
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -189,6 +237,9 @@ void LC_AppMain_Test_NominalCDSNoSave(void)
 
     UT_SetDefaultReturnValue(UT_KEY(LC_AppPipe), CFE_SUCCESS);
 
+    /* Pipe is empty after the first message */
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_PollEmpty, NULL);
+
     LC_AppMain();
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -269,8 +320,49 @@ void LC_AppMain_Test_SbTimeout(void)
 
     LC_AppMain();
 
+    /* One timeout is shorter than the maintenance wakeup */
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_ExitApp)), 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(LC_PerformMaintenance)), 0);
+}
+
+void LC_AppMain_Test_SbTimeoutMaintenance(void)
+{
+    /* Pend times out until a maintenance wakeup has passed */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RunLoop), true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), (LC_SB_TIMEOUT / LC_CTRL_PIPE_PEND_TIME) + 1, false);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(LC_PerformMaintenance), CFE_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_TIME_OUT);
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_PollEmpty, NULL);
+
+    LC_AppMain();
+
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_ExitApp)), 1);
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(LC_PerformMaintenance)), 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(LC_AppPipe)), 0);
+}
+
+void LC_AppMain_Test_CtrlPipe(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, false);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* No monitor packet, one request waiting on the control pipe */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_TIME_OUT);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+
+    LC_AppMain();
+
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_ExitApp)), 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_SB_ReceiveBuffer)), 3);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(LC_AppPipe)), 1);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(LC_PerformMaintenance)), 0);
+    UtAssert_UINT32_EQ(LC_OperData.LastCtrlBatch, 1);
 }
 
 void LC_AppMain_Test_SbNoMessage(void)
@@ -285,6 +377,187 @@ void LC_AppMain_Test_SbNoMessage(void)
     UtAssert_STUB_COUNT(CFE_ES_ExitApp, 1);
 }
 
+void LC_DrainCmdPipe_Test_Nominal(void)
+{
+    LC_OperData.PeakPipeBatch = 2;
+
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_CtrlEmpty, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 6, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCmdPipe(&UT_CmdBuf.Buf), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(LC_AppPipe, 3);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 6);
+    UtAssert_UINT32_EQ(LC_OperData.LastPipeBatch, 3);
+    UtAssert_UINT32_EQ(LC_OperData.PeakPipeBatch, 3);
+    UtAssert_UINT32_EQ(LC_OperData.PipeLimitCount, 0);
+    UtAssert_UINT32_EQ(LC_OperData.LastCtrlBatch, 0);
+
+    /* A smaller batch leaves the peak alone */
+    UT_ResetState(UT_KEY(CFE_SB_ReceiveBuffer));
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_CtrlEmpty, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+    UtAssert_INT32_EQ(LC_DrainCmdPipe(&UT_CmdBuf.Buf), CFE_SUCCESS);
+
+    UtAssert_STUB_COUNT(LC_AppPipe, 4);
+    UtAssert_UINT32_EQ(LC_OperData.LastPipeBatch, 1);
+    UtAssert_UINT32_EQ(LC_OperData.PeakPipeBatch, 3);
+}
+
+void LC_DrainCmdPipe_Test_Limit(void)
+{
+    /* Command pipe never empties */
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_CtrlEmpty, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCmdPipe(&UT_CmdBuf.Buf), CFE_SUCCESS);
+
+    /* Verify results, the control pipe is polled before each message */
+    UtAssert_STUB_COUNT(LC_AppPipe, LC_PIPE_DRAIN_LIMIT + 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, (2 * LC_PIPE_DRAIN_LIMIT) + 1);
+    UtAssert_UINT32_EQ(LC_OperData.LastPipeBatch, LC_PIPE_DRAIN_LIMIT + 1);
+    UtAssert_UINT32_EQ(LC_OperData.PeakPipeBatch, LC_PIPE_DRAIN_LIMIT + 1);
+    UtAssert_UINT32_EQ(LC_OperData.PipeLimitCount, 1);
+}
+
+void LC_DrainCmdPipe_Test_SbError(void)
+{
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), UT_Handler_CFE_SB_ReceiveBuffer_CtrlEmpty, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 4, CFE_SB_PIPE_RD_ERR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCmdPipe(&UT_CmdBuf.Buf), CFE_SB_PIPE_RD_ERR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(LC_AppPipe, 2);
+    UtAssert_UINT32_EQ(LC_OperData.LastPipeBatch, 2);
+    UtAssert_UINT32_EQ(LC_OperData.PipeLimitCount, 0);
+}
+
+void LC_DrainCmdPipe_Test_CtrlFirst(void)
+{
+    /* Two control messages are waiting, then the command pipe is empty */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCmdPipe(&UT_CmdBuf.Buf), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(LC_AppPipe, 3);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 4);
+    UtAssert_UINT32_EQ(LC_OperData.LastCtrlBatch, 2);
+    UtAssert_UINT32_EQ(LC_OperData.LastPipeBatch, 1);
+}
+
+void LC_DrainCtrlPipe_Test_Nominal(void)
+{
+    uint16 BatchSize = 0;
+
+    LC_OperData.PeakCtrlBatch = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 3, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCtrlPipe(&BatchSize), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(BatchSize, 2);
+    UtAssert_STUB_COUNT(LC_AppPipe, 2);
+    UtAssert_UINT32_EQ(LC_OperData.LastCtrlBatch, 2);
+    UtAssert_UINT32_EQ(LC_OperData.PeakCtrlBatch, 2);
+
+    /* An empty pipe leaves the counters alone */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+    UtAssert_INT32_EQ(LC_DrainCtrlPipe(&BatchSize), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(BatchSize, 0);
+    UtAssert_STUB_COUNT(LC_AppPipe, 2);
+    UtAssert_UINT32_EQ(LC_OperData.LastCtrlBatch, 2);
+    UtAssert_UINT32_EQ(LC_OperData.PeakCtrlBatch, 2);
+}
+
+void LC_DrainCtrlPipe_Test_Limit(void)
+{
+    uint16 BatchSize = 0;
+
+    /* Pipe never empties */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCtrlPipe(&BatchSize), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(BatchSize, LC_CTRL_PIPE_DEPTH);
+    UtAssert_STUB_COUNT(LC_AppPipe, LC_CTRL_PIPE_DEPTH);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, LC_CTRL_PIPE_DEPTH);
+    UtAssert_UINT32_EQ(LC_OperData.PeakCtrlBatch, LC_CTRL_PIPE_DEPTH);
+}
+
+void LC_DrainCtrlPipe_Test_SbError(void)
+{
+    uint16 BatchSize = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_PIPE_RD_ERR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_DrainCtrlPipe(&BatchSize), CFE_SB_PIPE_RD_ERR);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(BatchSize, 1);
+    UtAssert_STUB_COUNT(LC_AppPipe, 1);
+}
+
+void LC_CheckMsgSequence_Test(void)
+{
+    LC_MessageList_t       *MessageList = LC_OperData.MsgIndex->MessageList;
+    CFE_MSG_SequenceCount_t SeqCount;
+
+    MessageList[0].Handler = LC_MSG_HANDLER_WATCH;
+    MessageList[1].Handler = LC_MSG_HANDLER_SAMPLE_AP;
+    MessageList[2].Handler = LC_MSG_HANDLER_CMD;
+
+    /* The first packet only sets the count to compare with */
+    SeqCount = 5;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCount, sizeof(SeqCount), false);
+    LC_CheckMsgSequence(&MessageList[0], &UT_CmdBuf.Buf);
+    UtAssert_BOOL_TRUE(LC_OperData.MsgSeq[0].Valid);
+    UtAssert_UINT32_EQ(LC_OperData.MsgSeq[0].SeqCount, 5);
+
+    /* The next count in sequence and a repeated count are not gaps */
+    SeqCount = 6;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCount, sizeof(SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 6);
+    LC_CheckMsgSequence(&MessageList[0], &UT_CmdBuf.Buf);
+    LC_CheckMsgSequence(&MessageList[0], &UT_CmdBuf.Buf);
+    UtAssert_UINT32_EQ(LC_OperData.MonPipeGaps, 0);
+
+    /* A skipped count is a gap on the command pipe */
+    SeqCount = 9;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSequenceCount), &SeqCount, sizeof(SeqCount), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 7);
+    LC_CheckMsgSequence(&MessageList[0], &UT_CmdBuf.Buf);
+    UtAssert_UINT32_EQ(LC_OperData.MonPipeGaps, 1);
+    UtAssert_UINT32_EQ(LC_OperData.MsgSeq[0].SeqCount, 9);
+
+    /* A skipped sample request is a gap on the control pipe */
+    LC_OperData.MsgSeq[1].SeqCount = 2;
+    LC_OperData.MsgSeq[1].Valid    = true;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 3);
+    LC_CheckMsgSequence(&MessageList[1], &UT_CmdBuf.Buf);
+    UtAssert_UINT32_EQ(LC_OperData.CtrlPipeGaps, 1);
+    UtAssert_UINT32_EQ(LC_OperData.MonPipeGaps, 1);
+
+    /* Ground commands and MessageIDs missing from the index are not tracked */
+    LC_CheckMsgSequence(&MessageList[2], &UT_CmdBuf.Buf);
+    LC_CheckMsgSequence(NULL, &UT_CmdBuf.Buf);
+    UtAssert_BOOL_FALSE(LC_OperData.MsgSeq[2].Valid);
+    UtAssert_UINT32_EQ(LC_OperData.CtrlPipeGaps, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSequenceCount, 5);
+}
+
 void LC_AppInit_Test_Nominal(void)
 {
     CFE_Status_t Result;
@@ -321,13 +594,13 @@ void LC_AppInit_Test_Nominal(void)
     UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(LC_OperData.WRTDataCDSHandle));
     UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(LC_OperData.ARTDataCDSHandle));
     UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(LC_OperData.AppDataCDSHandle));
-    /* Note: not testing LC_OperData.WatchpointCount == 0, because it is modified by a subfunction */
-    /* Note: not testing LC_OperData.MessageIDsCount == 0, because it is modified by a subfunction */
+    UtAssert_ADDRESS_EQ(LC_OperData.MsgIndex, &LC_OperData.MsgIndexBuf[0]);
+    UtAssert_ADDRESS_EQ(LC_OperData.HashBuild.Index, &LC_OperData.MsgIndexBuf[1]);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ALL);
     /* Note: not testing LC_OperData.HkPacket == 0, because it is modified by a subfunction */
     /* Note: not testing LC_OperData.TableResults == 0, because it is modified by a subfunction */
-    /* Note: not testing LC_OperData.HashTable == 0, because it is modified by a subfunction */
-    /* Note: not testing LC_OperData.MessageLinks == 0, because it is modified by a subfunction */
-    /* Note: not testing LC_OperData.WatchPtLinks == 0, because it is modified by a subfunction */
+    /* Note: not testing LC_OperData.MsgIndexBuf == 0, because it is modified by a subfunction */
+    /* Note: not testing LC_OperData.HashBuild == 0, because it is modified by a subfunction */
     UtAssert_INT32_EQ(LC_OperData.HaveActiveCDS, 0);
 
     UtAssert_INT32_EQ(LC_AppData.CmdCount, 0);
@@ -472,6 +745,25 @@ void LC_SbInit_Test_CreatePipeError(void)
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
 }
 
+void LC_SbInit_Test_CreateCtrlPipeError(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to generate error message LC_CR_PIPE_ERR_EID for the second pipe */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 2, -1);
+
+    /* Execute the function being tested */
+    Result = LC_SbInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_CR_PIPE_ERR_EID);
+}
+
 void LC_SbInit_Test_SubscribeHKReqError(void)
 {
     CFE_Status_t Result;
@@ -809,6 +1101,8 @@ void LC_TableInit_Test_Nominal(void)
     Result = LC_TableInit();
 
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_STUB_COUNT(LC_CompileActionpoints, 1);
+    UtAssert_STUB_COUNT(LC_BuildStaleWheel, 1);
 
     UtAssert_True(((LC_OperData.TableResults & LC_WRT_CDS_CREATED) == LC_WRT_CDS_CREATED),
                   "LC_OperData.TableResult & LC_WRT_CDS_CREATED == LC_WRT_CDS_CREATED");
@@ -1519,7 +1813,20 @@ void UtTest_Setup(void)
     UtTest_Add(LC_AppMain_Test_SbError, LC_Test_Setup, LC_Test_TearDown, "LC_AppMain_Test_SbError");
 
     UtTest_Add(LC_AppMain_Test_SbTimeout, LC_Test_Setup, LC_Test_TearDown, "LC_AppMain_Test_SbTimeout");
+    UtTest_Add(LC_AppMain_Test_SbTimeoutMaintenance,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_AppMain_Test_SbTimeoutMaintenance");
+    UtTest_Add(LC_AppMain_Test_CtrlPipe, LC_Test_Setup, LC_Test_TearDown, "LC_AppMain_Test_CtrlPipe");
     UtTest_Add(LC_AppMain_Test_SbNoMessage, LC_Test_Setup, LC_Test_TearDown, "LC_AppMain_Test_SbNoMessage");
+    UtTest_Add(LC_DrainCmdPipe_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCmdPipe_Test_Nominal");
+    UtTest_Add(LC_DrainCmdPipe_Test_Limit, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCmdPipe_Test_Limit");
+    UtTest_Add(LC_DrainCmdPipe_Test_SbError, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCmdPipe_Test_SbError");
+    UtTest_Add(LC_DrainCmdPipe_Test_CtrlFirst, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCmdPipe_Test_CtrlFirst");
+    UtTest_Add(LC_DrainCtrlPipe_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCtrlPipe_Test_Nominal");
+    UtTest_Add(LC_DrainCtrlPipe_Test_Limit, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCtrlPipe_Test_Limit");
+    UtTest_Add(LC_DrainCtrlPipe_Test_SbError, LC_Test_Setup, LC_Test_TearDown, "LC_DrainCtrlPipe_Test_SbError");
+    UtTest_Add(LC_CheckMsgSequence_Test, LC_Test_Setup, LC_Test_TearDown, "LC_CheckMsgSequence_Test");
 
 #ifndef LC_SAVE_TO_CDS /* default config unit test */
     UtTest_Add(LC_AppInit_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_AppInit_Test_Nominal");
@@ -1534,6 +1841,10 @@ void UtTest_Setup(void)
 
     UtTest_Add(LC_SbInit_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_SbInit_Test_Nominal");
     UtTest_Add(LC_SbInit_Test_CreatePipeError, LC_Test_Setup, LC_Test_TearDown, "LC_SbInit_Test_CreatePipeError");
+    UtTest_Add(LC_SbInit_Test_CreateCtrlPipeError,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SbInit_Test_CreateCtrlPipeError");
     UtTest_Add(LC_SbInit_Test_SubscribeHKReqError,
                LC_Test_Setup,
                LC_Test_TearDown,
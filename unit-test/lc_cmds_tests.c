@@ -35,6 +35,7 @@
 #include "lc_version.h"
 #include "lc_test_utils.h"
 #include "lc_watch.h"
+#include "lc_action.h"
 
 /* UT includes */
 #include "uttest.h"
@@ -72,8 +73,7 @@ void LC_SampleAPReq_Test_AllowSampleAllWatchStale(void)
     LC_SampleAPReq(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE,
-                  "LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE");
+    UtAssert_STUB_COUNT(LC_AgeWatchResults, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
@@ -97,6 +97,9 @@ void LC_SampleAPReq_Test_AllowSampleAllWatchNotStale(void)
     LC_SampleAPReq(&UT_CmdBuf.Buf);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(LC_AgeWatchResults, 1);
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 0);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
 }
@@ -119,8 +122,7 @@ void LC_SampleAPReq_Test_StartLessOrEqualToEndAndEndWithinArrayWatchStale(void)
     LC_SampleAPReq(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE,
-                  "LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE");
+    UtAssert_STUB_COUNT(LC_AgeWatchResults, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
@@ -181,6 +183,8 @@ void LC_SampleAPReq_Test_BadSampleAllArgs(void)
     /* Execute the function being tested */
     LC_SampleAPReq(&UT_CmdBuf.Buf);
 
+    UtAssert_STUB_COUNT(LC_AgeWatchResults, 0);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_APSAMPLE_APNUM_ERR_EID);
@@ -242,6 +246,7 @@ void LC_SampleAPReq_Test_SampleAllUpdateAgeZero(void)
     LC_SampleAPReq(&UT_CmdBuf.Buf);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(LC_AgeWatchResults, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
@@ -261,7 +266,7 @@ void LC_SendHkCmd_Test_WatchStale(void)
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
     {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_STALE;
+        LC_OperData.WatchPlanes.Stale[LC_BIT_WORD(TableIndex)] |= LC_BIT_MASK(TableIndex);
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables */
@@ -300,7 +305,6 @@ void LC_SendHkCmd_Test_WatchStale(void)
 void LC_SendHkCmd_Test_WatchFalse(void)
 {
     CFE_Status_t              Result;
-    uint16                    TableIndex;
     uint16                    HKIndex;
     uint8                     ExpectedByteData;
     CFE_SB_MsgId_t            TestMsgId;
@@ -309,10 +313,8 @@ void LC_SendHkCmd_Test_WatchFalse(void)
     TestMsgId = CFE_SB_ValueToMsgId(LC_SEND_HK_MID);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
-    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
-    {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_FALSE;
-    }
+    /* False results have no plane bits, so start from a packet that is all stale */
+    memset(LC_OperData.HkPacket.Payload.WPResults, 0xFF, sizeof(LC_OperData.HkPacket.Payload.WPResults));
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables */
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
@@ -361,7 +363,7 @@ void LC_SendHkCmd_Test_WatchTrue(void)
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
     {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_TRUE;
+        LC_OperData.WatchPlanes.True[LC_BIT_WORD(TableIndex)] |= LC_BIT_MASK(TableIndex);
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables */
@@ -412,7 +414,7 @@ void LC_SendHkCmd_Test_WatchError(void)
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
     {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_ERROR;
+        LC_OperData.WatchPlanes.Error[LC_BIT_WORD(TableIndex)] |= LC_BIT_MASK(TableIndex);
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables */
@@ -463,6 +465,9 @@ void LC_SendHkCmd_Test_DefaultWatchResult(void)
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
     {
         LC_OperData.WRTPtr[TableIndex].WatchResult = 99;
+
+        /* As LC_BuildWatchPlanes loads a result that is not valid */
+        LC_OperData.WatchPlanes.Error[LC_BIT_WORD(TableIndex)] |= LC_BIT_MASK(TableIndex);
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables */
@@ -498,6 +503,59 @@ void LC_SendHkCmd_Test_DefaultWatchResult(void)
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
 }
 
+void LC_SendHkCmd_Test_MixedWatchResults(void)
+{
+    CFE_Status_t              Result;
+    uint16                    TableIndex;
+    uint16                    HKIndex;
+    uint8                     ExpectedByteData;
+    CFE_SB_MsgId_t            TestMsgId;
+    const LC_HkTlm_Payload_t *PayloadPtr = &LC_OperData.HkPacket.Payload;
+
+    TestMsgId = CFE_SB_ValueToMsgId(LC_SEND_HK_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* Every group of 4 watchpoints is false, true, error, stale */
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex += 4)
+    {
+        LC_OperData.WatchPlanes.True[LC_BIT_WORD(TableIndex + 1)] |= LC_BIT_MASK(TableIndex + 1);
+        LC_OperData.WatchPlanes.Error[LC_BIT_WORD(TableIndex + 2)] |= LC_BIT_MASK(TableIndex + 2);
+        LC_OperData.WatchPlanes.Stale[LC_BIT_WORD(TableIndex + 3)] |= LC_BIT_MASK(TableIndex + 3);
+    }
+
+    /* Set to prevent an unintended error message in subfunction LC_ManageTables */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = LC_SendHkCmd(&UT_CmdBuf.SendHkCmd);
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    ExpectedByteData = LC_HKWR_STALE << 6;
+    ExpectedByteData = (ExpectedByteData | (LC_HKWR_ERROR << 4));
+    ExpectedByteData = (ExpectedByteData | (LC_HKWR_TRUE << 2));
+    ExpectedByteData = (ExpectedByteData | LC_HKWR_FALSE);
+
+    /* Checks for first index: */
+    HKIndex = 0;
+    UtAssert_True(PayloadPtr->WPResults[HKIndex] == ExpectedByteData,
+                  "PayloadPtr->WPResults[HKIndex] == ExpectedByteData");
+
+    /* Checks for middle index: */
+    HKIndex = (LC_MAX_WATCHPOINTS / 2) / 4;
+    UtAssert_True(PayloadPtr->WPResults[HKIndex] == ExpectedByteData,
+                  "PayloadPtr->WPResults[HKIndex] == ExpectedByteData");
+
+    /* Checks for last index: */
+    HKIndex = (LC_MAX_WATCHPOINTS - 1) / 4;
+    UtAssert_True(PayloadPtr->WPResults[HKIndex] == ExpectedByteData,
+                  "PayloadPtr->WPResults[HKIndex] == ExpectedByteData");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
 void LC_SendHkCmd_Test_ActionNotUsedStale(void)
 {
     CFE_Status_t              Result;
@@ -806,6 +864,109 @@ void LC_SendHkCmd_Test_DefaultCurrentStateAndActionResult(void)
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
 }
 
+void LC_SendHkCmd_Test_ActionHighWater(void)
+{
+    CFE_Status_t              Result;
+    uint16                    TableIndex;
+    uint8                     ExpectedByteData;
+    uint8                     UnusedByteData;
+    CFE_SB_MsgId_t            TestMsgId;
+    const LC_HkTlm_Payload_t *PayloadPtr = &LC_OperData.HkPacket.Payload;
+
+    TestMsgId = CFE_SB_ValueToMsgId(LC_SEND_HK_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* Entries past the last actionpoint in use are not read */
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++)
+    {
+        LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_ACTIVE;
+        LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_PASS;
+    }
+
+    LC_OperData.ActionHighWater = 4;
+
+    /* Set to prevent an unintended error message in subfunction LC_ManageTables */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = LC_SendHkCmd(&UT_CmdBuf.SendHkCmd);
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    ExpectedByteData = (LC_HKAR_STATE_ACTIVE << 6) | (LC_HKAR_PASS << 4) | (LC_HKAR_STATE_ACTIVE << 2) | LC_HKAR_PASS;
+    UnusedByteData =
+        (LC_HKAR_STATE_NOT_USED << 6) | (LC_HKAR_STALE << 4) | (LC_HKAR_STATE_NOT_USED << 2) | LC_HKAR_STALE;
+
+    UtAssert_UINT32_EQ(PayloadPtr->APResults[0], ExpectedByteData);
+    UtAssert_UINT32_EQ(PayloadPtr->APResults[1], ExpectedByteData);
+    UtAssert_UINT32_EQ(PayloadPtr->APResults[2], UnusedByteData);
+    UtAssert_UINT32_EQ(PayloadPtr->APResults[(LC_MAX_ACTIONPOINTS - 1) / 2], UnusedByteData);
+    UtAssert_UINT32_EQ(PayloadPtr->ActiveAPs, 4);
+}
+
+void LC_SpreadBits_Test_Nominal(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_True(LC_SpreadBits(0) == 0, "LC_SpreadBits(0) == 0");
+    UtAssert_True(LC_SpreadBits(0xFFFFFFFF) == 0x5555555555555555ULL,
+                  "LC_SpreadBits(0xFFFFFFFF) == 0x5555555555555555");
+    UtAssert_True(LC_SpreadBits(0x80000003) == 0x4000000000000005ULL,
+                  "LC_SpreadBits(0x80000003) == 0x4000000000000005");
+}
+
+void LC_SendHkCmd_Test_OperCounters(void)
+{
+    CFE_Status_t              Result;
+    CFE_SB_MsgId_t            TestMsgId;
+    const LC_HkTlm_Payload_t *PayloadPtr = &LC_OperData.HkPacket.Payload;
+
+    TestMsgId = CFE_SB_ValueToMsgId(LC_SEND_HK_MID);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* Statistics kept out of the CDS still reach housekeeping */
+    LC_OperData.UnrefMsgCount       = 1;
+    LC_OperData.SkippedEvalCount    = 2;
+    LC_OperData.DigestHitCount      = 3;
+    LC_OperData.DigestMissCount     = 4;
+    LC_OperData.LastPipeBatch       = 5;
+    LC_OperData.PeakPipeBatch       = 6;
+    LC_OperData.PipeLimitCount      = 16;
+    LC_OperData.LastCtrlBatch       = 7;
+    LC_OperData.PeakCtrlBatch       = 8;
+    LC_OperData.CtrlPipeGaps        = 9;
+    LC_OperData.MonPipeGaps         = 10;
+    LC_OperData.APSkipCount         = 11;
+    LC_OperData.ImmediateAPCount    = 12;
+    LC_OperData.ImmediateDeferCount = 13;
+    LC_OperData.LastRTSLatency      = 14;
+    LC_OperData.PeakRTSLatency      = 15;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = LC_SendHkCmd(&UT_CmdBuf.SendHkCmd);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_UINT32_EQ(PayloadPtr->UnrefMsgCount, 1);
+    UtAssert_UINT32_EQ(PayloadPtr->SkippedEvalCount, 2);
+    UtAssert_UINT32_EQ(PayloadPtr->DigestHitCount, 3);
+    UtAssert_UINT32_EQ(PayloadPtr->DigestMissCount, 4);
+    UtAssert_UINT32_EQ(PayloadPtr->LastPipeBatch, 5);
+    UtAssert_UINT32_EQ(PayloadPtr->PeakPipeBatch, 6);
+    UtAssert_UINT32_EQ(PayloadPtr->PipeLimitCount, 16);
+    UtAssert_UINT32_EQ(PayloadPtr->LastCtrlBatch, 7);
+    UtAssert_UINT32_EQ(PayloadPtr->PeakCtrlBatch, 8);
+    UtAssert_UINT32_EQ(PayloadPtr->CtrlPipeGaps, 9);
+    UtAssert_UINT32_EQ(PayloadPtr->MonPipeGaps, 10);
+    UtAssert_UINT32_EQ(PayloadPtr->APSkipCount, 11);
+    UtAssert_UINT32_EQ(PayloadPtr->ImmediateAPCount, 12);
+    UtAssert_UINT32_EQ(PayloadPtr->ImmediateDeferCount, 13);
+    UtAssert_UINT32_EQ(PayloadPtr->LastRTSLatency, 14);
+    UtAssert_UINT32_EQ(PayloadPtr->PeakRTSLatency, 15);
+}
+
 void LC_SendHkCmd_Test_ManageTablesError(void)
 {
     CFE_Status_t   Result;
@@ -856,6 +1017,25 @@ void LC_ResetCounters_Test(void)
     LC_AppData.RTSExecCount        = 5;
     LC_AppData.PassiveRTSExecCount = 6;
 
+    LC_OperData.UnrefMsgCount       = 4;
+    LC_OperData.SkippedEvalCount    = 7;
+    LC_OperData.DigestHitCount      = 8;
+    LC_OperData.DigestMissCount     = 9;
+    LC_OperData.LastPipeBatch       = 10;
+    LC_OperData.PeakPipeBatch       = 11;
+    LC_OperData.PipeLimitCount      = 23;
+    LC_OperData.LastCtrlBatch       = 19;
+    LC_OperData.PeakCtrlBatch       = 20;
+    LC_OperData.CtrlPipeGaps        = 21;
+    LC_OperData.MonPipeGaps         = 22;
+    LC_OperData.APSkipCount         = 12;
+    LC_OperData.ImmediateAPCount    = 13;
+    LC_OperData.ImmediateDeferCount = 14;
+    LC_OperData.LastRTSLatency      = 15;
+    LC_OperData.PeakRTSLatency      = 16;
+    LC_OperData.CDSBytesWritten     = 17;
+    LC_OperData.CDSWritesSkipped    = 18;
+
     /* Execute the function being tested */
     LC_ResetCounters();
 
@@ -864,8 +1044,26 @@ void LC_ResetCounters_Test(void)
     UtAssert_True(LC_AppData.CmdErrCount == 0, "LC_AppData.CmdErrCount == 0");
     UtAssert_True(LC_AppData.APSampleCount == 0, "LC_AppData.APSampleCount == 0");
     UtAssert_True(LC_AppData.MonitoredMsgCount == 0, "LC_AppData.MonitoredMsgCount == 0");
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgCount, 0);
     UtAssert_True(LC_AppData.RTSExecCount == 0, "LC_AppData.RTSExecCount == 0");
     UtAssert_True(LC_AppData.PassiveRTSExecCount == 0, "LC_AppData.PassiveRTSExecCount == 0");
+    UtAssert_True(LC_OperData.SkippedEvalCount == 0, "LC_OperData.SkippedEvalCount == 0");
+    UtAssert_True(LC_OperData.DigestHitCount == 0, "LC_OperData.DigestHitCount == 0");
+    UtAssert_True(LC_OperData.DigestMissCount == 0, "LC_OperData.DigestMissCount == 0");
+    UtAssert_True(LC_OperData.LastPipeBatch == 0, "LC_OperData.LastPipeBatch == 0");
+    UtAssert_True(LC_OperData.PeakPipeBatch == 0, "LC_OperData.PeakPipeBatch == 0");
+    UtAssert_UINT32_EQ(LC_OperData.PipeLimitCount, 0);
+    UtAssert_UINT32_EQ(LC_OperData.LastCtrlBatch, 0);
+    UtAssert_UINT32_EQ(LC_OperData.PeakCtrlBatch, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CtrlPipeGaps, 0);
+    UtAssert_UINT32_EQ(LC_OperData.MonPipeGaps, 0);
+    UtAssert_True(LC_OperData.APSkipCount == 0, "LC_OperData.APSkipCount == 0");
+    UtAssert_True(LC_OperData.ImmediateAPCount == 0, "LC_OperData.ImmediateAPCount == 0");
+    UtAssert_True(LC_OperData.ImmediateDeferCount == 0, "LC_OperData.ImmediateDeferCount == 0");
+    UtAssert_True(LC_OperData.LastRTSLatency == 0, "LC_OperData.LastRTSLatency == 0");
+    UtAssert_True(LC_OperData.PeakRTSLatency == 0, "LC_OperData.PeakRTSLatency == 0");
+    UtAssert_True(LC_OperData.CDSBytesWritten == 0, "LC_OperData.CDSBytesWritten == 0");
+    UtAssert_True(LC_OperData.CDSWritesSkipped == 0, "LC_OperData.CDSWritesSkipped == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
@@ -1312,6 +1510,7 @@ void LC_SetAPStateCmd_Test_UpdateSingleActionPointActive(void)
     PayloadPtr->APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
     LC_OperData.ARTPtr[PayloadPtr->APNumber].CurrentState = 99;
+    LC_OperData.CDSDirty                                  = 0;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd(&UT_CmdBuf.SetAPStateCmd);
@@ -1319,6 +1518,7 @@ void LC_SetAPStateCmd_Test_UpdateSingleActionPointActive(void)
     /* Verify results */
     UtAssert_True(LC_OperData.ARTPtr[PayloadPtr->APNumber].CurrentState == LC_APSTATE_ACTIVE,
                   "LC_OperData.ARTPtr[PayloadPtr->APNumber].CurrentState == LC_APSTATE_ACTIVE");
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ART);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1740,6 +1940,7 @@ void LC_SetAPPermOffCmd_Test_Nominal(void)
     PayloadPtr->APNumber = 1;
 
     LC_OperData.ARTPtr[PayloadPtr->APNumber].CurrentState = LC_APSTATE_DISABLED;
+    LC_OperData.CDSDirty                                  = 0;
 
     /* Execute the function being tested */
     LC_SetAPPermOffCmd(&UT_CmdBuf.SetAPPermOffCmd);
@@ -1748,6 +1949,7 @@ void LC_SetAPPermOffCmd_Test_Nominal(void)
     UtAssert_True(LC_OperData.ARTPtr[PayloadPtr->APNumber].CurrentState == 4,
                   "LC_OperData.ARTPtr[PayloadPtr->APNumber].CurrentState == 4");
     UtAssert_True(LC_AppData.CmdCount == 1, "LC_AppData.CmdCount == 1");
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ART);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
@@ -1869,10 +2071,14 @@ void LC_ResetResultsAP_Test(void)
         LC_OperData.ADTPtr[TableIndex].DefaultState = 1;
     }
 
+    LC_OperData.CDSDirty = 0;
+
     /* Execute the function being tested */
     LC_ResetResultsAP(StartIndex, EndIndex, ResetStatsCmd);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(LC_MarkAPDirty, EndIndex - StartIndex + 1);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ART);
 
     /* Checks for first index: */
     TableIndex = StartIndex;
@@ -2041,35 +2247,40 @@ void LC_ResetResultsWP_Test(void)
 
     for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++)
     {
-        LC_OperData.WRTPtr[TableIndex].WatchResult      = 99;
-        LC_OperData.WRTPtr[TableIndex].CountdownToStale = 99;
+        LC_OperData.WRTPtr[TableIndex].WatchResult = 99;
 
         LC_OperData.WRTPtr[TableIndex].EvaluationCount      = 99;
         LC_OperData.WRTPtr[TableIndex].FalseToTrueCount     = 99;
         LC_OperData.WRTPtr[TableIndex].ConsecutiveTrueCount = 99;
         LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount  = 99;
+        LC_OperData.WRTPtr[TableIndex].ErrorCount           = 99;
 
         LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value                = 99;
+        LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.ValueUpper           = 99;
         LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Seconds    = 99;
         LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Subseconds = 99;
 
         LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Value                = 99;
+        LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.ValueUpper           = 99;
         LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Seconds    = 99;
         LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Subseconds = 99;
     }
 
+    LC_OperData.CDSDirty = 0;
+
     /* Execute the function being tested */
     LC_ResetResultsWP(StartIndex, EndIndex, ResetStatsCmd);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, EndIndex - StartIndex + 1);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_WRT);
+    UtAssert_STUB_COUNT(LC_DisarmStaleTimer, EndIndex - StartIndex + 1);
 
     /* Checks for first index: */
     TableIndex = StartIndex;
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE,
                   "LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE");
-    UtAssert_True(LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0");
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0");
@@ -2079,9 +2290,11 @@ void LC_ResetResultsWP_Test(void)
                   "LC_OperData.WRTPtr[TableIndex].ConsecutiveTrueCount == 0");
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount == 0");
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[TableIndex].ErrorCount, 0);
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value == 0,
                   "LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value == 0");
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.ValueUpper, 0);
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Seconds == 0,
                   "LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Seconds == 0");
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Timestamp.Subseconds == 0,
@@ -2089,6 +2302,7 @@ void LC_ResetResultsWP_Test(void)
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Value == 0,
                   "LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Value == 0");
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.ValueUpper, 0);
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Seconds == 0,
                   "LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Seconds == 0");
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastTrueToFalse.Timestamp.Subseconds == 0,
@@ -2099,8 +2313,6 @@ void LC_ResetResultsWP_Test(void)
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE,
                   "LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE");
-    UtAssert_True(LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0");
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0");
@@ -2110,6 +2322,7 @@ void LC_ResetResultsWP_Test(void)
                   "LC_OperData.WRTPtr[TableIndex].ConsecutiveTrueCount == 0");
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount == 0");
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[TableIndex].ErrorCount, 0);
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value == 0,
                   "LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value == 0");
@@ -2130,8 +2343,6 @@ void LC_ResetResultsWP_Test(void)
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE,
                   "LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE");
-    UtAssert_True(LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0");
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0");
@@ -2141,6 +2352,7 @@ void LC_ResetResultsWP_Test(void)
                   "LC_OperData.WRTPtr[TableIndex].ConsecutiveTrueCount == 0");
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].CumulativeTrueCount == 0");
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[TableIndex].ErrorCount, 0);
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value == 0,
                   "LC_OperData.WRTPtr[TableIndex].LastFalseToTrue.Value == 0");
@@ -2201,6 +2413,10 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_SendHkCmd_Test_DefaultWatchResult");
+    UtTest_Add(LC_SendHkCmd_Test_MixedWatchResults,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SendHkCmd_Test_MixedWatchResults");
     UtTest_Add(LC_SendHkCmd_Test_ActionNotUsedStale,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -2225,10 +2441,13 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_SendHkCmd_Test_DefaultCurrentStateAndActionResult");
+    UtTest_Add(LC_SendHkCmd_Test_OperCounters, LC_Test_Setup, LC_Test_TearDown, "LC_SendHkCmd_Test_OperCounters");
     UtTest_Add(LC_SendHkCmd_Test_ManageTablesError,
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_SendHkCmd_Test_ManageTablesError");
+    UtTest_Add(LC_SendHkCmd_Test_ActionHighWater, LC_Test_Setup, LC_Test_TearDown, "LC_SendHkCmd_Test_ActionHighWater");
+    UtTest_Add(LC_SpreadBits_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_SpreadBits_Test_Nominal");
 
     UtTest_Add(LC_NoopCmd_Test, LC_Test_Setup, LC_Test_TearDown, "LC_NoopCmd_Test");
     UtTest_Add(LC_ResetCountersCmd_Test, LC_Test_Setup, LC_Test_TearDown, "LC_ResetCountersCmd_Test");
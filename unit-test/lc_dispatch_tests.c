@@ -48,6 +48,16 @@
 /*
  * Helper functions
  */
+static LC_MessageList_t LC_Dispatch_Test_MessageList;
+
+/* Returns the dispatch index entry UserObj points to */
+void UT_Handler_LC_FindMessageIndex(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    LC_MessageList_t *MessageList = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, MessageList);
+}
+
 static void LC_Dispatch_Test_SetupMsg(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t FcnCode, size_t MsgSize)
 {
     /* Note some paths get the MsgId/FcnCode multiple times, so register accordingly, just in case */
@@ -62,6 +72,29 @@ static void LC_Dispatch_Test_SetupMsg(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t Fc
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), RegMsgId, sizeof(RegMsgId), true);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), RegFcnCode, sizeof(RegFcnCode), true);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), RegMsgSize, sizeof(RegMsgSize), true);
+
+    /* Mirror the dispatch index entries LC_CreateHashTable adds for LC's own MessageIDs */
+    memset(&LC_Dispatch_Test_MessageList, 0, sizeof(LC_Dispatch_Test_MessageList));
+    LC_Dispatch_Test_MessageList.MessageID = MsgId;
+
+    if (CFE_SB_MsgIdToValue(MsgId) == LC_SAMPLE_AP_MID)
+    {
+        LC_Dispatch_Test_MessageList.Handler = LC_MSG_HANDLER_SAMPLE_AP;
+    }
+    else if (CFE_SB_MsgIdToValue(MsgId) == LC_SEND_HK_MID)
+    {
+        LC_Dispatch_Test_MessageList.Handler = LC_MSG_HANDLER_SEND_HK;
+    }
+    else if (CFE_SB_MsgIdToValue(MsgId) == LC_CMD_MID)
+    {
+        LC_Dispatch_Test_MessageList.Handler = LC_MSG_HANDLER_CMD;
+    }
+    else
+    {
+        LC_Dispatch_Test_MessageList.Handler = LC_MSG_HANDLER_WATCH;
+    }
+
+    UT_SetHandlerFunction(UT_KEY(LC_FindMessageIndex), UT_Handler_LC_FindMessageIndex, &LC_Dispatch_Test_MessageList);
 }
 
 void LC_AppPipe_Test_SampleAPRequest(void)
@@ -306,10 +339,28 @@ void LC_AppPipe_Test_MonitorPacket(void)
     TestMsgId = LC_UT_MID_1;
     LC_Dispatch_Test_SetupMsg(TestMsgId, 0, 0);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    LC_OperData.CDSDirty = 0;
 
     /* Execute the function being tested */
     UtAssert_VOIDCALL(LC_AppPipe(&UT_CmdBuf.Buf));
-    UtAssert_STUB_COUNT(LC_CheckMsgForWPs, 1);
+    UtAssert_STUB_COUNT(LC_CheckIndexedMsgForWPs, 1);
+    UtAssert_STUB_COUNT(LC_CheckMsgSequence, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 0);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_APPDATA);
+}
+
+void LC_AppPipe_Test_UnreferencedPacket(void)
+{
+    CFE_SB_MsgId_t TestMsgId;
+
+    TestMsgId = LC_UT_MID_1;
+    LC_Dispatch_Test_SetupMsg(TestMsgId, 0, 0);
+    UT_SetHandlerFunction(UT_KEY(LC_FindMessageIndex), NULL, NULL);
+
+    /* Messages missing from the index are left to the watchpoint processing to count */
+    UtAssert_VOIDCALL(LC_AppPipe(&UT_CmdBuf.Buf));
+    UtAssert_STUB_COUNT(LC_CheckIndexedMsgForWPs, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 0);
 }
 
 void UtTest_Setup(void)
@@ -328,4 +379,8 @@ void UtTest_Setup(void)
                LC_Test_TearDown,
                "LC_AppPipe_Test_InvalidCommandCode");
     UtTest_Add(LC_AppPipe_Test_MonitorPacket, LC_Test_Setup, LC_Test_TearDown, "LC_AppPipe_Test_MonitorPacket");
+    UtTest_Add(LC_AppPipe_Test_UnreferencedPacket,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_AppPipe_Test_UnreferencedPacket");
 }
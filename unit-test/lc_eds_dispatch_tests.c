@@ -23,6 +23,7 @@
 #include "lc_cmds.h"
 #include "lc_msgids.h"
 #include "lc_eventids.h"
+#include "lc_watch.h"
 
 /* UT includes */
 #include "uttest.h"
@@ -45,18 +46,52 @@ void lc_dispatch_tests_Teardown(void)
 **********************************************************************************
 */
 
+/* Returns the dispatch index entry UserObj points to */
+void UT_Handler_LC_FindMessageIndex(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    LC_MessageList_t *MessageList = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, MessageList);
+}
+
 void Test_LC_AppPipe(void)
 {
     /*
      * Test Case For:
      * void LC_AppPipe
      */
-    CFE_SB_Buffer_t UtBuf;
+    CFE_SB_Buffer_t  UtBuf;
+    LC_MessageList_t MessageList;
+
+    memset(&MessageList, 0, sizeof(MessageList));
+    MessageList.Handler = LC_MSG_HANDLER_CMD;
+    UT_SetHandlerFunction(UT_KEY(LC_FindMessageIndex), UT_Handler_LC_FindMessageIndex, &MessageList);
 
     UT_SetDeferredRetcode(UT_KEY(CFE_EDSMSG_Dispatch), 1, CFE_SUCCESS);
 
     memset(&UtBuf, 0, sizeof(UtBuf));
     UtAssert_VOIDCALL(LC_AppPipe(&UtBuf));
+    UtAssert_STUB_COUNT(CFE_EDSMSG_Dispatch, 1);
+    UtAssert_STUB_COUNT(LC_CheckIndexedMsgForWPs, 0);
+}
+
+void Test_LC_AppPipe_MonitorPacket(void)
+{
+    /*
+     * Test Case For:
+     * void LC_AppPipe
+     */
+    CFE_SB_Buffer_t  UtBuf;
+    LC_MessageList_t MessageList;
+
+    memset(&MessageList, 0, sizeof(MessageList));
+    MessageList.Handler = LC_MSG_HANDLER_WATCH;
+    UT_SetHandlerFunction(UT_KEY(LC_FindMessageIndex), UT_Handler_LC_FindMessageIndex, &MessageList);
+
+    memset(&UtBuf, 0, sizeof(UtBuf));
+    UtAssert_VOIDCALL(LC_AppPipe(&UtBuf));
+    UtAssert_STUB_COUNT(CFE_EDSMSG_Dispatch, 0);
+    UtAssert_STUB_COUNT(LC_CheckIndexedMsgForWPs, 1);
 }
 
 /*
@@ -65,4 +100,8 @@ void Test_LC_AppPipe(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(Test_LC_AppPipe, lc_dispatch_tests_Setup, lc_dispatch_tests_Teardown, "Test_LC_AppPipe");
+    UtTest_Add(Test_LC_AppPipe_MonitorPacket,
+               lc_dispatch_tests_Setup,
+               lc_dispatch_tests_Teardown,
+               "Test_LC_AppPipe_MonitorPacket");
 }
\ No newline at end of file
@@ -25,6 +25,8 @@
 #include "lc_msgids.h"
 #include "lc_eventids.h"
 #include "lc_version.h"
+#include "lc_action.h"
+#include "lc_watch.h"
 #include "lc_test_utils.h"
 
 /* UT includes */
@@ -59,6 +61,24 @@ void LC_ManageTables_Test_Nominal(void)
 
     UtAssert_INT32_EQ(call_count_LC_ResetResultsWP, 0);
     UtAssert_INT32_EQ(call_count_LC_ResetResultsAP, 0);
+    UtAssert_STUB_COUNT(LC_CompileActionpoints, 0);
+    UtAssert_STUB_COUNT(LC_SyncStaleCountdowns, 0);
+}
+
+void LC_ManageTables_Test_DumpPending(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetStatus), 1, CFE_TBL_INFO_DUMP_PENDING);
+
+    /* Execute the function being tested */
+    Result = LC_ManageTables();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_STUB_COUNT(LC_SyncStaleCountdowns, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 4);
 }
 
 void LC_ManageTables_Test_InfoUpdated(void)
@@ -82,8 +102,11 @@ void LC_ManageTables_Test_InfoUpdated(void)
     call_count_LC_ResetResultsWP = UT_GetStubCount(UT_KEY(LC_ResetResultsWP));
     call_count_LC_ResetResultsAP = UT_GetStubCount(UT_KEY(LC_ResetResultsAP));
 
-    UtAssert_INT32_EQ(call_count_LC_ResetResultsWP, 1);
+    UtAssert_INT32_EQ(call_count_LC_ResetResultsWP, 0);
     UtAssert_INT32_EQ(call_count_LC_ResetResultsAP, 1);
+    UtAssert_STUB_COUNT(LC_ResetChangedWatchpoints, 1);
+    UtAssert_STUB_COUNT(LC_CreateHashTable, 1);
+    UtAssert_STUB_COUNT(LC_CompileActionpoints, 1);
 }
 
 void LC_ManageTables_Test_WDTGetAddressError(void)
@@ -245,11 +268,67 @@ void LC_UpdateTaskCDS_Test_Nominal(void)
     /* Verify results */
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
     UtAssert_True(LC_AppData.CDSSavedOnExit == LC_CDS_SAVED, "LC_AppData.CDSSavedOnExit == LC_CDS_SAVED");
+    UtAssert_STUB_COUNT(LC_SyncStaleCountdowns, 1);
+
+    /* First update writes every block */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten,
+                       sizeof(LC_WRTEntry_t) * LC_MAX_WATCHPOINTS + sizeof(LC_ARTEntry_t) * LC_MAX_ACTIONPOINTS +
+                           sizeof(LC_AppData));
+    UtAssert_UINT32_EQ(LC_OperData.CDSWritesSkipped, 0);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
 }
 
+void LC_UpdateTaskCDS_Test_Unchanged(void)
+{
+    uint32 BytesWritten;
+
+    UtAssert_INT32_EQ(LC_UpdateTaskCDS(), CFE_SUCCESS);
+    BytesWritten = LC_OperData.CDSBytesWritten;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_UpdateTaskCDS(), CFE_SUCCESS);
+
+    /* Nothing changed so nothing is written */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, BytesWritten);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWritesSkipped, 1);
+}
+
+void LC_UpdateTaskCDS_Test_OnlyChangedBlock(void)
+{
+    uint32 BytesWritten;
+
+    UtAssert_INT32_EQ(LC_UpdateTaskCDS(), CFE_SUCCESS);
+    BytesWritten = LC_OperData.CDSBytesWritten;
+
+    LC_OperData.CDSDirty |= LC_CDS_DIRTY_ART;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_UpdateTaskCDS(), CFE_SUCCESS);
+
+    /* Only the actionpoint results are written again */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 4);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, BytesWritten + sizeof(LC_ARTEntry_t) * LC_MAX_ACTIONPOINTS);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWritesSkipped, 0);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
+}
+
+void LC_UpdateTaskCDS_Test_ErrorKeepsDirty(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CopyToCDS), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_UpdateTaskCDS(), -1);
+
+    /* A failed write leaves the areas to be written again */
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ALL);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, 0);
+}
+
 void LC_PerformMaintenance_Test_NominalNoCDS(void)
 {
     CFE_Status_t Result;
@@ -319,10 +398,373 @@ void LC_PerformMaintenance_Test_ManageTablesFail(void)
     UtAssert_True(Result == -1, "Result == -1");
 }
 
+void LC_PerformMaintenance_Test_StagedCDS(void)
+{
+    LC_OperData.HaveActiveCDS        = true;
+    LC_OperData.CDSWriter.TaskActive = true;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_PerformMaintenance(), CFE_SUCCESS);
+
+    /* The writer task is woken instead of writing the CDS here */
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_BOOL_TRUE(LC_OperData.HaveActiveCDS);
+}
+
+void LC_CreateCDSWriter_Test_Nominal(void)
+{
+    /* Execute the function being tested */
+    LC_CreateCDSWriter();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.StopRequested);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.Exited);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 0);
+}
+
+void LC_CreateCDSWriter_Test_SemError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error creating CDS writer semaphore, RC=%%d");
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    LC_CreateCDSWriter();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_CDS_WRITER_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void LC_CreateCDSWriter_Test_DoneSemError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    LC_CreateCDSWriter();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_CDS_WRITER_ERR_EID);
+}
+
+void LC_CreateCDSWriter_Test_TaskError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error creating CDS writer task, RC=0x%%08X");
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), -1);
+
+    /* Execute the function being tested */
+    LC_CreateCDSWriter();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_CDS_WRITER_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void LC_StopCDSWriter_Test_Nominal(void)
+{
+    LC_OperData.CDSWriter.TaskActive   = true;
+    LC_OperData.CDSWriter.BytesWritten = 10;
+    LC_OperData.CDSDirty               = 0;
+
+    /* Execute the function being tested */
+    LC_StopCDSWriter();
+
+    /* The writer is asked to exit and confirms it */
+    UtAssert_BOOL_TRUE(LC_OperData.CDSWriter.StopRequested);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 2);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, 10);
+}
+
+void LC_StopCDSWriter_Test_Exited(void)
+{
+    LC_OperData.CDSWriter.TaskActive = true;
+    LC_OperData.CDSWriter.Exited     = true;
+
+    /* Execute the function being tested */
+    LC_StopCDSWriter();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+}
+
+void LC_StopCDSWriter_Test_Timeout(void)
+{
+    LC_OperData.CDSWriter.TaskActive = true;
+    LC_OperData.CDSDirty             = 0;
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 2, OS_SEM_TIMEOUT);
+
+    /* Execute the function being tested */
+    LC_StopCDSWriter();
+
+    /* The writer did not exit, so it is deleted as a last resort */
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 1);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_ALL);
+}
+
+void LC_StopCDSWriter_Test_WriteError(void)
+{
+    LC_OperData.HaveActiveCDS         = true;
+    LC_OperData.CDSWriter.TaskActive  = true;
+    LC_OperData.CDSWriter.WriteResult = -1;
+
+    /* Execute the function being tested */
+    LC_StopCDSWriter();
+
+    /* The failed write disables CDS before the final update */
+    UtAssert_BOOL_FALSE(LC_OperData.HaveActiveCDS);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+}
+
+void LC_StopCDSWriter_Test_NotActive(void)
+{
+    LC_OperData.CDSDirty = 0;
+
+    /* Execute the function being tested */
+    LC_StopCDSWriter();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 0);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
+}
+
+void LC_CollectCDSWriter_Test(void)
+{
+    LC_OperData.CDSBytesWritten         = 4;
+    LC_OperData.CDSWritesSkipped        = 1;
+    LC_OperData.CDSWriter.BytesWritten  = 20;
+    LC_OperData.CDSWriter.WritesSkipped = 3;
+    LC_OperData.CDSWriter.WriteResult   = -1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_CollectCDSWriter(), -1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, 24);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWritesSkipped, 4);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.BytesWritten, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.WritesSkipped, 0);
+    UtAssert_INT32_EQ(LC_OperData.CDSWriter.WriteResult, CFE_SUCCESS);
+}
+
+void LC_StageTaskCDS_Test_Nominal(void)
+{
+    LC_OperData.CDSWriter.TaskActive       = true;
+    LC_OperData.CDSWriter.BytesWritten     = 5;
+    LC_OperData.WRTPtr[3].CountdownToStale = 7;
+    LC_OperData.ARTPtr[4].PassToFailCount  = 2;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_StageTaskCDS(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UtAssert_STUB_COUNT(LC_SyncStaleCountdowns, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, 5);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.WRT[3].CountdownToStale, 7);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.ART[4].PassToFailCount, 2);
+    UtAssert_UINT16_EQ(LC_OperData.CDSWriter.AppData.CDSSavedOnExit, LC_CDS_SAVED);
+    UtAssert_UINT16_EQ(LC_AppData.CDSSavedOnExit, LC_CDS_SAVED);
+    UtAssert_UINT8_EQ(LC_OperData.CDSWriter.Dirty, LC_CDS_DIRTY_ALL);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
+}
+
+void LC_StageTaskCDS_Test_OnlyDirty(void)
+{
+    LC_OperData.CDSWriter.TaskActive       = true;
+    LC_OperData.CDSDirty                   = LC_CDS_DIRTY_ART;
+    LC_OperData.WRTPtr[3].CountdownToStale = 7;
+    LC_OperData.ARTPtr[4].PassToFailCount  = 2;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_StageTaskCDS(), CFE_SUCCESS);
+
+    /* Only the changed area is copied and handed to the writer */
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT8_EQ(LC_OperData.CDSWriter.Dirty, LC_CDS_DIRTY_ART);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.WRT[3].CountdownToStale, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.ART[4].PassToFailCount, 2);
+    UtAssert_UINT16_EQ(LC_OperData.CDSWriter.AppData.CDSSavedOnExit, 0);
+}
+
+void LC_StageTaskCDS_Test_Busy(void)
+{
+    LC_OperData.CDSWriter.TaskActive      = true;
+    LC_OperData.CDSWriter.BytesWritten    = 5;
+    LC_OperData.ARTPtr[4].PassToFailCount = 2;
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_StageTaskCDS(), CFE_SUCCESS);
+
+    /* The snapshot still being written and the writer counters are left alone */
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.ART[4].PassToFailCount, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, 0);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWritesSkipped, 1);
+}
+
+void LC_StageTaskCDS_Test_WriteError(void)
+{
+    LC_OperData.CDSWriter.TaskActive      = true;
+    LC_OperData.CDSWriter.WriteResult     = -1;
+    LC_OperData.ARTPtr[4].PassToFailCount = 2;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_StageTaskCDS(), -1);
+
+    /* Nothing is staged and the buffers are handed back */
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.ART[4].PassToFailCount, 0);
+    UtAssert_BOOL_TRUE(LC_OperData.CDSWriter.TaskActive);
+}
+
+void LC_StageTaskCDS_Test_Exited(void)
+{
+    LC_OperData.CDSWriter.TaskActive = true;
+    LC_OperData.CDSWriter.Exited     = true;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_StageTaskCDS(), CFE_SUCCESS);
+
+    /* The writer is torn down and the CDS written here instead */
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+}
+
+void LC_StageTaskCDS_Test_GiveError(void)
+{
+    LC_OperData.CDSWriter.TaskActive = true;
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemGive), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(LC_StageTaskCDS(), CFE_SUCCESS);
+
+    /* The writer cannot be asked to exit, so it is deleted and the CDS written here instead */
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 1);
+    UtAssert_BOOL_FALSE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
+}
+
+void LC_CDSWriterTask_Test_Nominal(void)
+{
+    LC_OperData.HaveActiveCDS        = true;
+    LC_OperData.CDSWriter.TaskActive = true;
+    LC_OperData.CDSWriter.Dirty      = LC_CDS_DIRTY_ALL;
+
+    /* Write one snapshot, then fail to take the semaphore */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    LC_CDSWriterTask();
+
+    /* Only the writer counters are updated */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 3);
+    UtAssert_UINT16_EQ(LC_OperData.CDSWriter.AppData.CDSSavedOnExit, LC_CDS_SAVED);
+    UtAssert_UINT32_EQ(LC_OperData.CDSWriter.BytesWritten,
+                       sizeof(LC_OperData.CDSWriter.WRT) + sizeof(LC_OperData.CDSWriter.ART) +
+                           sizeof(LC_OperData.CDSWriter.AppData));
+    UtAssert_UINT32_EQ(LC_OperData.CDSBytesWritten, 0);
+
+    /* The exit is confirmed and teardown left to the main task */
+    UtAssert_STUB_COUNT(OS_BinSemGive, 2);
+    UtAssert_BOOL_TRUE(LC_OperData.CDSWriter.Exited);
+    UtAssert_BOOL_TRUE(LC_OperData.CDSWriter.TaskActive);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 0);
+    UtAssert_BOOL_TRUE(LC_OperData.HaveActiveCDS);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void LC_CDSWriterTask_Test_WriteError(void)
+{
+    LC_OperData.HaveActiveCDS        = true;
+    LC_OperData.CDSWriter.TaskActive = true;
+    LC_OperData.CDSWriter.Dirty      = LC_CDS_DIRTY_ALL;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CopyToCDS), -1);
+
+    /* Execute the function being tested */
+    LC_CDSWriterTask();
+
+    /* The failure is left for the main task to act on */
+    UtAssert_INT32_EQ(LC_OperData.CDSWriter.WriteResult, -1);
+    UtAssert_BOOL_TRUE(LC_OperData.HaveActiveCDS);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void LC_CDSWriterTask_Test_Stop(void)
+{
+    LC_OperData.CDSWriter.TaskActive    = true;
+    LC_OperData.CDSWriter.StopRequested = true;
+
+    /* Execute the function being tested */
+    LC_CDSWriterTask();
+
+    /* Nothing is written once the main task asks the writer to exit */
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_BOOL_TRUE(LC_OperData.CDSWriter.Exited);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(LC_ManageTables_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_ManageTables_Test_Nominal");
     UtTest_Add(LC_ManageTables_Test_InfoUpdated, LC_Test_Setup, LC_Test_TearDown, "LC_ManageTables_Test_InfoUpdated");
+    UtTest_Add(LC_ManageTables_Test_DumpPending, LC_Test_Setup, LC_Test_TearDown, "LC_ManageTables_Test_DumpPending");
     UtTest_Add(LC_ManageTables_Test_WDTGetAddressError,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -345,6 +787,15 @@ void UtTest_Setup(void)
                LC_Test_TearDown,
                "LC_UpdateTaskCDS_Test_UpdateAppDataError");
     UtTest_Add(LC_UpdateTaskCDS_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_UpdateTaskCDS_Test_Nominal");
+    UtTest_Add(LC_UpdateTaskCDS_Test_Unchanged, LC_Test_Setup, LC_Test_TearDown, "LC_UpdateTaskCDS_Test_Unchanged");
+    UtTest_Add(LC_UpdateTaskCDS_Test_OnlyChangedBlock,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_UpdateTaskCDS_Test_OnlyChangedBlock");
+    UtTest_Add(LC_UpdateTaskCDS_Test_ErrorKeepsDirty,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_UpdateTaskCDS_Test_ErrorKeepsDirty");
 
     UtTest_Add(LC_PerformMaintenance_Test_NominalNoCDS,
                LC_Test_Setup,
@@ -362,4 +813,32 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_PerformMaintenance_Test_ManageTablesFail");
+
+    UtTest_Add(LC_PerformMaintenance_Test_StagedCDS,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_PerformMaintenance_Test_StagedCDS");
+    UtTest_Add(LC_CreateCDSWriter_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_CreateCDSWriter_Test_Nominal");
+    UtTest_Add(LC_CreateCDSWriter_Test_SemError, LC_Test_Setup, LC_Test_TearDown, "LC_CreateCDSWriter_Test_SemError");
+    UtTest_Add(
+        LC_CreateCDSWriter_Test_DoneSemError, LC_Test_Setup, LC_Test_TearDown, "LC_CreateCDSWriter_Test_DoneSemError");
+    UtTest_Add(LC_CreateCDSWriter_Test_TaskError, LC_Test_Setup, LC_Test_TearDown, "LC_CreateCDSWriter_Test_TaskError");
+    UtTest_Add(LC_StopCDSWriter_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_StopCDSWriter_Test_Nominal");
+    UtTest_Add(LC_StopCDSWriter_Test_Exited, LC_Test_Setup, LC_Test_TearDown, "LC_StopCDSWriter_Test_Exited");
+    UtTest_Add(LC_StopCDSWriter_Test_Timeout, LC_Test_Setup, LC_Test_TearDown, "LC_StopCDSWriter_Test_Timeout");
+    UtTest_Add(LC_StopCDSWriter_Test_WriteError, LC_Test_Setup, LC_Test_TearDown, "LC_StopCDSWriter_Test_WriteError");
+    UtTest_Add(LC_StopCDSWriter_Test_NotActive, LC_Test_Setup, LC_Test_TearDown, "LC_StopCDSWriter_Test_NotActive");
+    UtTest_Add(LC_CollectCDSWriter_Test, LC_Test_Setup, LC_Test_TearDown, "LC_CollectCDSWriter_Test");
+    UtTest_Add(LC_StageTaskCDS_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_StageTaskCDS_Test_Nominal");
+    UtTest_Add(LC_StageTaskCDS_Test_OnlyDirty,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_StageTaskCDS_Test_OnlyDirty");
+    UtTest_Add(LC_StageTaskCDS_Test_Busy, LC_Test_Setup, LC_Test_TearDown, "LC_StageTaskCDS_Test_Busy");
+    UtTest_Add(LC_StageTaskCDS_Test_WriteError, LC_Test_Setup, LC_Test_TearDown, "LC_StageTaskCDS_Test_WriteError");
+    UtTest_Add(LC_StageTaskCDS_Test_Exited, LC_Test_Setup, LC_Test_TearDown, "LC_StageTaskCDS_Test_Exited");
+    UtTest_Add(LC_StageTaskCDS_Test_GiveError, LC_Test_Setup, LC_Test_TearDown, "LC_StageTaskCDS_Test_GiveError");
+    UtTest_Add(LC_CDSWriterTask_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_CDSWriterTask_Test_Nominal");
+    UtTest_Add(LC_CDSWriterTask_Test_WriteError, LC_Test_Setup, LC_Test_TearDown, "LC_CDSWriterTask_Test_WriteError");
+    UtTest_Add(LC_CDSWriterTask_Test_Stop, LC_Test_Setup, LC_Test_TearDown, "LC_CDSWriterTask_Test_Stop");
 }
@@ -35,6 +35,9 @@
 #include "lc_test_utils.h"
 #include "lc_utils.h"
 #include "lc_custom.h"
+#include "lc_action.h"
+#include "lc_cmds.h"
+#include "lc_platform_cfg.h"
 
 /* UT includes */
 #include "uttest.h"
@@ -43,6 +46,7 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#include <time.h>
 
 uint8 call_count_CFE_EVS_SendEvent;
 
@@ -50,8 +54,10 @@ void LC_CreateHashTable_Test(void)
 {
     uint32 i;
 
-    /* One valid and one invalid unsubscribe */
-    LC_OperData.MessageIDsCount = 2;
+    /* Previous table kept one MessageID and dropped another, which fails to unsubscribe */
+    LC_OperData.MsgIndex->MessageIDsCount          = 2;
+    LC_OperData.MsgIndex->MessageList[0].MessageID = LC_UT_MID_1;
+    LC_OperData.MsgIndex->MessageList[1].MessageID = LC_UT_MID_2;
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_Unsubscribe), 1, -1);
 
     /* Default entries to unused */
@@ -60,7 +66,7 @@ void LC_CreateHashTable_Test(void)
         LC_OperData.WDTPtr[i].DataType = LC_DATA_WATCH_NOT_USED;
     }
 
-    /* Match MsgID but null watch point list */
+    /* First reference to a MsgID */
     LC_OperData.WDTPtr[0].DataType  = LC_DATA_WATCH_BYTE;
     LC_OperData.WDTPtr[0].MessageID = CFE_SB_INVALID_MSG_ID;
 
@@ -68,134 +74,1683 @@ void LC_CreateHashTable_Test(void)
     LC_OperData.WDTPtr[1].DataType  = LC_DATA_WATCH_BYTE;
     LC_OperData.WDTPtr[1].MessageID = LC_UT_MID_1;
 
-    /* Match MsgID and non-NULL WatchPLink */
+    /* Same MsgID as last watchpoint */
     LC_OperData.WDTPtr[2].DataType  = LC_DATA_WATCH_BYTE;
     LC_OperData.WDTPtr[2].MessageID = LC_UT_MID_1;
 
     /* Execute the function being tested */
     LC_CreateHashTable();
 
-    UtAssert_UINT32_EQ(LC_OperData.WatchpointCount, 3);
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->WatchpointCount, 3);
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageIDsCount, 2 + LC_MSG_HANDLER_MIDS);
+    UtAssert_BOOL_TRUE(LC_OperData.MsgIndex->HashValid);
+
+    /* Each MessageID owns a contiguous span in watchpoint table order */
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[0].WatchStart, 0);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[0].WatchCount, 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[1].WatchStart, 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[1].WatchCount, 2);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[0], 0);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[1], 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[2], 2);
+
+    UtAssert_ADDRESS_EQ(LC_FindMessageIndex(LC_UT_MID_1), &LC_OperData.MsgIndex->MessageList[1]);
+    UtAssert_NULL(LC_FindMessageIndex(LC_UT_MID_2));
+
+    /* Only the added MessageID is subscribed and only the dropped one unsubscribed */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_UNSUB_WP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void LC_CreateHashTable_Test_InterleavedMessageIDs(void)
+{
+    uint32 i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    /* MessageIDs alternate so spans must be gathered from the whole table */
+    LC_OperData.WDTPtr[0].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].MessageID = LC_UT_MID_1;
+    LC_OperData.WDTPtr[1].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].MessageID = LC_UT_MID_2;
+    LC_OperData.WDTPtr[5].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[5].MessageID = LC_UT_MID_1;
+
+    /* Execute the function being tested */
+    LC_CreateHashTable();
+
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->WatchpointCount, 3);
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageIDsCount, 2 + LC_MSG_HANDLER_MIDS);
+
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[0].WatchStart, 0);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[0].WatchCount, 2);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[1].WatchStart, 2);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[1].WatchCount, 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[0], 0);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[1], 5);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[2], 1);
+
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CreateHashTable_Test_MaxMessageIDs(void)
+{
+    LC_MessageList_t *MessageList;
+    uint32            i;
+    bool              AllFound = true;
+    bool              SlotUsed[LC_HASH_SLOT_ENTRIES];
+
+    /* Every watchpoint references a different MessageID */
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType  = LC_DATA_WATCH_BYTE;
+        LC_OperData.WDTPtr[i].MessageID = CFE_SB_ValueToMsgId(0x0800 + (i * 7));
+    }
+
+    /* Execute the function being tested */
+    LC_CreateHashTable();
+
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->WatchpointCount, LC_MAX_WATCHPOINTS);
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageIDsCount, LC_MAX_WATCHPOINTS + LC_MSG_HANDLER_MIDS);
+    UtAssert_BOOL_TRUE(LC_OperData.MsgIndex->HashValid);
+
+    /* Every MessageID is found with one probe and owns its own slot */
+    memset(SlotUsed, 0, sizeof(SlotUsed));
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        MessageList = LC_FindMessageIndex(LC_OperData.WDTPtr[i].MessageID);
+
+        if ((MessageList == NULL) || (MessageList->WatchCount != 1) ||
+            (LC_OperData.MsgIndex->WatchPtList[MessageList->WatchStart] != i) ||
+            SlotUsed[LC_GetHashTableIndex(LC_OperData.WDTPtr[i].MessageID)])
+        {
+            AllFound = false;
+        }
+
+        SlotUsed[LC_GetHashTableIndex(LC_OperData.WDTPtr[i].MessageID)] = true;
+    }
+
+    UtAssert_BOOL_TRUE(AllFound);
+    UtAssert_NULL(LC_FindMessageIndex(LC_UT_MID_1));
+
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, LC_MAX_WATCHPOINTS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CreateHashTable_Test_HandlerMIDs(void)
+{
+    LC_MessageList_t *MessageList;
+    uint32            i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    /* A monitor packet and a watchpoint on LC's own command MessageID */
+    LC_OperData.WDTPtr[0].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].MessageID = LC_UT_MID_1;
+    LC_OperData.WDTPtr[1].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].MessageID = CFE_SB_ValueToMsgId(LC_CMD_MID);
+
+    /* Execute the function being tested */
+    LC_CreateHashTable();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageIDsCount, 1 + LC_MSG_HANDLER_MIDS);
+
+    MessageList = LC_FindMessageIndex(LC_UT_MID_1);
+    UtAssert_NOT_NULL(MessageList);
+    UtAssert_UINT8_EQ(MessageList->Handler, LC_MSG_HANDLER_WATCH);
+
+    MessageList = LC_FindMessageIndex(CFE_SB_ValueToMsgId(LC_SAMPLE_AP_MID));
+    UtAssert_NOT_NULL(MessageList);
+    UtAssert_UINT8_EQ(MessageList->Handler, LC_MSG_HANDLER_SAMPLE_AP);
+    UtAssert_UINT16_EQ(MessageList->WatchCount, 0);
+
+    MessageList = LC_FindMessageIndex(CFE_SB_ValueToMsgId(LC_SEND_HK_MID));
+    UtAssert_NOT_NULL(MessageList);
+    UtAssert_UINT8_EQ(MessageList->Handler, LC_MSG_HANDLER_SEND_HK);
+
+    /* The handler takes precedence over the watchpoint */
+    MessageList = LC_FindMessageIndex(CFE_SB_ValueToMsgId(LC_CMD_MID));
+    UtAssert_NOT_NULL(MessageList);
+    UtAssert_UINT8_EQ(MessageList->Handler, LC_MSG_HANDLER_CMD);
+    UtAssert_UINT16_EQ(MessageList->WatchCount, 1);
+
+    /* LC's own MessageIDs are already subscribed to */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CreateHashTable_Test_Reload(void)
+{
+    uint32 i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    LC_OperData.WDTPtr[0].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].MessageID = LC_UT_MID_1;
+    LC_OperData.WDTPtr[1].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].MessageID = LC_UT_MID_2;
+
+    LC_CreateHashTable();
+    UtAssert_ADDRESS_EQ(LC_OperData.MsgIndex, &LC_OperData.MsgIndexBuf[1]);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_MemCmp(LC_OperData.WDTShadow, LC_OperData.WDTPtr, sizeof(LC_OperData.WDTShadow), "WDT saved");
+
+    /* Reloading the same MessageIDs causes no Software Bus traffic */
+    LC_OperData.WDTPtr[1].WatchpointOffset = 4;
+
+    UT_ResetState(UT_KEY(CFE_SB_Subscribe));
+    LC_CreateHashTable();
+
+    /* Each load is built in the spare buffer and then swapped in */
+    UtAssert_ADDRESS_EQ(LC_OperData.MsgIndex, &LC_OperData.MsgIndexBuf[0]);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+    UtAssert_UINT16_EQ(LC_OperData.WDTShadow[1].WatchpointOffset, 4);
+
+    /* Moving one watchpoint to a new MessageID swaps one subscription */
+    LC_OperData.WDTPtr[1].MessageID = CFE_SB_ValueToMsgId(0x0803);
+
+    LC_CreateHashTable();
+
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_NULL(LC_FindMessageIndex(LC_UT_MID_2));
+    UtAssert_NOT_NULL(LC_FindMessageIndex(CFE_SB_ValueToMsgId(0x0803)));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_PublishIndex_Test(void)
+{
+    LC_OperData.HashBuild.Index      = &LC_OperData.MsgIndexBuf[1];
+    LC_OperData.MsgDigest[3].Valid   = true;
+    LC_OperData.UnrefMsgs.EntryCount = 1;
+
+    /* Execute the function being tested */
+    LC_PublishIndex();
+
+    UtAssert_ADDRESS_EQ(LC_OperData.MsgIndex, &LC_OperData.MsgIndexBuf[1]);
+    UtAssert_BOOL_FALSE(LC_OperData.MsgDigest[3].Valid);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 0);
+}
+
+void LC_ResetChangedWatchpoints_Test_Nominal(void)
+{
+    uint32 i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType    = LC_DATA_WATCH_BYTE;
+        LC_OperData.WDTShadow[i].DataType = LC_DATA_WATCH_BYTE;
+    }
+
+    /* Two watchpoints were redefined by the load */
+    LC_OperData.WDTPtr[1].ComparisonValue.Unsigned32    = 5;
+    LC_OperData.WDTPtr[LC_MAX_WATCHPOINTS - 1].DataType = LC_DATA_WATCH_NOT_USED;
+
+    LC_OperData.WatchCache[1].Valid = true;
+    LC_OperData.WatchCache[2].Valid = true;
+
+    /* Execute the function being tested */
+    UtAssert_UINT16_EQ(LC_ResetChangedWatchpoints(), 2);
+
+    UtAssert_STUB_COUNT(LC_ResetResultsWP, 2);
+    UtAssert_BOOL_FALSE(LC_OperData.WatchCache[1].Valid);
+    UtAssert_BOOL_TRUE(LC_OperData.WatchCache[2].Valid);
+}
+
+void LC_ResetChangedWatchpoints_Test_Unchanged(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT16_EQ(LC_ResetChangedWatchpoints(), 0);
+
+    UtAssert_STUB_COUNT(LC_ResetResultsWP, 0);
+}
+
+void LC_AddWatchpoint_Test_NewMessageIDNominal(void)
+{
+    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
+
+    memset(LC_OperData.HashBuild.Lookup, 0xFF, sizeof(LC_OperData.HashBuild.Lookup));
+
+    /* Execute the function being tested */
+    UtAssert_UINT16_EQ(LC_AddWatchpoint(MessageID), 0);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(LC_OperData.MsgIndex->MessageList[0].MessageID, MessageID));
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[0].WatchCount, 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageIDsCount, 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchpointCount, 1);
+
+    /* Subscriptions are made once the whole index is built */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_AddWatchpoint_Test_ExistingMessageID(void)
+{
+    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
+
+    memset(LC_OperData.HashBuild.Lookup, 0xFF, sizeof(LC_OperData.HashBuild.Lookup));
+
+    /* A different MessageID followed by two references to the same one */
+    UtAssert_UINT16_EQ(LC_AddWatchpoint(LC_UT_MID_2), 0);
+    UtAssert_UINT16_EQ(LC_AddWatchpoint(MessageID), 1);
+
+    /* Execute the function being tested */
+    UtAssert_UINT16_EQ(LC_AddWatchpoint(MessageID), 1);
+
+    /* Verify additional used watchpoint */
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchpointCount, 3);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageList[1].WatchCount, 2);
+
+    /* Verify no new message id used */
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->MessageIDsCount, 2);
+
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CreateHashTable_Test_ReloadAfterUnsubscribeError(void)
+{
+    uint32 i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    LC_OperData.WDTPtr[0].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].MessageID = LC_UT_MID_1;
+    LC_OperData.WDTPtr[1].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].MessageID = LC_UT_MID_2;
+
+    LC_CreateHashTable();
+
+    /* Dropping MID 2 fails to unsubscribe, so LC stays subscribed */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Unsubscribe), 1, -1);
+    LC_OperData.WDTPtr[1].DataType = LC_DATA_WATCH_NOT_USED;
+
+    LC_CreateHashTable();
+
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 1);
+    UtAssert_BOOL_TRUE(LC_OperData.UnrefMsgs.Entry[0].Subscribed);
+
+    /* Kept across a load that does not reference it either */
+    LC_CreateHashTable();
+
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 1);
+
+    /* Referencing MID 2 again does not subscribe a second time */
+    UT_ResetState(UT_KEY(CFE_SB_Subscribe));
+    LC_OperData.WDTPtr[1].DataType = LC_DATA_WATCH_BYTE;
+
+    LC_CreateHashTable();
+
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 0);
+    UtAssert_NOT_NULL(LC_FindMessageIndex(LC_UT_MID_2));
+
+    /* Dropping it again unsubscribes */
+    LC_OperData.WDTPtr[1].DataType = LC_DATA_WATCH_NOT_USED;
+
+    LC_CreateHashTable();
+
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 2);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_UNSUB_WP_ERR_EID);
+}
+
+#if LC_UNREF_UNSUB_LIMIT > 0
+void LC_CreateHashTable_Test_ReloadAfterAutoUnsubscribe(void)
+{
+    uint32 i;
+
+    for (i = 0; i < LC_MAX_WATCHPOINTS; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    LC_OperData.WDTPtr[0].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].MessageID = LC_UT_MID_1;
+
+    LC_CreateHashTable();
+
+    /* LC unsubscribes from unreferenced MID 2 */
+    for (i = 0; i < LC_UNREF_UNSUB_LIMIT; i++)
+    {
+        LC_HandleUnreferencedMsg(LC_UT_MID_2);
+    }
+
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_BOOL_FALSE(LC_OperData.UnrefMsgs.Entry[0].Subscribed);
+
+    /* A table that references MID 2 subscribes to it again */
+    UT_ResetState(UT_KEY(CFE_SB_Subscribe));
+    LC_OperData.WDTPtr[1].DataType  = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].MessageID = LC_UT_MID_2;
+
+    LC_CreateHashTable();
+
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 0);
+    UtAssert_NOT_NULL(LC_FindMessageIndex(LC_UT_MID_2));
+}
+#endif
+
+void LC_UpdateSubscriptions_Test_Nominal(void)
+{
+    memset(LC_OperData.HashBuild.Lookup, 0xFF, sizeof(LC_OperData.HashBuild.Lookup));
+
+    /* Active index references MID 1 and MID 2, the one being built MID 2 and MID 3 */
+    LC_OperData.MsgIndex->MessageIDsCount          = 2;
+    LC_OperData.MsgIndex->MessageList[0].MessageID = LC_UT_MID_1;
+    LC_OperData.MsgIndex->MessageList[1].MessageID = LC_UT_MID_2;
+    LC_OperData.HashBuild.Index                    = &LC_OperData.MsgIndexBuf[1];
+
+    LC_AddWatchpoint(LC_UT_MID_2);
+    LC_AddWatchpoint(CFE_SB_ValueToMsgId(0x0803));
+
+    /* Execute the function being tested */
+    LC_UpdateSubscriptions();
+
+    UtAssert_BOOL_TRUE(LC_OperData.HashBuild.Subscribed[0]);
+    UtAssert_BOOL_FALSE(LC_OperData.HashBuild.Subscribed[1]);
+
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_UpdateSubscriptions_Test_ErrorSubscribingWatchpoint(void)
+{
+    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
+    int32          strCmpResult;
+    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString,
+             CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error subscribing watchpoint: MID=0x%%08lX, RC=0x%%08X");
+
+    memset(LC_OperData.HashBuild.Lookup, 0xFF, sizeof(LC_OperData.HashBuild.Lookup));
+    LC_OperData.HashBuild.Index = &LC_OperData.MsgIndexBuf[1];
+    LC_AddWatchpoint(MessageID);
+
+    /* Set to generate error message LC_SUB_WP_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_Subscribe), -1);
+
+    /* Execute the function being tested */
+    LC_UpdateSubscriptions();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_SUB_WP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void LC_BuildPerfectHash_Test_Nominal(void)
+{
+    uint32 i;
+    uint32 Slot;
+    uint32 SlotsUsed = 0;
+
+    LC_OperData.MsgIndex->MessageIDsCount          = 3;
+    LC_OperData.MsgIndex->MessageList[0].MessageID = LC_UT_MID_1;
+    LC_OperData.MsgIndex->MessageList[1].MessageID = LC_UT_MID_2;
+    LC_OperData.MsgIndex->MessageList[2].MessageID = CFE_SB_ValueToMsgId(0x1801);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(LC_BuildPerfectHash());
+
+    /* Verify each MessageID is stored in the slot it hashes to */
+    for (i = 0; i < LC_OperData.MsgIndex->MessageIDsCount; i++)
+    {
+        Slot = LC_GetHashTableIndex(LC_OperData.MsgIndex->MessageList[i].MessageID);
+        UtAssert_UINT32_EQ(LC_OperData.MsgIndex->HashSlots[Slot], i);
+    }
+
+    for (i = 0; i < LC_HASH_SLOT_ENTRIES; i++)
+    {
+        if (LC_OperData.MsgIndex->HashSlots[i] != LC_HASH_SLOT_EMPTY)
+        {
+            SlotsUsed++;
+        }
+    }
+
+    UtAssert_UINT32_EQ(SlotsUsed, 3);
+    UtAssert_BOOL_TRUE(LC_OperData.MsgIndex->HashValid);
+}
+
+void LC_FindMessageIndex_Test_LinearSearch(void)
+{
+    /* Index without a perfect hash falls back to searching the entries */
+    LC_OperData.MsgIndex->HashValid                = false;
+    LC_OperData.MsgIndex->MessageIDsCount          = 2;
+    LC_OperData.MsgIndex->MessageList[0].MessageID = LC_UT_MID_2;
+    LC_OperData.MsgIndex->MessageList[1].MessageID = LC_UT_MID_1;
+
+    /* Execute the function being tested */
+    UtAssert_ADDRESS_EQ(LC_FindMessageIndex(LC_UT_MID_1), &LC_OperData.MsgIndex->MessageList[1]);
+    UtAssert_NULL(LC_FindMessageIndex(CFE_SB_ValueToMsgId(3)));
+}
+
+void LC_FindMessageIndex_Test_SlotOwnedByOtherMessageID(void)
+{
+    LC_OperData.MsgIndex->MessageIDsCount          = 1;
+    LC_OperData.MsgIndex->MessageList[0].MessageID = LC_UT_MID_2;
+    LC_BuildPerfectHash();
+
+    /* Force the probe for MID 1 onto the slot owned by MID 2 */
+    memset(LC_OperData.MsgIndex->HashSlots, 0, sizeof(LC_OperData.MsgIndex->HashSlots));
+
+    /* Execute the function being tested */
+    UtAssert_NULL(LC_FindMessageIndex(LC_UT_MID_1));
+    UtAssert_ADDRESS_EQ(LC_FindMessageIndex(LC_UT_MID_2), &LC_OperData.MsgIndex->MessageList[0]);
+}
+
+void LC_CompileWatchpoints_Test_DataTypes(void)
+{
+    LC_WatchProgram_t *Program = &LC_OperData.MsgIndex->Program;
+    uint16             i;
+
+    /* One watchpoint per data type, listed in reverse table order */
+    for (i = 0; i < 12; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType                   = LC_DATA_WATCH_BYTE + i;
+        LC_OperData.WDTPtr[i].OperatorID                 = LC_OPER_GE;
+        LC_OperData.WDTPtr[i].WatchpointOffset           = i * 4;
+        LC_OperData.WDTPtr[i].BitMask                    = 0x0FF0 + i;
+        LC_OperData.WDTPtr[i].ComparisonValue.Unsigned32 = 0;
+        LC_OperData.MsgIndex->WatchPtList[11 - i]        = i;
+    }
+
+    /* Negative comparison values must be sign extended */
+    LC_OperData.WDTPtr[0].ComparisonValue.Signed8    = -2;
+    LC_OperData.WDTPtr[1].ComparisonValue.Unsigned8  = 0xFE;
+    LC_OperData.WDTPtr[2].ComparisonValue.Signed16   = -3;
+    LC_OperData.WDTPtr[5].ComparisonValue.Unsigned16 = 0xFFFD;
+    LC_OperData.WDTPtr[10].ComparisonValue.Float32   = 1.5;
+
+    /* Custom and invalid operators, invalid data type */
+    LC_OperData.WDTPtr[12].DataType       = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[12].OperatorID     = LC_OPER_CUSTOM;
+    LC_OperData.MsgIndex->WatchPtList[12] = 12;
+    LC_OperData.WDTPtr[13].DataType       = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[13].OperatorID     = LC_OPER_NONE;
+    LC_OperData.MsgIndex->WatchPtList[13] = 13;
+    LC_OperData.WDTPtr[14].DataType       = LC_DATA_WATCH_NOT_USED;
+    LC_OperData.WDTPtr[14].OperatorID     = LC_OPER_LT;
+    LC_OperData.MsgIndex->WatchPtList[14] = 14;
+    LC_OperData.MsgIndex->WatchpointCount = 15;
+
+    /* Execute the function being tested */
+    LC_CompileWatchpoints();
+
+    /* Verify results - program position 11 - i holds watchpoint i */
+    UtAssert_UINT8_EQ(Program->Extract[11], LC_WP_EXTRACT_S8);
+    UtAssert_UINT8_EQ(Program->Opcode[11], LC_WP_OPCODE_SIGNED | LC_OPER_GE);
+    UtAssert_UINT32_EQ(Program->Compare[11], 0xFFFFFFFE);
+    UtAssert_UINT32_EQ(Program->Offset[11], 0);
+    UtAssert_UINT32_EQ(Program->BitMask[11], 0x0FF0);
+
+    UtAssert_UINT8_EQ(Program->Extract[10], LC_WP_EXTRACT_U8);
+    UtAssert_UINT8_EQ(Program->Opcode[10], LC_WP_OPCODE_UNSIGNED | LC_OPER_GE);
+    UtAssert_UINT32_EQ(Program->Compare[10], 0xFE);
+
+    UtAssert_UINT8_EQ(Program->Extract[9], LC_WP_EXTRACT_S16_BE);
+    UtAssert_UINT32_EQ(Program->Compare[9], 0xFFFFFFFD);
+    UtAssert_UINT8_EQ(Program->Extract[8], LC_WP_EXTRACT_S16_LE);
+    UtAssert_UINT8_EQ(Program->Extract[7], LC_WP_EXTRACT_U16_BE);
+    UtAssert_UINT8_EQ(Program->Extract[6], LC_WP_EXTRACT_U16_LE);
+    UtAssert_UINT32_EQ(Program->Compare[6], 0xFFFD);
+
+    UtAssert_UINT8_EQ(Program->Extract[5], LC_WP_EXTRACT_U32_BE);
+    UtAssert_UINT8_EQ(Program->Opcode[5], LC_WP_OPCODE_SIGNED | LC_OPER_GE);
+    UtAssert_UINT8_EQ(Program->Extract[4], LC_WP_EXTRACT_U32_LE);
+    UtAssert_UINT8_EQ(Program->Extract[3], LC_WP_EXTRACT_U32_BE);
+    UtAssert_UINT8_EQ(Program->Opcode[3], LC_WP_OPCODE_UNSIGNED | LC_OPER_GE);
+    UtAssert_UINT8_EQ(Program->Extract[2], LC_WP_EXTRACT_U32_LE);
+
+    UtAssert_UINT8_EQ(Program->Extract[1], LC_WP_EXTRACT_U32_BE);
+    UtAssert_UINT8_EQ(Program->Opcode[1], LC_WP_OPCODE_FLOAT | LC_OPER_GE);
+    UtAssert_UINT32_EQ(Program->Compare[1], LC_OperData.WDTPtr[10].ComparisonValue.Unsigned32);
+    UtAssert_UINT8_EQ(Program->Extract[0], LC_WP_EXTRACT_U32_LE);
+    UtAssert_UINT32_EQ(Program->Offset[0], 44);
+
+    UtAssert_UINT8_EQ(Program->Opcode[12], LC_WP_OPCODE_CUSTOM);
+    UtAssert_UINT8_EQ(Program->Opcode[13], LC_WP_OPCODE_LEGACY);
+    UtAssert_UINT8_EQ(Program->Opcode[14], LC_WP_OPCODE_LEGACY);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CompileWatchpoints_Test_RangeOperators(void)
+{
+    LC_WatchProgram_t *Program = &LC_OperData.MsgIndex->Program;
+
+    LC_OperData.WDTPtr[0].DataType                         = LC_DATA_WATCH_UWORD_LE;
+    LC_OperData.WDTPtr[0].OperatorID                       = LC_OPER_IN_RANGE;
+    LC_OperData.WDTPtr[0].ComparisonValue.Unsigned16       = 10;
+    LC_OperData.WDTPtr[0].SecondComparisonValue.Unsigned16 = 0xFFF0;
+    LC_OperData.MsgIndex->WatchPtList[0]                   = 0;
+
+    /* Set above the clear threshold */
+    LC_OperData.WDTPtr[1].DataType                      = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].OperatorID                    = LC_OPER_HYSTERESIS;
+    LC_OperData.WDTPtr[1].ComparisonValue.Signed8       = 5;
+    LC_OperData.WDTPtr[1].SecondComparisonValue.Signed8 = -5;
+    LC_OperData.MsgIndex->WatchPtList[1]                = 1;
+
+    /* Set below the clear threshold */
+    LC_OperData.WDTPtr[2].DataType                      = LC_DATA_WATCH_FLOAT_BE;
+    LC_OperData.WDTPtr[2].OperatorID                    = LC_OPER_HYSTERESIS;
+    LC_OperData.WDTPtr[2].ComparisonValue.Float32       = -1.5;
+    LC_OperData.WDTPtr[2].SecondComparisonValue.Float32 = 2.5;
+    LC_OperData.MsgIndex->WatchPtList[2]                = 2;
+
+    /* 64 bit range watchpoints are not compiled */
+    LC_OperData.WDTPtr[3].DataType        = LC_DATA_WATCH_UQWORD_BE;
+    LC_OperData.WDTPtr[3].OperatorID      = LC_OPER_OUT_OF_RANGE;
+    LC_OperData.MsgIndex->WatchPtList[3]  = 3;
+    LC_OperData.MsgIndex->WatchpointCount = 4;
+
+    /* Execute the function being tested */
+    LC_CompileWatchpoints();
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(Program->Opcode[0], LC_WP_OPCODE_UNSIGNED | LC_OPER_IN_RANGE);
+    UtAssert_UINT32_EQ(Program->Compare[0], 10);
+    UtAssert_UINT32_EQ(Program->SecondCompare[0], 0xFFF0);
+
+    UtAssert_UINT8_EQ(Program->Opcode[1], LC_WP_OPCODE_SIGNED | LC_OPER_HYSTERESIS);
+    UtAssert_UINT32_EQ(Program->Compare[1], 5);
+    UtAssert_UINT32_EQ(Program->SecondCompare[1], 0xFFFFFFFB);
+
+    UtAssert_UINT8_EQ(Program->Opcode[2], LC_WP_OPCODE_FLOAT | LC_WP_OPER_HYSTERESIS_LOW);
+    UtAssert_UINT32_EQ(Program->SecondCompare[2], LC_OperData.WDTPtr[2].SecondComparisonValue.Unsigned32);
+
+    UtAssert_UINT8_EQ(Program->Opcode[3], LC_WP_OPCODE_LEGACY);
+    UtAssert_UINT32_EQ(Program->SecondCompare[3], 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_ExtractWPData_Test(void)
+{
+    const uint8 Data[4] = { 0x81, 0x82, 0x83, 0x84 };
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_U8, Data), 0x81);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_S8, Data), 0xFFFFFF81);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_U16_BE, Data), 0x8182);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_U16_LE, Data), 0x8281);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_S16_BE, Data), 0xFFFF8182);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_S16_LE, Data), 0xFFFF8281);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_U32_BE, Data), 0x81828384);
+    UtAssert_UINT32_EQ(LC_ExtractWPData(LC_WP_EXTRACT_U32_LE, Data), 0x84838281);
+}
+
+void LC_LoadBE16_Test_Misaligned(void)
+{
+    const uint8 Data[10] = { 0x00, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x00 };
+
+    /* Execute the functions being tested on an odd address */
+    UtAssert_UINT16_EQ(LC_LoadBE16(&Data[1]), 0x8182);
+    UtAssert_UINT16_EQ(LC_LoadLE16(&Data[1]), 0x8281);
+    UtAssert_UINT32_EQ(LC_LoadBE32(&Data[1]), 0x81828384);
+    UtAssert_UINT32_EQ(LC_LoadLE32(&Data[1]), 0x84838281);
+    UtAssert_True(LC_LoadBE64(&Data[1]) == 0x8182838485868788ULL, "LC_LoadBE64 == 0x8182838485868788");
+    UtAssert_True(LC_LoadLE64(&Data[1]) == 0x8887868584838281ULL, "LC_LoadLE64 == 0x8887868584838281");
+}
+
+/* Byte map copy that LC_GetSizedWPData used before the extractors, kept as a benchmark baseline */
+void LC_Test_CopyBytesWithSwap(LC_MultiType_t *DestBuffer, const uint8 *SrcPtr, LC_MultiType_t *SwapMap,
+                               uint32 NumBytes)
+{
+    uint8       *DestPtr;
+    const uint8 *SwapMapPtr;
+
+    DestPtr    = (uint8 *)DestBuffer;
+    SwapMapPtr = (const uint8 *)SwapMap;
+    while (NumBytes > 0)
+    {
+        --NumBytes;
+        DestPtr[NumBytes] = SrcPtr[SwapMapPtr[NumBytes] & 0x3];
+    }
+}
+
+/* Sized data for DataType using the byte map copy */
+uint32 LC_Test_ByteMapSizedData(uint8 DataType, const uint8 *WPDataPtr)
+{
+    LC_MultiType_t ConvBuffer;
+    LC_MultiType_t TempBuffer;
+    uint32         SizedData;
+
+    ConvBuffer.Unsigned32 = 0;
+    TempBuffer.Unsigned32 = 0;
+
+    switch (DataType)
+    {
+        case LC_DATA_WATCH_BYTE:
+            TempBuffer.Signed8 = *WPDataPtr;
+            SizedData          = TempBuffer.Signed8;
+            break;
+
+        case LC_DATA_WATCH_UBYTE:
+            SizedData = *WPDataPtr;
+            break;
+
+        case LC_DATA_WATCH_WORD_BE:
+        case LC_DATA_WATCH_WORD_LE:
+            ConvBuffer.Unsigned16 = (DataType == LC_DATA_WATCH_WORD_BE) ? 0x0001 : 0x0100;
+            LC_Test_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(int16));
+            SizedData = TempBuffer.Signed16;
+            break;
+
+        case LC_DATA_WATCH_UWORD_BE:
+        case LC_DATA_WATCH_UWORD_LE:
+            ConvBuffer.Unsigned16 = (DataType == LC_DATA_WATCH_UWORD_BE) ? 0x0001 : 0x0100;
+            LC_Test_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint16));
+            SizedData = TempBuffer.Unsigned16;
+            break;
+
+        case LC_DATA_WATCH_DWORD_BE:
+        case LC_DATA_WATCH_UDWORD_BE:
+        case LC_DATA_WATCH_FLOAT_BE:
+            ConvBuffer.Unsigned32 = 0x00010203;
+            LC_Test_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint32));
+            SizedData = TempBuffer.Unsigned32;
+            break;
+
+        default:
+            ConvBuffer.Unsigned32 = 0x03020100;
+            LC_Test_CopyBytesWithSwap(&TempBuffer, WPDataPtr, &ConvBuffer, sizeof(uint32));
+            SizedData = TempBuffer.Unsigned32;
+            break;
+    }
+
+    return SizedData;
+}
+
+void LC_GetSizedWPData_Test_Benchmark(void)
+{
+    static const char *TypeNames[]   = { "BYTE",     "UBYTE",     "WORD_BE",   "WORD_LE",   "UWORD_BE", "UWORD_LE",
+                                         "DWORD_BE", "DWORD_LE",  "UDWORD_BE", "UDWORD_LE", "FLOAT_BE", "FLOAT_LE" };
+    static const uint8 TypeExtract[] = { LC_WP_EXTRACT_S8,     LC_WP_EXTRACT_U8,     LC_WP_EXTRACT_S16_BE,
+                                         LC_WP_EXTRACT_S16_LE, LC_WP_EXTRACT_U16_BE, LC_WP_EXTRACT_U16_LE,
+                                         LC_WP_EXTRACT_U32_BE, LC_WP_EXTRACT_U32_LE, LC_WP_EXTRACT_U32_BE,
+                                         LC_WP_EXTRACT_U32_LE, LC_WP_EXTRACT_U32_BE, LC_WP_EXTRACT_U32_LE };
+
+    /* Both are called through a pointer so neither is inlined into the loop */
+    uint32 (*volatile ByteMapFunc)(uint8, const uint8 *) = LC_Test_ByteMapSizedData;
+    uint32 (*volatile ExtractFunc)(uint8, const uint8 *) = LC_ExtractWPData;
+    uint8           Packet[68];
+    uint32          Loops = 20000;
+    uint32          DataType;
+    uint32          Loop;
+    uint32          Offset;
+    uint64          SizedData;
+    uint32          Mismatches = 0;
+    volatile uint32 Sink       = 0;
+    clock_t         Start;
+    double          ByteMapNs;
+    double          ExtractNs;
+    uint8           Extract;
+    uint32          i;
+
+    for (i = 0; i < sizeof(Packet); i++)
+    {
+        Packet[i] = (uint8)((i * 37) + 0x81);
+    }
+
+    for (DataType = LC_DATA_WATCH_BYTE; DataType <= LC_DATA_WATCH_FLOAT_LE; DataType++)
+    {
+        LC_OperData.WDTPtr[0].DataType = DataType;
+        Extract                        = TypeExtract[DataType - LC_DATA_WATCH_BYTE];
+
+        /* Every offset, so most reads are misaligned */
+        for (Offset = 0; Offset < 64; Offset++)
+        {
+            LC_GetSizedWPData(0, &Packet[Offset], &SizedData);
+
+            if (SizedData != LC_Test_ByteMapSizedData(DataType, &Packet[Offset]))
+            {
+                Mismatches++;
+            }
+        }
+
+        Start = clock();
+        for (Loop = 0; Loop < Loops; Loop++)
+        {
+            for (Offset = 0; Offset < 64; Offset++)
+            {
+                Sink += ByteMapFunc(DataType, &Packet[Offset]);
+            }
+        }
+        ByteMapNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / (Loops * 64.0);
+
+        Start = clock();
+        for (Loop = 0; Loop < Loops; Loop++)
+        {
+            for (Offset = 0; Offset < 64; Offset++)
+            {
+                Sink += ExtractFunc(Extract, &Packet[Offset]);
+            }
+        }
+        ExtractNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / (Loops * 64.0);
+
+        UtPrintf("Extract %-9s: byte map %6.2f ns, extractor %6.2f ns", TypeNames[DataType - LC_DATA_WATCH_BYTE],
+                 ByteMapNs, ExtractNs);
+    }
+
+    (void)Sink;
+
+    UtAssert_UINT32_EQ(Mismatches, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_ProcessCompiledWP_Test_MatchesProcessWP(void)
+{
+    static const uint8  TestBytes[][4] = { { 0x00, 0x00, 0x00, 0x00 }, { 0x01, 0x02, 0x03, 0x04 },
+                                          { 0x80, 0x00, 0x00, 0x01 }, { 0xFF, 0xFF, 0xFF, 0xFF },
+                                          { 0x7F, 0xFF, 0xFF, 0xFF }, { 0x3F, 0x80, 0x00, 0x00 },
+                                          { 0x00, 0x00, 0x80, 0x3F }, { 0x7F, 0xC0, 0x00, 0x00 } };
+    static const uint32 TestCompare[]  = { 0, 1, 0x80, 0x8001, 0xFFFFFFFF, 0x3F800000, 0x0000803F };
+    static const uint32 TestMask[]     = { LC_BITMASK_NONE, 0x0000FF00, 0x8000FFFF };
+    static const uint8  TestPrevious[] = { LC_WATCH_STALE, LC_WATCH_FALSE, LC_WATCH_TRUE };
+    LC_PacketTime_t     PacketTime     = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+    LC_WRTEntry_t       Expected;
+    uint8              *Data = (uint8 *)&UT_CmdBuf + 8;
+    uint32              DataType;
+    static const uint8  TestOpers[] = { LC_OPER_LT,       LC_OPER_LE,           LC_OPER_NE,
+                                        LC_OPER_EQ,       LC_OPER_GE,           LC_OPER_GT,
+                                        LC_OPER_IN_RANGE, LC_OPER_OUT_OF_RANGE, LC_OPER_HYSTERESIS };
+    uint32              o, b, c, m, p;
+    uint32              Mismatches     = 0;
+    uint32              Evaluations    = 0;
+    uint32              RefEvents      = 0;
+    uint32              CompiledEvents = 0;
+    uint32              EventCount;
+
+    /* Only the number of events is checked, not their content */
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), NULL, NULL);
+
+    LC_OperData.MsgIndex->WatchPtList[0]  = 0;
+    LC_OperData.MsgIndex->WatchpointCount = 1;
+
+    for (DataType = LC_DATA_WATCH_BYTE; DataType <= LC_DATA_WATCH_FLOAT_LE; DataType++)
+    {
+        for (o = 0; o < sizeof(TestOpers); o++)
+        {
+            for (b = 0; b < sizeof(TestBytes) / sizeof(TestBytes[0]); b++)
+            {
+                for (c = 0; c < sizeof(TestCompare) / sizeof(TestCompare[0]); c++)
+                {
+                    for (m = 0; m < sizeof(TestMask) / sizeof(TestMask[0]); m++)
+                    {
+                        memcpy(Data, TestBytes[b], 4);
+                        LC_OperData.WDTPtr[0].DataType                   = DataType;
+                        LC_OperData.WDTPtr[0].OperatorID                 = TestOpers[o];
+                        LC_OperData.WDTPtr[0].WatchpointOffset           = 8;
+                        LC_OperData.WDTPtr[0].BitMask                    = TestMask[m];
+                        LC_OperData.WDTPtr[0].ComparisonValue.Unsigned32 = TestCompare[c];
+                        LC_OperData.WDTPtr[0].ResultAgeWhenStale         = 4;
+
+                        /* Range bounds in either order and hysteresis in both directions */
+                        LC_OperData.WDTPtr[0].SecondComparisonValue.Unsigned32 =
+                            TestCompare[(c + b) % (sizeof(TestCompare) / sizeof(TestCompare[0]))];
+                        LC_CompileWatchpoints();
+
+                        p = (b + c + m) % 3;
+
+                        memset(&LC_OperData.WRTPtr[0], 0, sizeof(LC_WRTEntry_t));
+                        LC_OperData.WRTPtr[0].WatchResult = TestPrevious[p];
+                        EventCount                        = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+                        LC_ProcessWP(0, &UT_CmdBuf.Buf, &PacketTime);
+                        RefEvents += UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - EventCount;
+                        Expected = LC_OperData.WRTPtr[0];
+
+                        memset(&LC_OperData.WRTPtr[0], 0, sizeof(LC_WRTEntry_t));
+                        LC_OperData.WRTPtr[0].WatchResult = TestPrevious[p];
+                        EventCount                        = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+                        LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+                        CompiledEvents += UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - EventCount;
+
+                        if (memcmp(&Expected, &LC_OperData.WRTPtr[0], sizeof(LC_WRTEntry_t)) != 0)
+                        {
+                            Mismatches++;
+                        }
+
+                        Evaluations++;
+                    }
+                }
+            }
+        }
+    }
+
+    UtPrintf("Compared %u compiled watchpoint evaluations", (unsigned int)Evaluations);
+    UtAssert_UINT32_EQ(Mismatches, 0);
+    UtAssert_UINT32_EQ(CompiledEvents, RefEvents);
+    UtAssert_NONZERO(RefEvents);
+}
+
+void LC_ProcessCompiledWP_Test_Custom(void)
+{
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+
+    LC_OperData.WDTPtr[2].DataType           = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[2].OperatorID         = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[2].BitMask            = LC_BITMASK_NONE;
+    LC_OperData.WDTPtr[2].ResultAgeWhenStale = 1;
+    LC_OperData.MsgIndex->WatchPtList[0]     = 2;
+    LC_OperData.MsgIndex->WatchpointCount    = 1;
+    LC_CompileWatchpoints();
+
+    UT_SetDefaultReturnValue(UT_KEY(LC_CustomFunction), LC_WATCH_TRUE);
+
+    /* Execute the function being tested */
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(LC_CustomFunction, 1);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[2].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].EvaluationCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_ProcessCompiledWP_Test_Legacy(void)
+{
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+
+    /* Data type that cannot be compiled */
+    LC_OperData.WDTPtr[0].DataType        = 99;
+    LC_OperData.WDTPtr[0].OperatorID      = LC_OPER_LT;
+    LC_OperData.MsgIndex->WatchPtList[0]  = 0;
+    LC_OperData.MsgIndex->WatchpointCount = 1;
+    LC_CompileWatchpoints();
+
+    /* Execute the function being tested */
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[0].WatchResult, LC_WATCH_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_DATATYPE_ERR_EID);
+}
+
+void LC_ProcessCompiledWP_Test_ChangeOnly(void)
+{
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+    uint8             *Data      = (uint8 *)&UT_CmdBuf + 8;
+
+    LC_OperData.WDTPtr[2].DataType           = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[2].OperatorID         = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[2].WatchOptions       = LC_WATCH_OPT_CHANGE_ONLY;
+    LC_OperData.WDTPtr[2].WatchpointOffset   = 8;
+    LC_OperData.WDTPtr[2].BitMask            = 0x0F;
+    LC_OperData.WDTPtr[2].ResultAgeWhenStale = 4;
+    LC_OperData.MsgIndex->WatchPtList[0]     = 2;
+    LC_OperData.MsgIndex->WatchpointCount    = 1;
+    LC_CompileWatchpoints();
+
+    UT_SetDefaultReturnValue(UT_KEY(LC_CustomFunction), LC_WATCH_TRUE);
+
+    /* Execute the function being tested */
+    Data[0] = 0x01;
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+    LC_OperData.WRTPtr[2].CountdownToStale--;
+
+    /* Only masked out bits changed */
+    Data[0] = 0x11;
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(LC_CustomFunction, 1);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 1);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[2].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].EvaluationCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].ConsecutiveTrueCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].CumulativeTrueCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].FalseToTrueCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].CountdownToStale, 4);
+
+    /* Changed data is evaluated */
+    Data[0] = 0x12;
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+
+    UtAssert_STUB_COUNT(LC_CustomFunction, 2);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 1);
+
+    /* A result that went stale is evaluated again */
+    LC_OperData.WRTPtr[2].WatchResult = LC_WATCH_STALE;
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+
+    UtAssert_STUB_COUNT(LC_CustomFunction, 3);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].EvaluationCount, 4);
+}
+
+void LC_ProcessCompiledWP_Test_ChangeOnlyNotSet(void)
+{
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+
+    LC_OperData.WDTPtr[2].DataType           = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[2].OperatorID         = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[2].BitMask            = LC_BITMASK_NONE;
+    LC_OperData.WDTPtr[2].ResultAgeWhenStale = 1;
+    LC_OperData.MsgIndex->WatchPtList[0]     = 2;
+    LC_OperData.MsgIndex->WatchpointCount    = 1;
+    LC_CompileWatchpoints();
+
+    UT_SetDefaultReturnValue(UT_KEY(LC_CustomFunction), LC_WATCH_TRUE);
+
+    /* Execute the function being tested */
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+    LC_ProcessCompiledWP(0, &UT_CmdBuf.Buf, &PacketTime);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(LC_CustomFunction, 2);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 0);
+    UtAssert_BOOL_FALSE(LC_OperData.WatchCache[2].Valid);
+}
+
+/* Builds a dispatch index where TestMsgId has the watchpoint span [0, WatchCount) */
+void LC_Test_SetupMsgIndex(CFE_SB_MsgId_t TestMsgId, uint16 WatchCount)
+{
+    LC_OperData.MsgIndex->MessageIDsCount           = 2;
+    LC_OperData.MsgIndex->MessageList[0].MessageID  = LC_UT_MID_2;
+    LC_OperData.MsgIndex->MessageList[0].WatchStart = WatchCount;
+    LC_OperData.MsgIndex->MessageList[1].MessageID  = TestMsgId;
+    LC_OperData.MsgIndex->MessageList[1].WatchStart = 0;
+    LC_OperData.MsgIndex->MessageList[1].WatchCount = WatchCount;
+    LC_OperData.MsgIndex->WatchpointCount           = WatchCount;
+
+    LC_BuildPerfectHash();
+}
+
+void LC_CompareWatchBatch_Test_MatchesScalar(void)
+{
+    static const uint32 TestSpecial[] = { 0x00000000, 0x80000000, 0x7F800000, 0xFF800000, 0x7FC00000,
+                                          0xFFFFFFFF, 0x00000001, 0x3F800000, 0x3F800001, 0x7FFFFFFF };
+    uint32              Values[LC_WP_BATCH_LANES];
+    uint32              Compare[LC_WP_BATCH_LANES];
+    uint32              Kind;
+    uint32              OperatorID;
+    uint32              Count;
+    uint32              Lane;
+    uint32              Seed       = 0x1234567;
+    uint32              TrueMask;
+    uint32              NanMask;
+    uint32              ScalarTrueMask;
+    uint32              ScalarNanMask;
+    uint32              Mismatches = 0;
+    uint32              LaneErrors = 0;
+    uint8               Opcode;
+
+    for (Count = 0; Count <= LC_WP_BATCH_LANES; Count++)
+    {
+        /* Mix random lanes with equal values and special floats */
+        for (Lane = 0; Lane < LC_WP_BATCH_LANES; Lane++)
+        {
+            Seed          = (Seed * 1103515245) + 12345;
+            Values[Lane]  = Seed ^ (Seed << 13);
+            Compare[Lane] = ((Lane % 3) == 0) ? Values[Lane] : (Values[Lane] + (Lane % 5) - 2);
+
+            if ((Lane % 4) == 1)
+            {
+                Values[Lane]  = TestSpecial[(Lane + Count) % (sizeof(TestSpecial) / sizeof(TestSpecial[0]))];
+                Compare[Lane] = TestSpecial[(Lane + 3) % (sizeof(TestSpecial) / sizeof(TestSpecial[0]))];
+            }
+        }
+
+        for (Kind = LC_WP_OPCODE_SIGNED; Kind <= LC_WP_OPCODE_FLOAT; Kind += LC_WP_OPCODE_SIGNED)
+        {
+            for (OperatorID = LC_OPER_LT; OperatorID <= LC_OPER_GT; OperatorID++)
+            {
+                Opcode = Kind | OperatorID;
+
+                TrueMask       = LC_CompareWatchBatch(Opcode, Values, Compare, Count, &NanMask);
+                ScalarTrueMask = LC_CompareWatchBatchScalar(Opcode, Values, Compare, Count, &ScalarNanMask);
+
+                if ((TrueMask != ScalarTrueMask) || (NanMask != ScalarNanMask))
+                {
+                    Mismatches++;
+                }
+
+                for (Lane = 0; Lane < Count; Lane++)
+                {
+                    if (((ScalarNanMask >> Lane) & 1) == 0 &&
+                        (((ScalarTrueMask >> Lane) & 1) == 1) !=
+                            (LC_CompareCompiledValue(Opcode, Values[Lane], Compare[Lane]) == LC_WATCH_TRUE))
+                    {
+                        LaneErrors++;
+                    }
+                }
+            }
+        }
+    }
+
+    UtAssert_UINT32_EQ(Mismatches, 0);
+    UtAssert_UINT32_EQ(LaneErrors, 0);
+}
+
+void LC_CompareCompiledRange_Test(void)
+{
+    uint8 Opcode;
+
+    /* Inclusive bounds */
+    Opcode = LC_WP_OPCODE_UNSIGNED | LC_OPER_IN_RANGE;
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 9, 10, 20, LC_WATCH_FALSE), LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 10, 10, 20, LC_WATCH_FALSE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 20, 10, 20, LC_WATCH_FALSE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 21, 10, 20, LC_WATCH_TRUE), LC_WATCH_FALSE);
+
+    Opcode = LC_WP_OPCODE_SIGNED | LC_OPER_OUT_OF_RANGE;
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, (uint32)-11, (uint32)-10, 10, LC_WATCH_FALSE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, (uint32)-10, (uint32)-10, 10, LC_WATCH_TRUE), LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 11, (uint32)-10, 10, LC_WATCH_FALSE), LC_WATCH_TRUE);
+
+    /* Set at 20 and above, clear at 10 and below, hold in between */
+    Opcode = LC_WP_OPCODE_SIGNED | LC_OPER_HYSTERESIS;
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 20, 20, 10, LC_WATCH_FALSE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 15, 20, 10, LC_WATCH_TRUE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 15, 20, 10, LC_WATCH_FALSE), LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 15, 20, 10, LC_WATCH_STALE), LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 10, 20, 10, LC_WATCH_TRUE), LC_WATCH_FALSE);
+
+    /* Set at 10 and below, clear at 20 and above */
+    Opcode = LC_WP_OPCODE_UNSIGNED | LC_WP_OPER_HYSTERESIS_LOW;
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 10, 10, 20, LC_WATCH_FALSE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 15, 10, 20, LC_WATCH_TRUE), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 15, 10, 20, LC_WATCH_FALSE), LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_CompareCompiledRange(Opcode, 20, 10, 20, LC_WATCH_TRUE), LC_WATCH_FALSE);
+}
+
+void LC_CompareWatchBatchRange_Test_MatchesScalar(void)
+{
+    static const uint8 TestOpers[] = { LC_OPER_IN_RANGE, LC_OPER_OUT_OF_RANGE, LC_OPER_HYSTERESIS,
+                                       LC_WP_OPER_HYSTERESIS_LOW };
+    uint32             Values[LC_WP_BATCH_LANES];
+    uint32             Low[LC_WP_BATCH_LANES];
+    uint32             High[LC_WP_BATCH_LANES];
+    uint32             Kind;
+    uint32             Count;
+    uint32             Lane;
+    uint32             o;
+    uint32             Seed       = 0x7654321;
+    uint32             HoldMask;
+    uint32             TrueMask;
+    uint32             NanMask;
+    uint32             LaneErrors = 0;
+    uint8              Opcode;
+    uint8              Previous;
+
+    for (Count = 0; Count <= LC_WP_BATCH_LANES; Count++)
+    {
+        for (Lane = 0; Lane < LC_WP_BATCH_LANES; Lane++)
+        {
+            Seed         = (Seed * 1103515245) + 12345;
+            Values[Lane] = Seed ^ (Seed << 11);
+            Low[Lane]    = Values[Lane] - (Lane % 3);
+            High[Lane]   = ((Lane % 4) == 0) ? Values[Lane] : (Values[Lane] + (Lane % 5) - 2);
+        }
+
+        Seed     = (Seed * 1103515245) + 12345;
+        HoldMask = Seed;
+
+        for (Kind = LC_WP_OPCODE_SIGNED; Kind <= LC_WP_OPCODE_FLOAT; Kind += LC_WP_OPCODE_SIGNED)
+        {
+            for (o = 0; o < sizeof(TestOpers); o++)
+            {
+                Opcode = Kind | TestOpers[o];
+
+                TrueMask = LC_CompareWatchBatchRange(Opcode, Values, Low, High, HoldMask, Count, &NanMask);
+
+                for (Lane = 0; Lane < Count; Lane++)
+                {
+                    Previous = ((HoldMask >> Lane) & 1) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+
+                    if (((NanMask >> Lane) & 1) == 0 &&
+                        (((TrueMask >> Lane) & 1) == 1) !=
+                            (LC_CompareCompiledRange(Opcode, Values[Lane], Low[Lane], High[Lane], Previous) ==
+                             LC_WATCH_TRUE))
+                    {
+                        LaneErrors++;
+                    }
+                }
+            }
+        }
+    }
+
+    UtAssert_UINT32_EQ(LaneErrors, 0);
+}
+
+void LC_GroupWatchpoints_Test(void)
+{
+    LC_WatchProgram_t *Program = &LC_OperData.MsgIndex->Program;
+    uint16             i;
+
+    /* Two messageIDs, the second has alternating data types */
+    LC_OperData.MsgIndex->MessageIDsCount           = 2;
+    LC_OperData.MsgIndex->MessageList[0].WatchStart = 0;
+    LC_OperData.MsgIndex->MessageList[0].WatchCount = 1;
+    LC_OperData.MsgIndex->MessageList[1].WatchStart = 1;
+    LC_OperData.MsgIndex->MessageList[1].WatchCount = 9;
+    LC_OperData.MsgIndex->WatchpointCount           = 10;
+
+    for (i = 0; i < 10; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType       = ((i % 2) == 0) ? LC_DATA_WATCH_UBYTE : LC_DATA_WATCH_BYTE;
+        LC_OperData.WDTPtr[i].OperatorID     = LC_OPER_EQ;
+        LC_OperData.MsgIndex->WatchPtList[i] = i;
+    }
+
+    LC_OperData.WDTPtr[0].DataType   = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[5].OperatorID = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[9].OperatorID = LC_OPER_CUSTOM;
+    LC_CompileWatchpoints();
+
+    /* Execute the function being tested */
+    LC_GroupWatchpoints();
+
+    /* Verify results - signed group first, each group in table order */
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[0], 0);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[1], 1);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[2], 3);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[3], 7);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[4], 2);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[5], 4);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[6], 6);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[7], 8);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[8], 5);
+    UtAssert_UINT16_EQ(LC_OperData.MsgIndex->WatchPtList[9], 9);
+
+    /* Runs stop at the end of each span and group */
+    UtAssert_UINT16_EQ(Program->RunLength[0], 1);
+    UtAssert_UINT16_EQ(Program->RunLength[1], 3);
+    UtAssert_UINT16_EQ(Program->RunLength[2], 2);
+    UtAssert_UINT16_EQ(Program->RunLength[3], 1);
+    UtAssert_UINT16_EQ(Program->RunLength[4], 4);
+    UtAssert_UINT16_EQ(Program->RunLength[7], 1);
+
+    /* Custom watchpoints are never batched */
+    UtAssert_UINT8_EQ(Program->Opcode[8], LC_WP_OPCODE_CUSTOM);
+    UtAssert_UINT16_EQ(Program->RunLength[8], 1);
+    UtAssert_UINT16_EQ(Program->RunLength[9], 1);
+}
+
+void LC_ProcessWatchBatch_Test_MatchesProcessWP(void)
+{
+    static uint32      PacketWords[64];
+    CFE_SB_Buffer_t   *PacketPtr  = (CFE_SB_Buffer_t *)PacketWords;
+    uint8             *Packet     = (uint8 *)PacketWords;
+    size_t             MsgSize    = sizeof(PacketWords) - 2;
+    CFE_SB_MsgId_t     TestMsgId  = LC_UT_MID_1;
+    CFE_TIME_SysTime_t Timestamp  = { .Seconds = 3, .Subseconds = 5 };
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+    LC_WRTEntry_t      Expected[40];
+    static const uint8 TestOpers[] = { LC_OPER_LT,       LC_OPER_LE,           LC_OPER_NE,
+                                       LC_OPER_EQ,       LC_OPER_GE,           LC_OPER_GT,
+                                       LC_OPER_IN_RANGE, LC_OPER_OUT_OF_RANGE, LC_OPER_HYSTERESIS };
+    uint32             DataType;
+    uint32             o;
+    uint32             Seed       = 0xC0FFEE;
+    uint32             Mismatches = 0;
+    uint32             Batches    = 0;
+    uint32             RefEvents;
+    uint32             BatchEvents;
+    uint32             EventCount;
+    uint16             i;
+
+    /* Only the number of events is checked, not their content */
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), NULL, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    for (i = 0; i < sizeof(PacketWords); i++)
+    {
+        Seed      = (Seed * 1103515245) + 12345;
+        Packet[i] = (uint8)(Seed >> 16);
+    }
+
+    /* A float NAN and infinity in the packet */
+    memcpy(&Packet[16], "\x7F\xC0\x00\x01", 4);
+    memcpy(&Packet[24], "\x00\x00\x80\x7F", 4);
+
+    for (DataType = LC_DATA_WATCH_BYTE; DataType <= LC_DATA_WATCH_FLOAT_LE; DataType++)
+    {
+        for (o = 0; o < sizeof(TestOpers); o++)
+        {
+            /* 40 like watchpoints need a full and a partial batch */
+            LC_Test_SetupMsgIndex(TestMsgId, 40);
+
+            for (i = 0; i < 40; i++)
+            {
+                Seed = (Seed * 1103515245) + 12345;
+
+                LC_OperData.WDTPtr[i].DataType           = DataType;
+                LC_OperData.WDTPtr[i].OperatorID         = TestOpers[o];
+                LC_OperData.WDTPtr[i].WatchpointOffset   = (i * 5) % 240;
+                LC_OperData.WDTPtr[i].BitMask            = ((i % 4) == 0) ? 0x00FF00FF : LC_BITMASK_NONE;
+                LC_OperData.WDTPtr[i].ResultAgeWhenStale = 4;
+
+                /* Compare some watchpoints to their own packet data */
+                if ((i % 3) == 0)
+                {
+                    memcpy(&LC_OperData.WDTPtr[i].ComparisonValue, &Packet[(i * 5) % 240], 4);
+                }
+                else
+                {
+                    LC_OperData.WDTPtr[i].ComparisonValue.Unsigned32 = Seed;
+                }
+
+                LC_OperData.WDTPtr[i].SecondComparisonValue.Unsigned32 = Seed ^ (Seed << 7);
+
+                LC_OperData.MsgIndex->WatchPtList[i] = i;
+            }
+
+            LC_CompileWatchpoints();
+            LC_GroupWatchpoints();
+
+            if (LC_OperData.MsgIndex->Program.RunLength[0] >= LC_WATCH_BATCH_MIN)
+            {
+                Batches++;
+            }
+
+            /* Reference results one watchpoint at a time */
+            EventCount = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+            for (i = 0; i < 40; i++)
+            {
+                memset(&LC_OperData.WRTPtr[i], 0, sizeof(LC_WRTEntry_t));
+                LC_OperData.WRTPtr[i].WatchResult = (i % 2) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+
+                if (LC_WPOffsetValid(i, PacketPtr))
+                {
+                    LC_ProcessWP(i, PacketPtr, &PacketTime);
+                }
+
+                Expected[i] = LC_OperData.WRTPtr[i];
+            }
+            RefEvents = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - EventCount;
+
+            for (i = 0; i < 40; i++)
+            {
+                memset(&LC_OperData.WRTPtr[i], 0, sizeof(LC_WRTEntry_t));
+                LC_OperData.WRTPtr[i].WatchResult = (i % 2) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+            }
+
+            EventCount = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+            LC_CheckMsgForWPs(TestMsgId, PacketPtr);
+            BatchEvents = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - EventCount;
+
+            if ((memcmp(Expected, LC_OperData.WRTPtr, sizeof(Expected)) != 0) || (BatchEvents != RefEvents))
+            {
+                Mismatches++;
+            }
+        }
+    }
+
+    UtAssert_UINT32_EQ(Mismatches, 0);
+    UtAssert_UINT32_EQ(Batches, 108);
+    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 108);
+}
+
+void LC_CheckMsgForWPs_Test_ShortPacket(void)
+{
+    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
+    size_t             MsgSize   = 10;
+    CFE_TIME_SysTime_t Timestamp = { .Seconds = 1, .Subseconds = 0 };
+    uint16             i;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    /* A batch of like watchpoints, the last ends past the packet */
+    LC_Test_SetupMsgIndex(TestMsgId, 4);
+
+    for (i = 0; i < 4; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType         = LC_DATA_WATCH_UWORD_BE;
+        LC_OperData.WDTPtr[i].OperatorID       = LC_OPER_EQ;
+        LC_OperData.WDTPtr[i].BitMask          = LC_BITMASK_NONE;
+        LC_OperData.WDTPtr[i].WatchpointOffset = i * 3;
+        LC_OperData.MsgIndex->WatchPtList[i]   = i;
+    }
+
+    LC_CompileWatchpoints();
+    LC_GroupWatchpoints();
+
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[1].MaxExtent, 11);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+
+    /* Verify results - only the out of bounds watchpoint is skipped */
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].EvaluationCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].EvaluationCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].EvaluationCount, 0);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[3].WatchResult, LC_WATCH_ERROR);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_UNSUB_WP_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OFFSET_ERR_EID);
 }
 
-void LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal(void)
+void LC_CheckMsgForWPs_Test_FullPacket(void)
 {
-    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
-    uint32         HashIndex;
+    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
+    size_t             MsgSize   = 11;
+    CFE_TIME_SysTime_t Timestamp = { .Seconds = 1, .Subseconds = 0 };
+    uint16             i;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    LC_Test_SetupMsgIndex(TestMsgId, 4);
 
-    HashIndex = LC_GetHashTableIndex(MessageID);
+    for (i = 0; i < 4; i++)
+    {
+        LC_OperData.WDTPtr[i].DataType         = LC_DATA_WATCH_UWORD_BE;
+        LC_OperData.WDTPtr[i].OperatorID       = LC_OPER_EQ;
+        LC_OperData.WDTPtr[i].BitMask          = LC_BITMASK_NONE;
+        LC_OperData.WDTPtr[i].WatchpointOffset = i * 3;
+        LC_OperData.MsgIndex->WatchPtList[i]   = i;
+    }
+
+    LC_CompileWatchpoints();
+    LC_GroupWatchpoints();
 
     /* Execute the function being tested */
-    UtAssert_ADDRESS_EQ(LC_AddWatchpoint(MessageID), &LC_OperData.WatchPtLinks[0]);
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
-    /* Verify results */
-    UtAssert_ADDRESS_EQ(LC_OperData.HashTable[HashIndex], &LC_OperData.MessageLinks[0]);
-    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(LC_OperData.MessageLinks[0].MessageID, MessageID));
-    UtAssert_ADDRESS_EQ(LC_OperData.MessageLinks[0].WatchPtList, &LC_OperData.WatchPtLinks[0]);
-    UtAssert_UINT16_EQ(LC_OperData.MessageIDsCount, 1);
-    UtAssert_UINT16_EQ(LC_OperData.WatchpointCount, 1);
+    /* Verify results - one size query for the whole packet */
+    for (i = 0; i < 4; i++)
+    {
+        UtAssert_UINT32_EQ(LC_OperData.WRTPtr[i].EvaluationCount, 1);
+    }
 
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void LC_AddWatchpoint_Test_HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound(void)
+void LC_CompileWatchpoints_Test_UnknownExtent(void)
 {
-    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
+    LC_OperData.MsgIndex->MessageIDsCount           = 1;
+    LC_OperData.MsgIndex->MessageList[0].WatchStart = 0;
+    LC_OperData.MsgIndex->MessageList[0].WatchCount = 2;
+    LC_OperData.MsgIndex->WatchPtList[0]            = 0;
+    LC_OperData.MsgIndex->WatchPtList[1]            = 1;
+    LC_OperData.MsgIndex->WatchpointCount           = 2;
 
-    /* Mark number of used elements set below */
-    LC_OperData.WatchpointCount = 2;
-    LC_OperData.MessageIDsCount = 2;
+    LC_OperData.WDTPtr[0].DataType         = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].WatchpointOffset = 0xFFFFFFF0;
+    LC_OperData.WDTPtr[1].DataType         = LC_DATA_WATCH_BYTE;
 
-    /* Point hash to MessageLink 1 */
-    LC_OperData.HashTable[LC_GetHashTableIndex(MessageID)] = &LC_OperData.MessageLinks[0];
+    /* Execute the function being tested */
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].MaxExtent, 0xFFFFFFF1);
+
+    LC_OperData.WDTPtr[1].DataType = LC_DATA_WATCH_NOT_USED;
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].MaxExtent, LC_MSG_EXTENT_UNKNOWN);
 
-    /* No match on first message link */
-    LC_OperData.MessageLinks[0].MessageID = LC_UT_MID_2;
-    LC_OperData.MessageLinks[0].Next      = &LC_OperData.MessageLinks[1];
+    LC_OperData.WDTPtr[1].DataType         = LC_DATA_WATCH_DWORD_BE;
+    LC_OperData.WDTPtr[1].WatchpointOffset = 0xFFFFFFFE;
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].MaxExtent, LC_MSG_EXTENT_UNKNOWN);
+}
 
-    /* Match on second with a non-null watchpoint list */
-    LC_OperData.MessageLinks[1].MessageID   = MessageID;
-    LC_OperData.MessageLinks[1].WatchPtList = &LC_OperData.WatchPtLinks[0];
-    LC_OperData.WatchPtLinks[0].Next        = &LC_OperData.WatchPtLinks[1];
+void LC_CompileWatchpoints_Test_Digest(void)
+{
+    LC_OperData.MsgIndex->MessageIDsCount           = 1;
+    LC_OperData.MsgIndex->MessageList[0].WatchStart = 0;
+    LC_OperData.MsgIndex->MessageList[0].WatchCount = 2;
+    LC_OperData.MsgIndex->WatchPtList[0]            = 0;
+    LC_OperData.MsgIndex->WatchPtList[1]            = 1;
+    LC_OperData.MsgIndex->WatchpointCount           = 2;
+
+    LC_OperData.WDTPtr[0].DataType         = LC_DATA_WATCH_DWORD_BE;
+    LC_OperData.WDTPtr[0].WatchpointOffset = 20;
+    LC_OperData.WDTPtr[0].WatchOptions     = LC_WATCH_OPT_DIGEST;
+    LC_OperData.WDTPtr[1].DataType         = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].WatchpointOffset = 12;
+    LC_OperData.WDTPtr[1].WatchOptions     = LC_WATCH_OPT_DIGEST | LC_WATCH_OPT_CHANGE_ONLY;
 
     /* Execute the function being tested */
-    UtAssert_ADDRESS_EQ(LC_AddWatchpoint(MessageID), &LC_OperData.WatchPtLinks[2]);
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].MaxExtent, 24);
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].DigestStart, 12);
+
+    /* Every watchpoint on the message must ask for the digest */
+    LC_OperData.WDTPtr[0].WatchOptions = LC_WATCH_OPT_NONE;
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].DigestStart, LC_MSG_DIGEST_OFF);
+
+    /* Not used with a custom function, which may read any byte */
+    LC_OperData.WDTPtr[0].WatchOptions = LC_WATCH_OPT_DIGEST;
+    LC_OperData.WDTPtr[0].OperatorID   = LC_OPER_CUSTOM;
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].DigestStart, LC_MSG_DIGEST_OFF);
+
+    /* Not used when the watched bytes do not fit the saved span */
+    LC_OperData.WDTPtr[0].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[0].WatchpointOffset = 12 + LC_DIGEST_MAX_BYTES;
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].DigestStart, LC_MSG_DIGEST_OFF);
+
+    /* Not used with an unknown extent */
+    LC_OperData.WDTPtr[0].WatchpointOffset = 20;
+    LC_OperData.WDTPtr[0].DataType         = 99;
+    LC_CompileWatchpoints();
+    UtAssert_UINT32_EQ(LC_OperData.MsgIndex->MessageList[0].DigestStart, LC_MSG_DIGEST_OFF);
+}
 
-    /* Verify additional used watchpoint */
-    UtAssert_UINT16_EQ(LC_OperData.WatchpointCount, 3);
-    UtAssert_ADDRESS_EQ(LC_OperData.WatchPtLinks[1].Next, &LC_OperData.WatchPtLinks[2]);
+void LC_CheckMsgDigest_Test_Collision(void)
+{
+    LC_MessageList_t *MessageList = &LC_OperData.MsgIndex->MessageList[0];
+    uint8            *Data        = (uint8 *)&UT_CmdBuf;
 
-    /* Verify no new message id used */
-    UtAssert_UINT16_EQ(LC_OperData.MessageIDsCount, 2);
+    MessageList->DigestStart = 4;
+    MessageList->MaxExtent   = 8;
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(LC_CheckMsgDigest(MessageList, &UT_CmdBuf.Buf));
+    UtAssert_BOOL_TRUE(LC_CheckMsgDigest(MessageList, &UT_CmdBuf.Buf));
+
+    /* Verify results - a digest that matches changed bytes is a miss */
+    Data[5] = 1;
+    LC_OperData.MsgDigest[0].Digest = LC_DigestRange(&Data[4], 4);
+
+    UtAssert_BOOL_FALSE(LC_CheckMsgDigest(MessageList, &UT_CmdBuf.Buf));
+    UtAssert_UINT8_EQ(LC_OperData.MsgDigest[0].Bytes[1], 1);
+    UtAssert_BOOL_TRUE(LC_CheckMsgDigest(MessageList, &UT_CmdBuf.Buf));
+
+    UtAssert_UINT32_EQ(LC_OperData.DigestMissCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.DigestHitCount, 2);
 }
 
-void LC_AddWatchpoint_Test_NullPointersErrorSubscribingWatchpoint(void)
+void LC_CheckMsgForWPs_Test_Digest(void)
 {
-    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
-    int32          strCmpResult;
-    char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    uint32         HashIndex;
+    CFE_SB_MsgId_t TestMsgId = LC_UT_MID_1;
+    size_t         MsgSize   = sizeof(UT_CmdBuf);
+    uint8         *Data      = (uint8 *)&UT_CmdBuf;
 
-    snprintf(ExpectedEventString,
-             CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error subscribing watchpoint: MID=0x%%08lX, RC=0x%%08X");
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    HashIndex = LC_GetHashTableIndex(MessageID);
+    /* Not disabled */
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
 
-    /* Set to generate error message LC_SUB_WP_ERR_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_Subscribe), -1);
+    /* Message index holds another MID and this one */
+    LC_Test_SetupMsgIndex(TestMsgId, 2);
+    LC_OperData.MsgIndex->WatchPtList[0] = 0;
+    LC_OperData.MsgIndex->WatchPtList[1] = 1;
+
+    LC_OperData.WDTPtr[0].DataType         = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[0].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[0].WatchpointOffset = 2;
+    LC_OperData.WDTPtr[0].BitMask          = LC_BITMASK_NONE;
+    LC_OperData.WDTPtr[0].WatchOptions     = LC_WATCH_OPT_DIGEST;
+    LC_OperData.WDTPtr[1].DataType         = LC_DATA_WATCH_UWORD_LE;
+    LC_OperData.WDTPtr[1].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[1].WatchpointOffset = 4;
+    LC_OperData.WDTPtr[1].BitMask          = LC_BITMASK_NONE;
+    LC_OperData.WDTPtr[1].WatchOptions     = LC_WATCH_OPT_DIGEST;
+    LC_CompileWatchpoints();
 
     /* Execute the function being tested */
-    UtAssert_ADDRESS_EQ(LC_AddWatchpoint(MessageID), &LC_OperData.WatchPtLinks[0]);
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_ADDRESS_EQ(LC_OperData.HashTable[HashIndex], &LC_OperData.MessageLinks[0]);
-    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(LC_OperData.MessageLinks[0].MessageID, MessageID));
-    UtAssert_ADDRESS_EQ(LC_OperData.MessageLinks[0].WatchPtList, &LC_OperData.WatchPtLinks[0]);
-    UtAssert_UINT16_EQ(LC_OperData.MessageIDsCount, 1);
-    UtAssert_UINT16_EQ(LC_OperData.WatchpointCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.DigestMissCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.DigestHitCount, 1);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[0].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].EvaluationCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].ConsecutiveTrueCount, 2);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[1].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].EvaluationCount, 2);
+
+    /* Outside the watched bytes */
+    Data[6] = 1;
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_SUB_WP_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_UINT32_EQ(LC_OperData.DigestHitCount, 2);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Inside the watched bytes */
+    Data[5] = 1;
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_UINT32_EQ(LC_OperData.DigestMissCount, 2);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[1].WatchResult, LC_WATCH_FALSE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].EvaluationCount, 4);
+
+    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void LC_AddWatchpoint_Test_NonNullMessageList(void)
+void LC_CheckMsgForWPs_Test_DigestShortPacket(void)
 {
-    CFE_SB_MsgId_t MessageID = LC_UT_MID_1;
-    uint16         HashIndex;
+    CFE_SB_MsgId_t TestMsgId = LC_UT_MID_1;
+    size_t         MsgSize[] = { sizeof(UT_CmdBuf), 3, 3, 3, sizeof(UT_CmdBuf) };
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+
+    /* Not disabled */
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    LC_Test_SetupMsgIndex(TestMsgId, 2);
+    LC_OperData.MsgIndex->WatchPtList[0] = 0;
+    LC_OperData.MsgIndex->WatchPtList[1] = 1;
+
+    LC_OperData.WDTPtr[0].DataType         = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[0].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[0].WatchpointOffset = 2;
+    LC_OperData.WDTPtr[0].WatchOptions     = LC_WATCH_OPT_DIGEST;
+    LC_OperData.WDTPtr[1].DataType         = LC_DATA_WATCH_UWORD_LE;
+    LC_OperData.WDTPtr[1].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[1].WatchpointOffset = 4;
+    LC_OperData.WDTPtr[1].WatchOptions     = LC_WATCH_OPT_DIGEST;
+    LC_CompileWatchpoints();
 
-    HashIndex = LC_GetHashTableIndex(MessageID);
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
-    /* Point to first element */
-    LC_OperData.HashTable[HashIndex] = &LC_OperData.MessageLinks[0];
+    /* Verify results - only part of the short packet was evaluated */
+    UtAssert_UINT32_EQ(LC_OperData.DigestMissCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.DigestHitCount, 0);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].EvaluationCount, 3);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].EvaluationCount, 2);
+    UtAssert_BOOL_TRUE(LC_OperData.MsgDigest[1].Valid);
+}
 
-    /* List without a match */
-    LC_OperData.MessageIDsCount           = 1;
-    LC_OperData.MessageLinks[0].MessageID = LC_UT_MID_2;
+void LC_ReuseWatchResults_Test(void)
+{
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+
+    LC_OperData.MsgIndex->MessageList[0].WatchStart = 0;
+    LC_OperData.MsgIndex->MessageList[0].WatchCount = 3;
+    LC_OperData.MsgIndex->WatchPtList[0]            = 4;
+    LC_OperData.MsgIndex->WatchPtList[1]            = 5;
+    LC_OperData.MsgIndex->WatchPtList[2]            = 6;
+    LC_OperData.MsgIndex->WatchpointCount           = 3;
+
+    LC_OperData.WDTPtr[4].DataType           = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[4].OperatorID         = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[4].ResultAgeWhenStale = 2;
+    LC_OperData.WDTPtr[5].DataType           = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[5].OperatorID         = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[6].DataType           = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[6].OperatorID         = LC_OPER_CUSTOM;
+    LC_CompileWatchpoints();
+
+    LC_OperData.WRTPtr[4].WatchResult          = LC_WATCH_TRUE;
+    LC_OperData.WRTPtr[4].ConsecutiveTrueCount = 1;
+    LC_OperData.WRTPtr[4].FalseToTrueCount     = 1;
+    LC_OperData.WRTPtr[5].WatchResult          = LC_WATCH_STALE;
+    LC_OperData.WRTPtr[6].WatchResult          = LC_WATCH_ERROR;
 
     /* Execute the function being tested */
-    UtAssert_ADDRESS_EQ(LC_AddWatchpoint(MessageID), &LC_OperData.WatchPtLinks[0]);
+    LC_ReuseWatchResults(&LC_OperData.MsgIndex->MessageList[0], &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
-    UtAssert_ADDRESS_EQ(LC_OperData.HashTable[HashIndex], &LC_OperData.MessageLinks[0]);
-    UtAssert_ADDRESS_EQ(LC_OperData.MessageLinks[0].Next, &LC_OperData.MessageLinks[1]);
-    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(LC_OperData.MessageLinks[1].MessageID, MessageID));
-    UtAssert_ADDRESS_EQ(LC_OperData.MessageLinks[1].WatchPtList, &LC_OperData.WatchPtLinks[0]);
-    UtAssert_UINT16_EQ(LC_OperData.MessageIDsCount, 2);
-    UtAssert_UINT16_EQ(LC_OperData.WatchpointCount, 1);
+    UtAssert_STUB_COUNT(LC_CustomFunction, 2);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[4].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[4].EvaluationCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[4].ConsecutiveTrueCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[4].FalseToTrueCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[4].CountdownToStale, 2);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[5].WatchResult, LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[6].WatchResult, LC_WATCH_FALSE);
+}
 
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+void LC_DigestRange_Test(void)
+{
+    uint8  Data[19] = { 0 };
+    uint64 Digest;
+    uint32 i;
+
+    Digest = LC_DigestRange(Data, sizeof(Data));
+
+    /* Same bytes give the same digest, a different length does not */
+    UtAssert_True(LC_DigestRange(Data, sizeof(Data)) == Digest, "Digest repeats");
+    UtAssert_True(LC_DigestRange(Data, sizeof(Data) - 1) != Digest, "Length changes digest");
+
+    /* A single changed byte anywhere changes the digest */
+    for (i = 0; i < sizeof(Data); i++)
+    {
+        Data[i] = 0x80;
+        UtAssert_True(LC_DigestRange(Data, sizeof(Data)) != Digest, "Byte %u changes digest", (unsigned int)i);
+        Data[i] = 0;
+    }
 }
 
 void LC_CheckMsgForWPs_Test_Nominal(void)
@@ -208,29 +1763,31 @@ void LC_CheckMsgForWPs_Test_Nominal(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    LC_OperData.HashTable[LC_GetHashTableIndex(TestMsgId)] = &LC_OperData.MessageLinks[0];
-
     /* Not disabled */
     LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
 
-    /* Miss on first, match on next */
-    LC_OperData.MessageLinks[0].MessageID   = LC_UT_MID_2;
-    LC_OperData.MessageLinks[0].Next        = &LC_OperData.MessageLinks[1];
-    LC_OperData.MessageLinks[1].MessageID   = TestMsgId;
-    LC_OperData.MessageLinks[1].WatchPtList = &LC_OperData.WatchPtLinks[0];
+    /* Message index holds another MID and this one */
+    LC_Test_SetupMsgIndex(TestMsgId, 1);
+    LC_OperData.MsgIndex->WatchPtList[0] = WatchIndex;
 
-    LC_OperData.WatchPtLinks[0].WatchIndex          = WatchIndex;
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_BYTE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
     LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_CUSTOM;
+    LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_STALE;
+    LC_CompileWatchpoints();
 
     /* Execute the function being tested */
     LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].EvaluationCount, 1);
+    UtAssert_STUB_COUNT(LC_RunImmediateAPs, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* The transition needed a time and the packet has none */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 1);
     UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
 }
 
@@ -243,19 +1800,18 @@ void LC_CheckMsgForWPs_Test_NominalMsgTime1(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    LC_OperData.HashTable[LC_GetHashTableIndex(TestMsgId)] = &LC_OperData.MessageLinks[0];
-
     /* Not disabled */
     LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
 
-    /* Match on first, Null message list */
-    LC_OperData.MessageLinks[0].MessageID = TestMsgId;
+    /* Match MID, empty watchpoint span */
+    LC_Test_SetupMsgIndex(TestMsgId, 0);
 
     /* Execute the function being tested */
     LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 0);
+    UtAssert_STUB_COUNT(LC_RunImmediateAPs, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_MID_INF_EID);
@@ -273,80 +1829,397 @@ void LC_CheckMsgForWPs_Test_NominalMsgTime2(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
-    LC_OperData.HashTable[LC_GetHashTableIndex(TestMsgId)] = &LC_OperData.MessageLinks[0];
-
     /* Not disabled */
     LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
 
-    /* Miss on first */
-    LC_OperData.MessageLinks[0].MessageID   = TestMsgId;
-    LC_OperData.MessageLinks[0].WatchPtList = &LC_OperData.WatchPtLinks[0];
-    LC_OperData.WatchPtLinks[0].WatchIndex  = WatchIndex;
+    LC_Test_SetupMsgIndex(TestMsgId, 1);
+    LC_OperData.MsgIndex->WatchPtList[0] = WatchIndex;
 
     /* Bad offset */
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_BYTE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = MsgSize + 1;
     LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_CUSTOM;
+    LC_CompileWatchpoints();
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OFFSET_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+}
+
+void LC_CheckMsgForWPs_Test_MultipleWatchpoints(void)
+{
+    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
+    size_t             MsgSize   = sizeof(UT_CmdBuf);
+    CFE_TIME_SysTime_t Timestamp = { .Seconds = 1, .Subseconds = 0 };
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    /* Span of two watchpoints, not adjacent in the table */
+    LC_Test_SetupMsgIndex(TestMsgId, 2);
+    LC_OperData.MsgIndex->WatchPtList[0] = 3;
+    LC_OperData.MsgIndex->WatchPtList[1] = 7;
+
+    LC_OperData.WDTPtr[3].DataType   = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[3].OperatorID = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[7].DataType   = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[7].OperatorID = LC_OPER_CUSTOM;
+    LC_CompileWatchpoints();
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].EvaluationCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[7].EvaluationCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].EvaluationCount, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CheckMsgForWPs_Test_TransitionTimeOnce(void)
+{
+    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
+    size_t             MsgSize   = sizeof(UT_CmdBuf);
+    CFE_TIME_SysTime_t Timestamp = { .Seconds = 7, .Subseconds = 9 };
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    LC_Test_SetupMsgIndex(TestMsgId, 2);
+    LC_OperData.MsgIndex->WatchPtList[0] = 3;
+    LC_OperData.MsgIndex->WatchPtList[1] = 7;
+
+    /* Both watchpoints leave the stale state on this packet */
+    LC_OperData.WDTPtr[3].DataType    = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[3].OperatorID  = LC_OPER_CUSTOM;
+    LC_OperData.WRTPtr[3].WatchResult = LC_WATCH_STALE;
+    LC_OperData.WDTPtr[7].DataType    = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[7].OperatorID  = LC_OPER_CUSTOM;
+    LC_OperData.WRTPtr[7].WatchResult = LC_WATCH_STALE;
+    LC_CompileWatchpoints();
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[3].WatchResult, LC_WATCH_FALSE);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[7].WatchResult, LC_WATCH_FALSE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].LastTrueToFalse.Timestamp.Seconds, 7);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].LastTrueToFalse.Timestamp.Subseconds, 9);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[7].LastTrueToFalse.Timestamp.Seconds, 7);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[7].LastTrueToFalse.Timestamp.Subseconds, 9);
+
+    /* One time read for the packet, shared by both transitions */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_GetPacketTime_Test(void)
+{
+    CFE_TIME_SysTime_t Timestamp  = { .Seconds = 7, .Subseconds = 9 };
+    LC_PacketTime_t    PacketTime = { .BufPtr = &UT_CmdBuf.Buf, .Resolved = false };
+    CFE_TIME_SysTime_t Result;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+
+    /* Execute the function being tested */
+    Result = LC_GetPacketTime(&PacketTime);
+    Result = LC_GetPacketTime(&PacketTime);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result.Seconds, 7);
+    UtAssert_UINT32_EQ(Result.Subseconds, 9);
+    UtAssert_BOOL_TRUE(PacketTime.Resolved);
+
+    /* The second call uses the time read by the first */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+}
+
+void LC_CheckMsgForWPs_Test_SteadyStateBenchmark(void)
+{
+    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
+    size_t             MsgSize   = sizeof(UT_CmdBuf);
+    CFE_TIME_SysTime_t Timestamp = { .Seconds = 0, .Subseconds = 0 };
+    uint32             Packets   = 20000;
+    uint32             Packet;
+    clock_t            Start;
+    double             LazyNs;
+    double             EagerNs;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    /* Two watchpoints that stay false, so no packet causes a transition */
+    LC_Test_SetupMsgIndex(TestMsgId, 2);
+    LC_OperData.MsgIndex->WatchPtList[0] = 3;
+    LC_OperData.MsgIndex->WatchPtList[1] = 7;
+
+    LC_OperData.WDTPtr[3].DataType   = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[3].OperatorID = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[7].DataType   = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[7].OperatorID = LC_OPER_CUSTOM;
+    LC_CompileWatchpoints();
+
+    Start = clock();
+    for (Packet = 0; Packet < Packets; Packet++)
+    {
+        LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+    }
+    LazyNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / Packets;
+
+    /* No packet read a time */
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].EvaluationCount, Packets);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[7].EvaluationCount, Packets);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgTime, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+
+    /* Reference: the same packets with the time read up front */
+    Start = clock();
+    for (Packet = 0; Packet < Packets; Packet++)
+    {
+        CFE_MSG_GetMsgTime(&UT_CmdBuf.Buf.Msg, &Timestamp);
+
+        if ((Timestamp.Seconds == 0) && (Timestamp.Subseconds == 0))
+        {
+            Timestamp = CFE_TIME_GetTime();
+        }
+
+        LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+    }
+    EagerNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / Packets;
+
+    UtPrintf("Steady state packet: lazy time %6.2f ns, eager time %6.2f ns, %u time reads saved", LazyNs, EagerNs,
+             (unsigned int)(UT_GetStubCount(UT_KEY(CFE_MSG_GetMsgTime)) + UT_GetStubCount(UT_KEY(CFE_TIME_GetTime))));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CheckMsgForWPs_Test_ScalingBenchmark(void)
+{
+    static const uint32 FillPercent[] = { 25, 50, 100 };
+    CFE_SB_MsgId_t      TestMsgId     = LC_UT_MID_1;
+    size_t              MsgSize       = sizeof(UT_CmdBuf);
+    uint8              *Data          = (uint8 *)&UT_CmdBuf + 8;
+    uint32              Packets       = 20000;
+    uint32              Packet;
+    uint32              Fill;
+    uint32              WatchCount;
+    uint16              WatchIndex;
+    clock_t             Start;
+    double              PacketNs;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
+
+    for (Fill = 0; Fill < sizeof(FillPercent) / sizeof(FillPercent[0]); Fill++)
+    {
+        WatchCount = (LC_MAX_WATCHPOINTS * FillPercent[Fill]) / 100;
+
+        memset(LC_OperData.WRTPtr, 0, sizeof(LC_WRTEntry_t) * LC_MAX_WATCHPOINTS);
+
+        /* Four watchpoints on each MessageID, the rest are unused */
+        for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++)
+        {
+            memset(&LC_OperData.WDTPtr[WatchIndex], 0, sizeof(LC_WDTEntry_t));
+            LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_NOT_USED;
+
+            if (WatchIndex < WatchCount)
+            {
+                LC_OperData.WDTPtr[WatchIndex].DataType                  = LC_DATA_WATCH_UBYTE;
+                LC_OperData.WDTPtr[WatchIndex].OperatorID                = LC_OPER_EQ;
+                LC_OperData.WDTPtr[WatchIndex].MessageID                 = CFE_SB_ValueToMsgId(1 + (WatchIndex / 4));
+                LC_OperData.WDTPtr[WatchIndex].WatchpointOffset          = 8 + (WatchIndex % 4);
+                LC_OperData.WDTPtr[WatchIndex].BitMask                   = LC_BITMASK_NONE;
+                LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned8 = 0xFF;
+            }
+        }
+
+        LC_CreateHashTable();
+        UtAssert_UINT32_EQ(LC_OperData.MsgIndex->WatchpointCount, WatchCount);
+
+        /* The watched bytes change on every packet, so each one is evaluated */
+        Start = clock();
+        for (Packet = 0; Packet < Packets; Packet++)
+        {
+            Data[Packet & 3] = (uint8)(Packet & 0x7F);
+            LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+        }
+        PacketNs = ((double)(clock() - Start) * 1.0e9) / CLOCKS_PER_SEC / Packets;
+
+        UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].WatchResult, LC_WATCH_FALSE);
+        UtAssert_NONZERO(LC_OperData.WRTPtr[0].EvaluationCount);
+        UtAssert_UINT32_EQ(LC_OperData.WRTPtr[4].EvaluationCount, 0);
+
+        UtPrintf("Packet at %3u%% fill (%4u WPs, %4u MIDs): %6.2f ns for 4 WPs", (unsigned int)FillPercent[Fill],
+                 (unsigned int)WatchCount, (unsigned int)((WatchCount + 3) / 4), PacketNs);
+    }
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_CheckMsgForWPs_Test_NominalDisabled(void)
+{
+    CFE_SB_MsgId_t TestMsgId = LC_UT_MID_1;
+
+    LC_AppData.CurrentLCState = LC_STATE_DISABLED;
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+}
+
+void LC_CheckMsgForWPs_Test_UnreferencedMessageID(void)
+{
+    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
+    CFE_TIME_SysTime_t Timestamp = { .Seconds = 0, .Subseconds = 0 };
+    int32              strCmpResult;
+    char               ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString,
+             CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Msg with unreferenced message ID rcvd: ID = 0x%%08lX, count = %%lu");
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_MID_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void LC_HandleUnreferencedMsg_Test_Throttle(void)
+{
+    uint32 i;
+
+    /* Execute the function being tested */
+    for (i = 0; i <= LC_UNREF_EVENT_INTERVAL; i++)
+    {
+        LC_HandleUnreferencedMsg(LC_UT_MID_1);
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgCount, LC_UNREF_EVENT_INTERVAL + 1);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgs.Entry[0].MsgCount, LC_UNREF_EVENT_INTERVAL + 1);
+
+    /* Reported on the first message and once per interval after that */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_MID_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, LC_MID_INF_EID);
+
+#if LC_UNREF_UNSUB_LIMIT == 0
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+#endif
+}
+
+void LC_HandleUnreferencedMsg_Test_PerMessageID(void)
+{
+    /* Execute the function being tested */
+    LC_HandleUnreferencedMsg(LC_UT_MID_1);
+    LC_HandleUnreferencedMsg(LC_UT_MID_2);
+    LC_HandleUnreferencedMsg(LC_UT_MID_1);
+
+    /* Each MessageID is counted and throttled on its own */
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgs.Entry[0].MsgCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgs.Entry[1].MsgCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgCount, 3);
+
+    if (LC_UNREF_EVENT_INTERVAL > 1)
+    {
+        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    }
+}
 
-    /* Execute the function being tested */
-    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+void LC_HandleUnreferencedMsg_Test_TableFull(void)
+{
+    LC_OperData.UnrefMsgs.EntryCount = LC_MAX_UNREF_MSGIDS;
 
-    /* Verify results */
-    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 1);
+    /* Execute the function being tested */
+    LC_HandleUnreferencedMsg(LC_UT_MID_1);
 
+    /* Still counted and reported, but not tracked */
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.EntryCount, LC_MAX_UNREF_MSGIDS);
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgs.UntrackedCount, 1);
+    UtAssert_UINT32_EQ(LC_OperData.UnrefMsgCount, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OFFSET_ERR_EID);
-    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_MID_INF_EID);
 }
 
-void LC_CheckMsgForWPs_Test_NominalDisabled(void)
+#if LC_UNREF_UNSUB_LIMIT > 0
+void LC_HandleUnreferencedMsg_Test_Unsubscribe(void)
 {
-    CFE_SB_MsgId_t TestMsgId = LC_UT_MID_1;
-
-    LC_AppData.CurrentLCState = LC_STATE_DISABLED;
+    uint32 i;
 
     /* Execute the function being tested */
-    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
+    for (i = 0; i < LC_UNREF_UNSUB_LIMIT + 1; i++)
+    {
+        LC_HandleUnreferencedMsg(LC_UT_MID_1);
+    }
 
     /* Verify results */
-    UtAssert_UINT32_EQ(LC_AppData.MonitoredMsgCount, 0);
-
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.UnsubscribedCount, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - 1].EventID,
+                      LC_UNREF_UNSUB_INF_EID);
 }
 
-void LC_CheckMsgForWPs_Test_UnreferencedMessageID(void)
+void LC_HandleUnreferencedMsg_Test_UnsubscribeError(void)
 {
-    CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
-    CFE_TIME_SysTime_t Timestamp = { .Seconds = 0, .Subseconds = 0 };
-    int32              strCmpResult;
-    char               ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString,
-             CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Msg with unreferenced message ID rcvd: ID = 0x%%08lX");
+    uint32 i;
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgTime), &Timestamp, sizeof(Timestamp), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_Unsubscribe), -1);
 
     /* Execute the function being tested */
-    LC_CheckMsgForWPs(TestMsgId, &UT_CmdBuf.Buf);
-
-    /* Verify results */
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_MID_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    for (i = 0; i < LC_UNREF_UNSUB_LIMIT + 1; i++)
+    {
+        LC_HandleUnreferencedMsg(LC_UT_MID_1);
+    }
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Tried only once */
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_UINT16_EQ(LC_OperData.UnrefMsgs.UnsubscribedCount, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - 1].EventID,
+                      LC_UNREF_UNSUB_ERR_EID);
 }
+#endif
 
 void LC_ProcessWP_Test_CustomFunctionWatchFalse(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    memset(&Timestamp, 0, sizeof(Timestamp));
+    memset(&PacketTime, 0, sizeof(PacketTime));
+    PacketTime.Resolved = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -356,7 +2229,7 @@ void LC_ProcessWP_Test_CustomFunctionWatchFalse(void)
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0,
@@ -377,10 +2250,11 @@ void LC_ProcessWP_Test_CustomFunctionWatchFalse(void)
 void LC_ProcessWP_Test_OperatorCompareError(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    memset(&Timestamp, 0, sizeof(Timestamp));
+    memset(&PacketTime, 0, sizeof(PacketTime));
+    PacketTime.Resolved = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -389,7 +2263,7 @@ void LC_ProcessWP_Test_OperatorCompareError(void)
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR,
@@ -403,14 +2277,77 @@ void LC_ProcessWP_Test_OperatorCompareError(void)
     /* Generates 1 event message we don't care about in this test */
 }
 
+void LC_ProcessWP_Test_ChangeOnlyError(void)
+{
+    uint16             WatchIndex = 0;
+    LC_PacketTime_t    PacketTime;
+
+    memset(&PacketTime, 0, sizeof(PacketTime));
+    PacketTime.Resolved = true;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType     = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID   = 99;
+    LC_OperData.WDTPtr[WatchIndex].WatchOptions = LC_WATCH_OPT_CHANGE_ONLY;
+
+    /* Execute the function being tested */
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
+
+    /* Verify results - an error is reported on every sample */
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[WatchIndex].WatchResult, LC_WATCH_ERROR);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].EvaluationCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 0);
+    UtAssert_BOOL_FALSE(LC_OperData.WatchCache[WatchIndex].Valid);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OPERID_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, LC_WP_OPERID_ERR_EID);
+}
+
+void LC_ProcessWP_Test_ChangeOnlyQWord(void)
+{
+    uint16             WatchIndex = 0;
+    LC_PacketTime_t    PacketTime;
+    uint8             *Data = (uint8 *)&UT_CmdBuf + 8;
+
+    memset(&PacketTime, 0, sizeof(PacketTime));
+    PacketTime.Resolved = true;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                   = LC_DATA_WATCH_UQWORD_LE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID                 = LC_OPER_GT;
+    LC_OperData.WDTPtr[WatchIndex].WatchOptions               = LC_WATCH_OPT_CHANGE_ONLY;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset           = 8;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                    = LC_BITMASK_NONE;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned64 = 0xFFFFFFFF;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale         = 1;
+
+    /* Execute the function being tested */
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[WatchIndex].WatchResult, LC_WATCH_FALSE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].EvaluationCount, 2);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 1);
+
+    /* A change above the bitmask is still a change */
+    Data[4] = 1;
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
+
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[WatchIndex].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].EvaluationCount, 3);
+    UtAssert_UINT32_EQ(LC_OperData.SkippedEvalCount, 1);
+}
+
 void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
 
-    Timestamp.Seconds        = 3;
-    Timestamp.Subseconds     = 5;
-    CFE_SB_MsgId_t TestMsgId = LC_UT_MID_1;
+    PacketTime.Timestamp.Seconds    = 3;
+    PacketTime.Timestamp.Subseconds = 5;
+    PacketTime.Resolved             = true;
+    CFE_SB_MsgId_t TestMsgId        = LC_UT_MID_1;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -423,7 +2360,7 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale(void)
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_TRUE,
@@ -453,11 +2390,12 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale(void)
 void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousFalse(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
 
-    Timestamp.Seconds        = 3;
-    Timestamp.Subseconds     = 5;
-    CFE_SB_MsgId_t TestMsgId = LC_UT_MID_1;
+    PacketTime.Timestamp.Seconds    = 3;
+    PacketTime.Timestamp.Subseconds = 5;
+    PacketTime.Resolved             = true;
+    CFE_SB_MsgId_t TestMsgId        = LC_UT_MID_1;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -470,7 +2408,7 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousFalse(void)
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_TRUE,
@@ -495,16 +2433,19 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousFalse(void)
                   "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds == 5");
 
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
+    UtAssert_STUB_COUNT(LC_QueueImmediateAPs, 1);
 }
 
 void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    Timestamp.Seconds    = 3;
-    Timestamp.Subseconds = 5;
+    PacketTime.Timestamp.Seconds    = 3;
+    PacketTime.Timestamp.Subseconds = 5;
+    PacketTime.Resolved             = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -517,7 +2458,7 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void)
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE,
@@ -543,11 +2484,12 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void)
 void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousTrue(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    Timestamp.Seconds    = 3;
-    Timestamp.Subseconds = 5;
+    PacketTime.Timestamp.Seconds    = 3;
+    PacketTime.Timestamp.Subseconds = 5;
+    PacketTime.Resolved             = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -560,7 +2502,7 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousTrue(void)
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE,
@@ -586,10 +2528,11 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousTrue(void)
 void LC_ProcessWP_Test_BadSize(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    memset(&Timestamp, 0, sizeof(Timestamp));
+    memset(&PacketTime, 0, sizeof(PacketTime));
+    PacketTime.Resolved = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -599,22 +2542,24 @@ void LC_ProcessWP_Test_BadSize(void)
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
 
     /* this generates 1 event message in a subfunction */
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 1);
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
 }
 
 void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousTrue(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    Timestamp.Seconds    = 3;
-    Timestamp.Subseconds = 5;
+    PacketTime.Timestamp.Seconds    = 3;
+    PacketTime.Timestamp.Subseconds = 5;
+    PacketTime.Resolved             = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -625,9 +2570,10 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousTrue(void)
     LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
+    LC_OperData.CDSDirty                                   = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_TRUE,
@@ -635,6 +2581,9 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousTrue(void)
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
                   "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
 
+    /* The result did not change, but the statistics saved to the CDS did */
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_WRT);
+
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount == 1,
                   "LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount == 1");
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 1,
@@ -648,16 +2597,19 @@ void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousTrue(void)
                   "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value == 0");
 
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 0);
+    UtAssert_STUB_COUNT(LC_QueueImmediateAPs, 0);
 }
 
 void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse(void)
 {
     uint16             WatchIndex = 0;
-    CFE_TIME_SysTime_t Timestamp;
+    LC_PacketTime_t    PacketTime;
     CFE_SB_MsgId_t     TestMsgId = LC_UT_MID_1;
 
-    Timestamp.Seconds    = 3;
-    Timestamp.Subseconds = 5;
+    PacketTime.Timestamp.Seconds    = 3;
+    PacketTime.Timestamp.Subseconds = 5;
+    PacketTime.Resolved             = true;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
@@ -670,7 +2622,7 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse(void)
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, Timestamp);
+    LC_ProcessWP(WatchIndex, &UT_CmdBuf.Buf, &PacketTime);
 
     /* Verify results */
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE,
@@ -689,6 +2641,173 @@ void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse(void)
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
 }
 
+void LC_ProcessWP_Test_QWordUpperHalf(void)
+{
+    static uint32      PacketWords[8];
+    uint8             *Packet     = (uint8 *)PacketWords;
+    uint16             WatchIndex = 0;
+    LC_PacketTime_t    PacketTime = { .Timestamp = { .Seconds = 3, .Subseconds = 5 }, .Resolved = true };
+
+    /* 0x00000001_12345678 big endian at an odd offset */
+    memcpy(&Packet[13], "\x00\x00\x00\x01\x12\x34\x56\x78", 8);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                   = LC_DATA_WATCH_UQWORD_BE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID                 = LC_OPER_GT;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset           = 13;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                    = 0x0000FF00;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale         = 1;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned64 = 0xFFFFFFFF;
+    LC_OperData.WRTPtr[WatchIndex].WatchResult                = LC_WATCH_STALE;
+
+    /* Execute the function being tested */
+    LC_ProcessWP(WatchIndex, (CFE_SB_Buffer_t *)PacketWords, &PacketTime);
+
+    /* The mask only applies to the lower half so the value stays above 32 bits */
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[WatchIndex].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value, 0x00005600);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.ValueUpper, 0x00000001);
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.DataType, LC_DATA_WATCH_UQWORD_BE);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_ArmStaleTimer_Test_Nominal(void)
+{
+    LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+
+    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_TRUE;
+    LC_OperData.WRTPtr[2].WatchResult = LC_WATCH_FALSE;
+    LC_OperData.WRTPtr[3].WatchResult = LC_WATCH_TRUE;
+
+    /* Execute the function being tested, watchpoint 3 shares the slot a lap later */
+    LC_ArmStaleTimer(1, 3);
+    LC_ArmStaleTimer(2, 3);
+    LC_ArmStaleTimer(3, 3 + LC_STALE_WHEEL_SLOTS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].CountdownToStale, 3);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].CountdownToStale, 3 + LC_STALE_WHEEL_SLOTS);
+    UtAssert_UINT32_EQ(Wheel->Head[3 & LC_STALE_WHEEL_MASK], 3 + 1);
+    UtAssert_UINT32_EQ(Wheel->Next[3], 2 + 1);
+    UtAssert_UINT32_EQ(Wheel->Next[2], 1 + 1);
+    UtAssert_UINT32_EQ(Wheel->Next[1], 0);
+
+    LC_AgeWatchResults();
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 0);
+
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].WatchResult, LC_WATCH_STALE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].WatchResult, LC_WATCH_STALE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].WatchResult, LC_WATCH_TRUE);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].CountdownToStale, 0);
+    UtAssert_UINT32_EQ(Wheel->Head[3 & LC_STALE_WHEEL_MASK], 3 + 1);
+    UtAssert_UINT32_EQ(Wheel->Next[3], 0);
+
+    /* The table copy of the countdown is only brought up to date on request */
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].CountdownToStale, 3 + LC_STALE_WHEEL_SLOTS);
+    LC_OperData.CDSDirty = 0;
+    LC_SyncStaleCountdowns();
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[3].CountdownToStale, LC_STALE_WHEEL_SLOTS);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_WRT);
+
+    /* Countdowns already up to date leave the results unchanged */
+    LC_OperData.CDSDirty = 0;
+    LC_SyncStaleCountdowns();
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, 0);
+}
+
+void LC_ArmStaleTimer_Test_Rearm(void)
+{
+    LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+
+    LC_OperData.WRTPtr[5].WatchResult = LC_WATCH_TRUE;
+
+    LC_ArmStaleTimer(5, 2);
+    LC_AgeWatchResults();
+
+    /* Execute the function being tested, once in the same slot and once in another */
+    LC_ArmStaleTimer(5, 1);
+    UtAssert_UINT32_EQ(Wheel->Head[2 & LC_STALE_WHEEL_MASK], 5 + 1);
+
+    LC_ArmStaleTimer(5, 2);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Wheel->Head[2 & LC_STALE_WHEEL_MASK], 0);
+    UtAssert_UINT32_EQ(Wheel->Head[3 & LC_STALE_WHEEL_MASK], 5 + 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[5].CountdownToStale, 2);
+
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 0);
+
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[5].WatchResult, LC_WATCH_STALE);
+
+    /* A zero countdown never goes stale */
+    LC_OperData.WRTPtr[5].WatchResult = LC_WATCH_TRUE;
+    LC_ArmStaleTimer(5, 4);
+    LC_ArmStaleTimer(5, 0);
+    UtAssert_UINT32_EQ(Wheel->Armed[0], 0);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[5].CountdownToStale, 0);
+}
+
+void LC_DisarmStaleTimer_Test_MiddleOfSlot(void)
+{
+    LC_StaleWheel_t *Wheel = &LC_OperData.StaleWheel;
+
+    LC_ArmStaleTimer(1, 1);
+    LC_ArmStaleTimer(2, 1);
+    LC_ArmStaleTimer(3, 1);
+
+    /* Execute the function being tested */
+    LC_DisarmStaleTimer(2);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[2].CountdownToStale, 0);
+    UtAssert_UINT32_EQ(Wheel->Next[3], 1 + 1);
+    UtAssert_UINT32_EQ(Wheel->Prev[1], 3 + 1);
+
+    LC_DisarmStaleTimer(3);
+    UtAssert_UINT32_EQ(Wheel->Head[1 & LC_STALE_WHEEL_MASK], 1 + 1);
+    UtAssert_UINT32_EQ(Wheel->Prev[1], 0);
+
+    /* Disarming an unlinked watchpoint only clears its countdown */
+    LC_OperData.WRTPtr[4].CountdownToStale = 7;
+    LC_DisarmStaleTimer(4);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[4].CountdownToStale, 0);
+
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[1].WatchResult, LC_WATCH_STALE);
+}
+
+void LC_BuildStaleWheel_Test_Nominal(void)
+{
+    LC_OperData.StaleWheel.AgeTick = 99;
+    LC_OperData.StaleWheel.Head[0] = 99;
+
+    LC_OperData.WRTPtr[0].WatchResult                           = LC_WATCH_TRUE;
+    LC_OperData.WRTPtr[0].CountdownToStale                      = 2;
+    LC_OperData.WRTPtr[LC_MAX_WATCHPOINTS - 1].WatchResult      = LC_WATCH_FALSE;
+    LC_OperData.WRTPtr[LC_MAX_WATCHPOINTS - 1].CountdownToStale = 1;
+
+    /* Execute the function being tested */
+    LC_BuildStaleWheel();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(LC_OperData.StaleWheel.AgeTick, 0);
+    UtAssert_UINT32_EQ(LC_OperData.StaleWheel.Head[0], 0);
+
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 1);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[LC_MAX_WATCHPOINTS - 1].WatchResult, LC_WATCH_STALE);
+
+    LC_AgeWatchResults();
+    UtAssert_STUB_COUNT(LC_WatchResultChanged, 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[0].WatchResult, LC_WATCH_STALE);
+}
+
 void LC_OperatorCompare_Test_DataByte(void)
 {
     uint8  Result;
@@ -850,6 +2969,55 @@ void LC_OperatorCompare_Test_DataFloatLE(void)
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
 }
 
+void LC_OperatorCompare_Test_DataQWordLE(void)
+{
+    uint16 WatchIndex = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                 = LC_DATA_WATCH_QWORD_LE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID               = LC_OPER_LT;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed64 = -4294967296LL;
+
+    /* Execute the function being tested, values only differ above 32 bits */
+    UtAssert_UINT8_EQ(LC_OperatorCompare(WatchIndex, (uint64)-8589934592LL), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_OperatorCompare(WatchIndex, 0), LC_WATCH_FALSE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_OperatorCompare_Test_DataUQWordBE(void)
+{
+    uint16 WatchIndex = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                   = LC_DATA_WATCH_UQWORD_BE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID                 = LC_OPER_GE;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned64 = 0x8000000000000000ULL;
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(LC_OperatorCompare(WatchIndex, 0x8000000000000000ULL), LC_WATCH_TRUE);
+    UtAssert_UINT8_EQ(LC_OperatorCompare(WatchIndex, 0x7FFFFFFFFFFFFFFFULL), LC_WATCH_FALSE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_OperatorCompare_Test_DataDoubleBE(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPValue;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_WATCH_DOUBLE_BE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_GT;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Float64 = 1.0e300;
+
+    /* Execute the function being tested with a value out of float range */
+    WPValue.Float64 = 2.0e300;
+    UtAssert_UINT8_EQ(LC_OperatorCompare(WatchIndex, WPValue.Unsigned64), LC_WATCH_TRUE);
+
+    WPValue.Float64 = -2.0e300;
+    UtAssert_UINT8_EQ(LC_OperatorCompare(WatchIndex, WPValue.Unsigned64), LC_WATCH_FALSE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void LC_OperatorCompare_Test_DataTypeError(void)
 {
     uint8  Result;
@@ -1396,6 +3564,193 @@ void LC_FloatCompare_Test_NaN(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
+void LC_DoubleCompare_Test_EQ(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+
+    WPMultiType.Float64      = 1.0;
+    CompareMultiType.Float64 = 1.0 + (LC_FLOAT_TOLERANCE / 2);
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(LC_DoubleCompare(WatchIndex, &WPMultiType, &CompareMultiType), LC_WATCH_TRUE);
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
+    UtAssert_UINT8_EQ(LC_DoubleCompare(WatchIndex, &WPMultiType, &CompareMultiType), LC_WATCH_FALSE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_DoubleCompare_Test_NaN(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+
+    WPMultiType.Unsigned64   = 0x7FF8000000000001ULL;
+    CompareMultiType.Float64 = 0.0;
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(LC_DoubleCompare(WatchIndex, &WPMultiType, &CompareMultiType), LC_WATCH_ERROR);
+
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_NAN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void LC_DoubleCompare_Test_InvalidOperatorID(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+
+    WPMultiType.Float64      = 1.0;
+    CompareMultiType.Float64 = 0.0;
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(LC_DoubleCompare(WatchIndex, &WPMultiType, &CompareMultiType), LC_WATCH_ERROR);
+
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OPERID_ERR_EID);
+}
+
+void LC_RangeCompare_Test_UQWordInRange(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+    LC_MultiType_t SecondMultiType;
+
+    CompareMultiType.Unsigned64 = 0x100000000ULL;
+    SecondMultiType.Unsigned64  = 0x200000000ULL;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType   = LC_DATA_WATCH_UQWORD_LE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_IN_RANGE;
+
+    /* Execute the function being tested */
+    WPMultiType.Unsigned64 = 0x100000000ULL;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType), LC_WATCH_TRUE);
+
+    WPMultiType.Unsigned64 = 0xFFFFFFFFULL;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType),
+                      LC_WATCH_FALSE);
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_OUT_OF_RANGE;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType), LC_WATCH_TRUE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_RangeCompare_Test_Hysteresis(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+    LC_MultiType_t SecondMultiType;
+
+    /* Set below -1.0, clear above 1.0 */
+    CompareMultiType.Float64 = -1.0;
+    SecondMultiType.Float64  = 1.0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType   = LC_DATA_WATCH_DOUBLE_BE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_HYSTERESIS;
+
+    /* Execute the function being tested */
+    WPMultiType.Float64                        = 0.0;
+    LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_TRUE;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType), LC_WATCH_TRUE);
+
+    LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_STALE;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType),
+                      LC_WATCH_FALSE);
+
+    WPMultiType.Float64 = -1.0;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType), LC_WATCH_TRUE);
+
+    WPMultiType.Float64                        = 1.0;
+    LC_OperData.WRTPtr[WatchIndex].WatchResult = LC_WATCH_TRUE;
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType),
+                      LC_WATCH_FALSE);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_RangeCompare_Test_NaN(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+    LC_MultiType_t SecondMultiType;
+
+    WPMultiType.Unsigned32   = 0x7FC00001;
+    CompareMultiType.Float32 = 0.0;
+    SecondMultiType.Float32  = 1.0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType   = LC_DATA_WATCH_FLOAT_LE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_OUT_OF_RANGE;
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType),
+                      LC_WATCH_ERROR);
+
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_NAN_ERR_EID);
+}
+
+void LC_RangeCompare_Test_InvalidOperatorID(void)
+{
+    uint16         WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+    LC_MultiType_t SecondMultiType;
+
+    WPMultiType.Unsigned32      = 1;
+    CompareMultiType.Unsigned32 = 0;
+    SecondMultiType.Unsigned32  = 2;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType   = LC_DATA_WATCH_UDWORD_BE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(LC_RangeCompare(WatchIndex, &WPMultiType, &CompareMultiType, &SecondMultiType),
+                      LC_WATCH_ERROR);
+
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OPERID_ERR_EID);
+}
+
+void LC_MultiTypeCompare_Test(void)
+{
+    LC_MultiType_t Value;
+    LC_MultiType_t Reference;
+
+    /* Sign matters for the signed types */
+    Value.Signed16     = -1;
+    Reference.Signed16 = 1;
+    UtAssert_BOOL_TRUE(LC_MultiTypeCompare(LC_DATA_WATCH_WORD_BE, LC_OPER_LT, &Value, &Reference));
+    UtAssert_BOOL_FALSE(LC_MultiTypeCompare(LC_DATA_WATCH_UWORD_BE, LC_OPER_LT, &Value, &Reference));
+
+    Value.Signed64     = -2;
+    Reference.Signed64 = -2;
+    UtAssert_BOOL_TRUE(LC_MultiTypeCompare(LC_DATA_WATCH_QWORD_LE, LC_OPER_EQ, &Value, &Reference));
+    UtAssert_BOOL_TRUE(LC_MultiTypeCompare(LC_DATA_WATCH_QWORD_LE, LC_OPER_GE, &Value, &Reference));
+    UtAssert_BOOL_FALSE(LC_MultiTypeCompare(LC_DATA_WATCH_QWORD_LE, LC_OPER_NE, &Value, &Reference));
+
+    /* Every relation but not equal is false for a NAN */
+    Value.Unsigned32  = 0x7FC00000;
+    Reference.Float32 = 0.0;
+    UtAssert_BOOL_FALSE(LC_MultiTypeCompare(LC_DATA_WATCH_FLOAT_BE, LC_OPER_LE, &Value, &Reference));
+    UtAssert_BOOL_FALSE(LC_MultiTypeCompare(LC_DATA_WATCH_FLOAT_BE, LC_OPER_GT, &Value, &Reference));
+    UtAssert_BOOL_TRUE(LC_MultiTypeCompare(LC_DATA_WATCH_FLOAT_BE, LC_OPER_NE, &Value, &Reference));
+}
+
 void LC_WPOffsetValid_Test_DataUByte(void)
 {
     bool           Result;
@@ -1488,6 +3843,29 @@ void LC_WPOffsetValid_Test_FloatLE(void)
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
 }
 
+void LC_WPOffsetValid_Test_DoubleLE(void)
+{
+    uint16         WatchIndex = 0;
+    CFE_SB_MsgId_t TestMsgId  = LC_UT_MID_1;
+    size_t         MsgSize    = 16;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetSize), CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_DOUBLE_LE;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 8;
+
+    /* Execute the function being tested, eight bytes fit exactly */
+    UtAssert_BOOL_TRUE(LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* One byte further runs past the end */
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 9;
+    UtAssert_BOOL_FALSE(LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OFFSET_ERR_EID);
+}
+
 void LC_WPOffsetValid_Test_DataTypeError(void)
 {
     bool           Result;
@@ -1554,6 +3932,7 @@ void LC_WPOffsetValid_Test_OffsetError(void)
                   "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR");
     UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0,
                   "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0");
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].ErrorCount, 1);
 
     UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WP_OFFSET_ERR_EID);
@@ -1564,12 +3943,64 @@ void LC_WPOffsetValid_Test_OffsetError(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 }
 
+void LC_WPOffsetValid_Test_OffsetErrorThrottled(void)
+{
+    uint16 WatchIndex = 0;
+    size_t MsgSize    = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_WATCH_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = sizeof(LC_NoopCmd_t) - 1;
+
+    /* Event budget already used */
+    LC_OperData.WRTPtr[WatchIndex].ErrorCount = LC_WP_ERR_EVENT_LIMIT;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(LC_WPOffsetValid(WatchIndex, &UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(LC_OperData.WRTPtr[WatchIndex].WatchResult, LC_WATCH_ERROR);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].ErrorCount, LC_WP_ERR_EVENT_LIMIT + 1);
+
+    if (LC_WP_ERR_EVENT_INTERVAL > 1)
+    {
+        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+        UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+    }
+}
+
+void LC_CountWPError_Test_Budget(void)
+{
+    uint16 WatchIndex = 3;
+    uint32 Reported   = 0;
+    uint32 i;
+
+    LC_OperData.CDSDirty = 0;
+
+    /* Execute the function being tested */
+    for (i = 0; i < LC_WP_ERR_EVENT_LIMIT + (2 * LC_WP_ERR_EVENT_INTERVAL); i++)
+    {
+        if (LC_CountWPError(WatchIndex) == true)
+        {
+            Reported++;
+        }
+    }
+
+    /* First few errors reported, then one per interval, all counted */
+    UtAssert_UINT32_EQ(Reported, LC_WP_ERR_EVENT_LIMIT + 2);
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex].ErrorCount,
+                       LC_WP_ERR_EVENT_LIMIT + (2 * LC_WP_ERR_EVENT_INTERVAL));
+    UtAssert_UINT32_EQ(LC_OperData.WRTPtr[WatchIndex + 1].ErrorCount, 0);
+    UtAssert_UINT8_EQ(LC_OperData.CDSDirty, LC_CDS_DIRTY_WRT);
+}
+
 void LC_GetSizedWPData_Test_DataByte(void)
 {
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1593,7 +4024,7 @@ void LC_GetSizedWPData_Test_DataUByte(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1617,7 +4048,7 @@ void LC_GetSizedWPData_Test_DataWordBELittleEndian(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1641,7 +4072,7 @@ void LC_GetSizedWPData_Test_DataWordLELittleEndian(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1665,7 +4096,7 @@ void LC_GetSizedWPData_Test_DataUWordBELittleEndian(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1689,7 +4120,7 @@ void LC_GetSizedWPData_Test_DataUWordLELittleEndian(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1713,7 +4144,7 @@ void LC_GetSizedWPData_Test_DataFloatBELittleEndian(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1737,7 +4168,7 @@ void LC_GetSizedWPData_Test_DataFloatLELittleEndian(void)
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData = 0;
+    uint64 SizedData = 0;
 
     WPData[0] = 1;
     WPData[1] = 2;
@@ -1756,12 +4187,61 @@ void LC_GetSizedWPData_Test_DataFloatLELittleEndian(void)
     UtAssert_True(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0, "UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) == 0");
 }
 
+void LC_GetSizedWPData_Test_DataQWordBE(void)
+{
+    uint16 WatchIndex = 0;
+    uint8  WPData[8]  = { 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01 };
+    uint64 SizedData  = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_QWORD_BE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(LC_GetSizedWPData(WatchIndex, WPData, &SizedData));
+
+    /* Verify results */
+    UtAssert_True(SizedData == 0xFFFFFFFE00000001ULL, "SizedData == 0xFFFFFFFE00000001");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_GetSizedWPData_Test_DataDoubleLE(void)
+{
+    uint16         WatchIndex = 0;
+    uint8          WPData[8]  = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F };
+    uint64         SizedData  = 0;
+    LC_MultiType_t Value;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_DOUBLE_LE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(LC_GetSizedWPData(WatchIndex, WPData, &SizedData));
+
+    /* Verify results */
+    Value.Unsigned64 = SizedData;
+    UtAssert_True(Value.Float64 == 1.0, "Value.Float64 == 1.0");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void LC_GetSizedWPData_Test_SignExtendedUpperHalf(void)
+{
+    uint16 WatchIndex = 0;
+    uint8  WPData[4]  = { 0x80, 0x00, 0x00, 0x00 };
+    uint64 SizedData  = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WATCH_WORD_BE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(LC_GetSizedWPData(WatchIndex, WPData, &SizedData));
+
+    /* Narrow types are sign extended to 32 bits only */
+    UtAssert_True(SizedData == 0x00000000FFFF8000ULL, "SizedData == 0x00000000FFFF8000");
+}
+
 void LC_GetSizedWPData_Test_DataTypeError(void)
 {
     bool   Result;
     uint16 WatchIndex = 0;
     uint8  WPData[4];
-    uint32 SizedData;
+    uint64 SizedData;
 
     int32 strCmpResult;
     char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -1861,6 +4341,12 @@ void LC_ValidateWDT_Test_AllDataTypes(void)
     LC_OperData.WDTPtr[9].DataType  = LC_DATA_WATCH_UDWORD_LE;
     LC_OperData.WDTPtr[10].DataType = LC_DATA_WATCH_FLOAT_BE;
     LC_OperData.WDTPtr[11].DataType = LC_DATA_WATCH_FLOAT_LE;
+    LC_OperData.WDTPtr[12].DataType = LC_DATA_WATCH_QWORD_BE;
+    LC_OperData.WDTPtr[13].DataType = LC_DATA_WATCH_QWORD_LE;
+    LC_OperData.WDTPtr[14].DataType = LC_DATA_WATCH_UQWORD_BE;
+    LC_OperData.WDTPtr[15].DataType = LC_DATA_WATCH_UQWORD_LE;
+    LC_OperData.WDTPtr[16].DataType = LC_DATA_WATCH_DOUBLE_BE;
+    LC_OperData.WDTPtr[17].DataType = LC_DATA_WATCH_DOUBLE_LE;
 
     /* Execute the function being tested */
     Result = LC_ValidateWDT(LC_OperData.WDTPtr);
@@ -1915,6 +4401,9 @@ void LC_ValidateWDT_Test_AllOperatorIDs(void)
     LC_OperData.WDTPtr[4].OperatorID = LC_OPER_GE;
     LC_OperData.WDTPtr[5].OperatorID = LC_OPER_GT;
     LC_OperData.WDTPtr[6].OperatorID = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[7].OperatorID = LC_OPER_IN_RANGE;
+    LC_OperData.WDTPtr[8].OperatorID = LC_OPER_OUT_OF_RANGE;
+    LC_OperData.WDTPtr[9].OperatorID = LC_OPER_HYSTERESIS;
 
     /* Execute the function being tested */
     Result = LC_ValidateWDT(LC_OperData.WDTPtr);
@@ -2070,6 +4559,32 @@ void LC_ValidateWDT_Test_BadMessageID(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 }
 
+void LC_ValidateWDT_Test_BadOptions(void)
+{
+    int32 Result;
+    int32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
+    {
+        LC_OperData.WDTPtr[TableIndex].DataType     = LC_DATA_WATCH_BYTE;
+        LC_OperData.WDTPtr[TableIndex].OperatorID   = LC_OPER_LT;
+        LC_OperData.WDTPtr[TableIndex].MessageID    = LC_UT_MID_1;
+        LC_OperData.WDTPtr[TableIndex].WatchOptions = LC_WATCH_OPT_CHANGE_ONLY;
+    }
+
+    LC_OperData.WDTPtr[5].WatchOptions = (uint8)~LC_WATCH_OPT_MASK;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, LC_WDTVAL_ERR_OPTIONS);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WDTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, LC_WDTVAL_INF_EID);
+}
+
 void LC_ValidateWDT_Test_NaN(void)
 {
     int32 Result;
@@ -2113,6 +4628,134 @@ void LC_ValidateWDT_Test_NaN(void)
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 }
 
+void LC_ValidateWDT_Test_DoubleNaN(void)
+{
+    int32 Result;
+    int32 TableIndex;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString,
+             CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "WDT verify float err: WP = %%d, Err = %%d, ComparisonValue = 0x%%08X%%08X");
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
+    {
+        LC_OperData.WDTPtr[TableIndex].DataType                   = LC_DATA_WATCH_DOUBLE_BE;
+        LC_OperData.WDTPtr[TableIndex].OperatorID                 = LC_OPER_LT;
+        LC_OperData.WDTPtr[TableIndex].MessageID                  = LC_UT_MID_1;
+        LC_OperData.WDTPtr[TableIndex].ComparisonValue.Unsigned64 = 0x7FF8000000000000ULL;
+    }
+
+    /* A finite double, whose lower half alone would not be a valid float */
+    LC_OperData.WDTPtr[0].ComparisonValue.Float64 = 1.0e300;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, LC_WDTVAL_ERR_FPNAN);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WDTVAL_FPERR_EID);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void LC_ValidateWDT_Test_DoubleInf(void)
+{
+    int32 Result;
+    int32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
+    {
+        LC_OperData.WDTPtr[TableIndex].DataType                   = LC_DATA_WATCH_DOUBLE_LE;
+        LC_OperData.WDTPtr[TableIndex].OperatorID                 = LC_OPER_LT;
+        LC_OperData.WDTPtr[TableIndex].MessageID                  = LC_UT_MID_1;
+        LC_OperData.WDTPtr[TableIndex].ComparisonValue.Unsigned64 = 0x7FF0000000000000ULL;
+    }
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, LC_WDTVAL_ERR_FPINF);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WDTVAL_FPERR_EID);
+}
+
+void LC_ValidateWDT_Test_RangeOrder(void)
+{
+    int32 Result;
+    int32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
+    {
+        LC_OperData.WDTPtr[TableIndex].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    /* Hysteresis thresholds may be in either order, range bounds may not */
+    LC_OperData.WDTPtr[0].DataType                      = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[0].OperatorID                    = LC_OPER_HYSTERESIS;
+    LC_OperData.WDTPtr[0].MessageID                     = LC_UT_MID_1;
+    LC_OperData.WDTPtr[0].ComparisonValue.Signed8       = 1;
+    LC_OperData.WDTPtr[0].SecondComparisonValue.Signed8 = -1;
+
+    LC_OperData.WDTPtr[1].DataType                      = LC_DATA_WATCH_BYTE;
+    LC_OperData.WDTPtr[1].OperatorID                    = LC_OPER_IN_RANGE;
+    LC_OperData.WDTPtr[1].MessageID                     = LC_UT_MID_1;
+    LC_OperData.WDTPtr[1].ComparisonValue.Signed8       = 1;
+    LC_OperData.WDTPtr[1].SecondComparisonValue.Signed8 = -1;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, LC_WDTVAL_ERR_RANGE);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WDTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, LC_WDTVAL_INF_EID);
+}
+
+void LC_ValidateWDT_Test_SecondValueNaN(void)
+{
+    int32 Result;
+    int32 TableIndex;
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString,
+             CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "WDT verify float err: WP = %%d, Err = %%d, ComparisonValue = 0x%%08X");
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++)
+    {
+        LC_OperData.WDTPtr[TableIndex].DataType = LC_DATA_WATCH_NOT_USED;
+    }
+
+    /* Only range operators use the second comparison value */
+    LC_OperData.WDTPtr[0].DataType                         = LC_DATA_WATCH_FLOAT_LE;
+    LC_OperData.WDTPtr[0].OperatorID                       = LC_OPER_LT;
+    LC_OperData.WDTPtr[0].MessageID                        = LC_UT_MID_1;
+    LC_OperData.WDTPtr[0].ComparisonValue.Float32          = 1.0;
+    LC_OperData.WDTPtr[0].SecondComparisonValue.Unsigned32 = 0x7F800001;
+
+    LC_OperData.WDTPtr[1]            = LC_OperData.WDTPtr[0];
+    LC_OperData.WDTPtr[1].OperatorID = LC_OPER_OUT_OF_RANGE;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, LC_WDTVAL_ERR_FPNAN);
+    UtAssert_INT32_EQ(UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)), 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, LC_WDTVAL_FPERR_EID);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
 void LC_ValidateWDT_Test_Inf(void)
 {
     int32 Result;
@@ -2262,24 +4905,127 @@ void LC_ValidateWDT_Test_FloatBE(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(LC_CreateHashTable_Test, LC_Test_Setup, LC_Test_TearDown, "LC_CreateHashTable_Test");
-
-    UtTest_Add(LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal,
+    UtTest_Add(LC_CreateHashTable_Test_InterleavedMessageIDs,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CreateHashTable_Test_InterleavedMessageIDs");
+    UtTest_Add(LC_CreateHashTable_Test_MaxMessageIDs,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CreateHashTable_Test_MaxMessageIDs");
+    UtTest_Add(LC_CreateHashTable_Test_HandlerMIDs,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CreateHashTable_Test_HandlerMIDs");
+    UtTest_Add(LC_CreateHashTable_Test_Reload, LC_Test_Setup, LC_Test_TearDown, "LC_CreateHashTable_Test_Reload");
+    UtTest_Add(LC_PublishIndex_Test, LC_Test_Setup, LC_Test_TearDown, "LC_PublishIndex_Test");
+    UtTest_Add(LC_ResetChangedWatchpoints_Test_Nominal,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ResetChangedWatchpoints_Test_Nominal");
+    UtTest_Add(LC_ResetChangedWatchpoints_Test_Unchanged,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ResetChangedWatchpoints_Test_Unchanged");
+    UtTest_Add(LC_AddWatchpoint_Test_NewMessageIDNominal,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_AddWatchpoint_Test_NewMessageIDNominal");
+    UtTest_Add(LC_AddWatchpoint_Test_ExistingMessageID,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_AddWatchpoint_Test_ExistingMessageID");
+    UtTest_Add(LC_CreateHashTable_Test_ReloadAfterUnsubscribeError,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CreateHashTable_Test_ReloadAfterUnsubscribeError");
+#if LC_UNREF_UNSUB_LIMIT > 0
+    UtTest_Add(LC_CreateHashTable_Test_ReloadAfterAutoUnsubscribe,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CreateHashTable_Test_ReloadAfterAutoUnsubscribe");
+#endif
+    UtTest_Add(LC_UpdateSubscriptions_Test_Nominal,
                LC_Test_Setup,
                LC_Test_TearDown,
-               "LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal");
-    UtTest_Add(LC_AddWatchpoint_Test_HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound,
+               "LC_UpdateSubscriptions_Test_Nominal");
+    UtTest_Add(LC_UpdateSubscriptions_Test_ErrorSubscribingWatchpoint,
                LC_Test_Setup,
                LC_Test_TearDown,
-               "LC_AddWatchpoint_Test_HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound");
-    UtTest_Add(LC_AddWatchpoint_Test_NullPointersErrorSubscribingWatchpoint,
+               "LC_UpdateSubscriptions_Test_ErrorSubscribingWatchpoint");
+    UtTest_Add(LC_BuildPerfectHash_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_BuildPerfectHash_Test_Nominal");
+    UtTest_Add(LC_FindMessageIndex_Test_LinearSearch,
                LC_Test_Setup,
                LC_Test_TearDown,
-               "LC_AddWatchpoint_Test_NullPointersErrorSubscribingWatchpoint");
-    UtTest_Add(LC_AddWatchpoint_Test_NonNullMessageList,
+               "LC_FindMessageIndex_Test_LinearSearch");
+    UtTest_Add(LC_FindMessageIndex_Test_SlotOwnedByOtherMessageID,
                LC_Test_Setup,
                LC_Test_TearDown,
-               "LC_AddWatchpoint_Test_NonNullMessageList");
+               "LC_FindMessageIndex_Test_SlotOwnedByOtherMessageID");
 
+    UtTest_Add(LC_CompileWatchpoints_Test_DataTypes,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompileWatchpoints_Test_DataTypes");
+    UtTest_Add(LC_CompileWatchpoints_Test_RangeOperators,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompileWatchpoints_Test_RangeOperators");
+    UtTest_Add(LC_ExtractWPData_Test, LC_Test_Setup, LC_Test_TearDown, "LC_ExtractWPData_Test");
+    UtTest_Add(LC_LoadBE16_Test_Misaligned, LC_Test_Setup, LC_Test_TearDown, "LC_LoadBE16_Test_Misaligned");
+    UtTest_Add(LC_GetSizedWPData_Test_Benchmark,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_GetSizedWPData_Test_Benchmark");
+    UtTest_Add(LC_ProcessCompiledWP_Test_MatchesProcessWP,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ProcessCompiledWP_Test_MatchesProcessWP");
+    UtTest_Add(LC_ProcessCompiledWP_Test_Custom, LC_Test_Setup, LC_Test_TearDown, "LC_ProcessCompiledWP_Test_Custom");
+    UtTest_Add(LC_ProcessCompiledWP_Test_Legacy, LC_Test_Setup, LC_Test_TearDown, "LC_ProcessCompiledWP_Test_Legacy");
+    UtTest_Add(LC_ProcessCompiledWP_Test_ChangeOnly,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ProcessCompiledWP_Test_ChangeOnly");
+    UtTest_Add(LC_ProcessCompiledWP_Test_ChangeOnlyNotSet,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ProcessCompiledWP_Test_ChangeOnlyNotSet");
+    UtTest_Add(LC_CompareWatchBatch_Test_MatchesScalar,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompareWatchBatch_Test_MatchesScalar");
+    UtTest_Add(LC_CompareCompiledRange_Test, LC_Test_Setup, LC_Test_TearDown, "LC_CompareCompiledRange_Test");
+    UtTest_Add(LC_CompareWatchBatchRange_Test_MatchesScalar,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompareWatchBatchRange_Test_MatchesScalar");
+    UtTest_Add(LC_GroupWatchpoints_Test, LC_Test_Setup, LC_Test_TearDown, "LC_GroupWatchpoints_Test");
+    UtTest_Add(LC_ProcessWatchBatch_Test_MatchesProcessWP,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ProcessWatchBatch_Test_MatchesProcessWP");
+    UtTest_Add(LC_CheckMsgForWPs_Test_ShortPacket,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_ShortPacket");
+    UtTest_Add(LC_CheckMsgForWPs_Test_FullPacket,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_FullPacket");
+    UtTest_Add(LC_CompileWatchpoints_Test_UnknownExtent,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompileWatchpoints_Test_UnknownExtent");
+    UtTest_Add(LC_CompileWatchpoints_Test_Digest, LC_Test_Setup, LC_Test_TearDown, "LC_CompileWatchpoints_Test_Digest");
+    UtTest_Add(LC_CheckMsgForWPs_Test_Digest, LC_Test_Setup, LC_Test_TearDown, "LC_CheckMsgForWPs_Test_Digest");
+    UtTest_Add(LC_CheckMsgDigest_Test_Collision, LC_Test_Setup, LC_Test_TearDown, "LC_CheckMsgDigest_Test_Collision");
+    UtTest_Add(LC_CheckMsgForWPs_Test_DigestShortPacket,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_DigestShortPacket");
+    UtTest_Add(LC_ReuseWatchResults_Test, LC_Test_Setup, LC_Test_TearDown, "LC_ReuseWatchResults_Test");
+    UtTest_Add(LC_DigestRange_Test, LC_Test_Setup, LC_Test_TearDown, "LC_DigestRange_Test");
     UtTest_Add(LC_CheckMsgForWPs_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_CheckMsgForWPs_Test_Nominal");
     UtTest_Add(LC_CheckMsgForWPs_Test_NominalMsgTime1,
                LC_Test_Setup,
@@ -2289,6 +5035,23 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_CheckMsgForWPs_Test_NominalMsgTime2");
+    UtTest_Add(LC_CheckMsgForWPs_Test_MultipleWatchpoints,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_MultipleWatchpoints");
+    UtTest_Add(LC_CheckMsgForWPs_Test_TransitionTimeOnce,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_TransitionTimeOnce");
+    UtTest_Add(LC_GetPacketTime_Test, LC_Test_Setup, LC_Test_TearDown, "LC_GetPacketTime_Test");
+    UtTest_Add(LC_CheckMsgForWPs_Test_SteadyStateBenchmark,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_SteadyStateBenchmark");
+    UtTest_Add(LC_CheckMsgForWPs_Test_ScalingBenchmark,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_ScalingBenchmark");
     UtTest_Add(LC_CheckMsgForWPs_Test_NominalDisabled,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -2297,6 +5060,28 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_CheckMsgForWPs_Test_UnreferencedMessageID");
+    UtTest_Add(LC_HandleUnreferencedMsg_Test_Throttle,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_HandleUnreferencedMsg_Test_Throttle");
+    UtTest_Add(LC_HandleUnreferencedMsg_Test_PerMessageID,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_HandleUnreferencedMsg_Test_PerMessageID");
+    UtTest_Add(LC_HandleUnreferencedMsg_Test_TableFull,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_HandleUnreferencedMsg_Test_TableFull");
+#if LC_UNREF_UNSUB_LIMIT > 0
+    UtTest_Add(LC_HandleUnreferencedMsg_Test_Unsubscribe,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_HandleUnreferencedMsg_Test_Unsubscribe");
+    UtTest_Add(LC_HandleUnreferencedMsg_Test_UnsubscribeError,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_HandleUnreferencedMsg_Test_UnsubscribeError");
+#endif
 
     UtTest_Add(LC_ProcessWP_Test_CustomFunctionWatchFalse,
                LC_Test_Setup,
@@ -2306,6 +5091,8 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_ProcessWP_Test_OperatorCompareError");
+    UtTest_Add(LC_ProcessWP_Test_ChangeOnlyError, LC_Test_Setup, LC_Test_TearDown, "LC_ProcessWP_Test_ChangeOnlyError");
+    UtTest_Add(LC_ProcessWP_Test_ChangeOnlyQWord, LC_Test_Setup, LC_Test_TearDown, "LC_ProcessWP_Test_ChangeOnlyQWord");
     UtTest_Add(LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -2332,6 +5119,15 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousFalse");
+    UtTest_Add(LC_ProcessWP_Test_QWordUpperHalf, LC_Test_Setup, LC_Test_TearDown, "LC_ProcessWP_Test_QWordUpperHalf");
+
+    UtTest_Add(LC_ArmStaleTimer_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_ArmStaleTimer_Test_Nominal");
+    UtTest_Add(LC_ArmStaleTimer_Test_Rearm, LC_Test_Setup, LC_Test_TearDown, "LC_ArmStaleTimer_Test_Rearm");
+    UtTest_Add(LC_DisarmStaleTimer_Test_MiddleOfSlot,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_DisarmStaleTimer_Test_MiddleOfSlot");
+    UtTest_Add(LC_BuildStaleWheel_Test_Nominal, LC_Test_Setup, LC_Test_TearDown, "LC_BuildStaleWheel_Test_Nominal");
 
     /* Note: Only testing little-ending (LE) cases.  Not testing big-endian (BE) cases. */
     UtTest_Add(LC_OperatorCompare_Test_DataByte, LC_Test_Setup, LC_Test_TearDown, "LC_OperatorCompare_Test_DataByte");
@@ -2356,6 +5152,18 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_OperatorCompare_Test_DataFloatLE");
+    UtTest_Add(LC_OperatorCompare_Test_DataQWordLE,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_OperatorCompare_Test_DataQWordLE");
+    UtTest_Add(LC_OperatorCompare_Test_DataUQWordBE,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_OperatorCompare_Test_DataUQWordBE");
+    UtTest_Add(LC_OperatorCompare_Test_DataDoubleBE,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_OperatorCompare_Test_DataDoubleBE");
     UtTest_Add(LC_OperatorCompare_Test_DataTypeError,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -2396,16 +5204,39 @@ void UtTest_Setup(void)
                LC_Test_TearDown,
                "LC_FloatCompare_Test_InvalidOperatorID");
     UtTest_Add(LC_FloatCompare_Test_NaN, LC_Test_Setup, LC_Test_TearDown, "LC_FloatCompare_Test_NaN");
+    UtTest_Add(LC_DoubleCompare_Test_EQ, LC_Test_Setup, LC_Test_TearDown, "LC_DoubleCompare_Test_EQ");
+    UtTest_Add(LC_DoubleCompare_Test_NaN, LC_Test_Setup, LC_Test_TearDown, "LC_DoubleCompare_Test_NaN");
+    UtTest_Add(LC_DoubleCompare_Test_InvalidOperatorID,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_DoubleCompare_Test_InvalidOperatorID");
+    UtTest_Add(LC_RangeCompare_Test_UQWordInRange,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_RangeCompare_Test_UQWordInRange");
+    UtTest_Add(LC_RangeCompare_Test_Hysteresis, LC_Test_Setup, LC_Test_TearDown, "LC_RangeCompare_Test_Hysteresis");
+    UtTest_Add(LC_RangeCompare_Test_NaN, LC_Test_Setup, LC_Test_TearDown, "LC_RangeCompare_Test_NaN");
+    UtTest_Add(LC_RangeCompare_Test_InvalidOperatorID,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_RangeCompare_Test_InvalidOperatorID");
+    UtTest_Add(LC_MultiTypeCompare_Test, LC_Test_Setup, LC_Test_TearDown, "LC_MultiTypeCompare_Test");
 
     UtTest_Add(LC_WPOffsetValid_Test_DataUByte, LC_Test_Setup, LC_Test_TearDown, "LC_WPOffsetValid_Test_DataUByte");
     UtTest_Add(LC_WPOffsetValid_Test_UWordLE, LC_Test_Setup, LC_Test_TearDown, "LC_WPOffsetValid_Test_UWordLE");
     UtTest_Add(LC_WPOffsetValid_Test_UDWordLE, LC_Test_Setup, LC_Test_TearDown, "LC_WPOffsetValid_Test_UDWordLE");
     UtTest_Add(LC_WPOffsetValid_Test_FloatLE, LC_Test_Setup, LC_Test_TearDown, "LC_WPOffsetValid_Test_FloatLE");
+    UtTest_Add(LC_WPOffsetValid_Test_DoubleLE, LC_Test_Setup, LC_Test_TearDown, "LC_WPOffsetValid_Test_DoubleLE");
     UtTest_Add(LC_WPOffsetValid_Test_DataTypeError,
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_WPOffsetValid_Test_DataTypeError");
     UtTest_Add(LC_WPOffsetValid_Test_OffsetError, LC_Test_Setup, LC_Test_TearDown, "LC_WPOffsetValid_Test_OffsetError");
+    UtTest_Add(LC_WPOffsetValid_Test_OffsetErrorThrottled,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_WPOffsetValid_Test_OffsetErrorThrottled");
+    UtTest_Add(LC_CountWPError_Test_Budget, LC_Test_Setup, LC_Test_TearDown, "LC_CountWPError_Test_Budget");
 
     UtTest_Add(LC_GetSizedWPData_Test_DataByte, LC_Test_Setup, LC_Test_TearDown, "LC_GetSizedWPData_Test_DataByte");
     UtTest_Add(LC_GetSizedWPData_Test_DataUByte, LC_Test_Setup, LC_Test_TearDown, "LC_GetSizedWPData_Test_DataUByte");
@@ -2433,6 +5264,18 @@ void UtTest_Setup(void)
                LC_Test_Setup,
                LC_Test_TearDown,
                "LC_GetSizedWPData_Test_DataFloatLELittleEndian");
+    UtTest_Add(LC_GetSizedWPData_Test_DataQWordBE,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_GetSizedWPData_Test_DataQWordBE");
+    UtTest_Add(LC_GetSizedWPData_Test_DataDoubleLE,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_GetSizedWPData_Test_DataDoubleLE");
+    UtTest_Add(LC_GetSizedWPData_Test_SignExtendedUpperHalf,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_GetSizedWPData_Test_SignExtendedUpperHalf");
     UtTest_Add(LC_GetSizedWPData_Test_DataTypeError,
                LC_Test_Setup,
                LC_Test_TearDown,
@@ -2451,7 +5294,15 @@ void UtTest_Setup(void)
                LC_Test_TearDown,
                "LC_ValidateWDT_Test_InvalidOperator");
     UtTest_Add(LC_ValidateWDT_Test_BadMessageID, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_BadMessageID");
+    UtTest_Add(LC_ValidateWDT_Test_BadOptions, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_BadOptions");
     UtTest_Add(LC_ValidateWDT_Test_NaN, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_NaN");
+    UtTest_Add(LC_ValidateWDT_Test_DoubleNaN, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_DoubleNaN");
+    UtTest_Add(LC_ValidateWDT_Test_DoubleInf, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_DoubleInf");
+    UtTest_Add(LC_ValidateWDT_Test_RangeOrder, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_RangeOrder");
+    UtTest_Add(LC_ValidateWDT_Test_SecondValueNaN,
+               LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_ValidateWDT_Test_SecondValueNaN");
     UtTest_Add(LC_ValidateWDT_Test_Inf, LC_Test_Setup, LC_Test_TearDown, "LC_ValidateWDT_Test_Inf");
     UtTest_Add(LC_ValidateWDT_Test_FloatingPointPassed,
                LC_Test_Setup,
@@ -25,6 +25,81 @@
 #include "lc_action.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_APNeedsEval()
+ * ----------------------------------------------------
+ */
+bool LC_APNeedsEval(uint16 APNumber)
+{
+    UT_GenStub_SetupReturnBuffer(LC_APNeedsEval, bool);
+
+    UT_GenStub_AddParam(LC_APNeedsEval, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_APNeedsEval, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_APNeedsEval, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_BuildAPDepends()
+ * ----------------------------------------------------
+ */
+void LC_BuildAPDepends(void)
+{
+    UT_GenStub_Execute(LC_BuildAPDepends, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_BuildWatchPlanes()
+ * ----------------------------------------------------
+ */
+void LC_BuildWatchPlanes(void)
+{
+    UT_GenStub_Execute(LC_BuildWatchPlanes, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ClassifyRPN()
+ * ----------------------------------------------------
+ */
+void LC_ClassifyRPN(uint16 APNumber)
+{
+    UT_GenStub_AddParam(LC_ClassifyRPN, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_ClassifyRPN, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileActionpoints()
+ * ----------------------------------------------------
+ */
+void LC_CompileActionpoints(void)
+{
+    UT_GenStub_Execute(LC_CompileActionpoints, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileRPN()
+ * ----------------------------------------------------
+ */
+uint16 LC_CompileRPN(const uint16 *RPNPtr, LC_RPNInstr_t *Code)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CompileRPN, uint16);
+
+    UT_GenStub_AddParam(LC_CompileRPN, const uint16 *, RPNPtr);
+    UT_GenStub_AddParam(LC_CompileRPN, LC_RPNInstr_t *, Code);
+
+    UT_GenStub_Execute(LC_CompileRPN, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CompileRPN, uint16);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_EvaluateRPN()
@@ -41,6 +116,118 @@ uint8 LC_EvaluateRPN(uint16 APNumber)
     return UT_GenStub_GetReturnValue(LC_EvaluateRPN, uint8);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_EvaluateWatchMask()
+ * ----------------------------------------------------
+ */
+uint8 LC_EvaluateWatchMask(uint16 APNumber)
+{
+    UT_GenStub_SetupReturnBuffer(LC_EvaluateWatchMask, uint8);
+
+    UT_GenStub_AddParam(LC_EvaluateWatchMask, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_EvaluateWatchMask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_EvaluateWatchMask, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_GetPlaneResult()
+ * ----------------------------------------------------
+ */
+uint8 LC_GetPlaneResult(uint16 WatchIndex)
+{
+    UT_GenStub_SetupReturnBuffer(LC_GetPlaneResult, uint8);
+
+    UT_GenStub_AddParam(LC_GetPlaneResult, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_GetPlaneResult, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_GetPlaneResult, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_InterpretRPN()
+ * ----------------------------------------------------
+ */
+uint8 LC_InterpretRPN(uint16 APNumber)
+{
+    UT_GenStub_SetupReturnBuffer(LC_InterpretRPN, uint8);
+
+    UT_GenStub_AddParam(LC_InterpretRPN, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_InterpretRPN, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_InterpretRPN, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_MarkAPDirty()
+ * ----------------------------------------------------
+ */
+void LC_MarkAPDirty(uint16 APNumber)
+{
+    UT_GenStub_AddParam(LC_MarkAPDirty, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_MarkAPDirty, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_QueueImmediateAPs()
+ * ----------------------------------------------------
+ */
+void LC_QueueImmediateAPs(uint16 WatchIndex)
+{
+    UT_GenStub_AddParam(LC_QueueImmediateAPs, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_QueueImmediateAPs, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_RecordRTSLatency()
+ * ----------------------------------------------------
+ */
+void LC_RecordRTSLatency(CFE_TIME_SysTime_t Timestamp)
+{
+    UT_GenStub_AddParam(LC_RecordRTSLatency, CFE_TIME_SysTime_t, Timestamp);
+
+    UT_GenStub_Execute(LC_RecordRTSLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_RunImmediateAPs()
+ * ----------------------------------------------------
+ */
+void LC_RunImmediateAPs(LC_PacketTime_t *PacketTime)
+{
+    UT_GenStub_AddParam(LC_RunImmediateAPs, LC_PacketTime_t *, PacketTime);
+
+    UT_GenStub_Execute(LC_RunImmediateAPs, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_RunRPNProgram()
+ * ----------------------------------------------------
+ */
+uint8 LC_RunRPNProgram(uint16 APNumber)
+{
+    UT_GenStub_SetupReturnBuffer(LC_RunRPNProgram, uint8);
+
+    UT_GenStub_AddParam(LC_RunRPNProgram, uint16, APNumber);
+
+    UT_GenStub_Execute(LC_RunRPNProgram, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_RunRPNProgram, uint8);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_SampleAPs()
@@ -99,3 +286,15 @@ int32 LC_ValidateRPN(const uint16 *RPNPtr, int32 *IndexValue, int32 *StackDepthV
 
     return UT_GenStub_GetReturnValue(LC_ValidateRPN, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_WatchResultChanged()
+ * ----------------------------------------------------
+ */
+void LC_WatchResultChanged(uint16 WatchIndex)
+{
+    UT_GenStub_AddParam(LC_WatchResultChanged, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_WatchResultChanged, Basic, NULL);
+}
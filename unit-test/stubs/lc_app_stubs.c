@@ -49,6 +49,19 @@ void LC_AppMain(void)
     UT_GenStub_Execute(LC_AppMain, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CheckMsgSequence()
+ * ----------------------------------------------------
+ */
+void LC_CheckMsgSequence(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_AddParam(LC_CheckMsgSequence, const LC_MessageList_t *, MessageList);
+    UT_GenStub_AddParam(LC_CheckMsgSequence, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(LC_CheckMsgSequence, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_CreateDefinitionTables()
@@ -91,6 +104,38 @@ CFE_Status_t LC_CreateTaskCDS(void)
     return UT_GenStub_GetReturnValue(LC_CreateTaskCDS, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_DrainCmdPipe()
+ * ----------------------------------------------------
+ */
+CFE_Status_t LC_DrainCmdPipe(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_DrainCmdPipe, CFE_Status_t);
+
+    UT_GenStub_AddParam(LC_DrainCmdPipe, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(LC_DrainCmdPipe, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_DrainCmdPipe, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_DrainCtrlPipe()
+ * ----------------------------------------------------
+ */
+CFE_Status_t LC_DrainCtrlPipe(uint16 *BatchSize)
+{
+    UT_GenStub_SetupReturnBuffer(LC_DrainCtrlPipe, CFE_Status_t);
+
+    UT_GenStub_AddParam(LC_DrainCtrlPipe, uint16 *, BatchSize);
+
+    UT_GenStub_Execute(LC_DrainCtrlPipe, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_DrainCtrlPipe, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_EvsInit()
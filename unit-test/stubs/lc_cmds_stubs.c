@@ -202,3 +202,19 @@ CFE_Status_t LC_SetLCStateCmd(const LC_SetLCStateCmd_t *msg)
 
     return UT_GenStub_GetReturnValue(LC_SetLCStateCmd, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_SpreadBits()
+ * ----------------------------------------------------
+ */
+uint64 LC_SpreadBits(uint32 Bits)
+{
+    UT_GenStub_SetupReturnBuffer(LC_SpreadBits, uint64);
+
+    UT_GenStub_AddParam(LC_SpreadBits, uint32, Bits);
+
+    UT_GenStub_Execute(LC_SpreadBits, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_SpreadBits, uint64);
+}
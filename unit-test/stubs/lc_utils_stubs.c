@@ -25,6 +25,40 @@
 #include "lc_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CDSWriterTask()
+ * ----------------------------------------------------
+ */
+void LC_CDSWriterTask(void)
+{
+    UT_GenStub_Execute(LC_CDSWriterTask, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CollectCDSWriter()
+ * ----------------------------------------------------
+ */
+CFE_Status_t LC_CollectCDSWriter(void)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CollectCDSWriter, CFE_Status_t);
+
+    UT_GenStub_Execute(LC_CollectCDSWriter, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CollectCDSWriter, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CreateCDSWriter()
+ * ----------------------------------------------------
+ */
+void LC_CreateCDSWriter(void)
+{
+    UT_GenStub_Execute(LC_CreateCDSWriter, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_ManageTables()
@@ -53,6 +87,30 @@ CFE_Status_t LC_PerformMaintenance(void)
     return UT_GenStub_GetReturnValue(LC_PerformMaintenance, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_StageTaskCDS()
+ * ----------------------------------------------------
+ */
+CFE_Status_t LC_StageTaskCDS(void)
+{
+    UT_GenStub_SetupReturnBuffer(LC_StageTaskCDS, CFE_Status_t);
+
+    UT_GenStub_Execute(LC_StageTaskCDS, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_StageTaskCDS, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_StopCDSWriter()
+ * ----------------------------------------------------
+ */
+void LC_StopCDSWriter(void)
+{
+    UT_GenStub_Execute(LC_StopCDSWriter, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_UpdateTaskCDS()
@@ -66,3 +124,25 @@ CFE_Status_t LC_UpdateTaskCDS(void)
 
     return UT_GenStub_GetReturnValue(LC_UpdateTaskCDS, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_WriteTaskCDS()
+ * ----------------------------------------------------
+ */
+CFE_Status_t LC_WriteTaskCDS(const LC_WRTEntry_t *WRTPtr, const LC_ARTEntry_t *ARTPtr, LC_AppData_t *AppDataPtr,
+                             uint8 Dirty, uint32 *BytesWritten, uint32 *WritesSkipped)
+{
+    UT_GenStub_SetupReturnBuffer(LC_WriteTaskCDS, CFE_Status_t);
+
+    UT_GenStub_AddParam(LC_WriteTaskCDS, const LC_WRTEntry_t *, WRTPtr);
+    UT_GenStub_AddParam(LC_WriteTaskCDS, const LC_ARTEntry_t *, ARTPtr);
+    UT_GenStub_AddParam(LC_WriteTaskCDS, LC_AppData_t *, AppDataPtr);
+    UT_GenStub_AddParam(LC_WriteTaskCDS, uint8, Dirty);
+    UT_GenStub_AddParam(LC_WriteTaskCDS, uint32 *, BytesWritten);
+    UT_GenStub_AddParam(LC_WriteTaskCDS, uint32 *, WritesSkipped);
+
+    UT_GenStub_Execute(LC_WriteTaskCDS, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_WriteTaskCDS, CFE_Status_t);
+}
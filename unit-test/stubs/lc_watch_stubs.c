@@ -25,20 +25,112 @@
 #include "lc_watch.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_AddHandlerMID()
+ * ----------------------------------------------------
+ */
+void LC_AddHandlerMID(CFE_SB_MsgId_t MessageID, uint8 Handler)
+{
+    UT_GenStub_AddParam(LC_AddHandlerMID, CFE_SB_MsgId_t, MessageID);
+    UT_GenStub_AddParam(LC_AddHandlerMID, uint8, Handler);
+
+    UT_GenStub_Execute(LC_AddHandlerMID, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_AddWatchpoint()
  * ----------------------------------------------------
  */
-LC_WatchPtList_t *LC_AddWatchpoint(const CFE_SB_MsgId_t MessageID)
+uint16 LC_AddWatchpoint(const CFE_SB_MsgId_t MessageID)
 {
-    UT_GenStub_SetupReturnBuffer(LC_AddWatchpoint, LC_WatchPtList_t *);
+    UT_GenStub_SetupReturnBuffer(LC_AddWatchpoint, uint16);
 
     UT_GenStub_AddParam(LC_AddWatchpoint, const CFE_SB_MsgId_t, MessageID);
 
     UT_GenStub_Execute(LC_AddWatchpoint, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(LC_AddWatchpoint, LC_WatchPtList_t *);
+    return UT_GenStub_GetReturnValue(LC_AddWatchpoint, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_AgeWatchResults()
+ * ----------------------------------------------------
+ */
+void LC_AgeWatchResults(void)
+{
+    UT_GenStub_Execute(LC_AgeWatchResults, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ArmStaleTimer()
+ * ----------------------------------------------------
+ */
+void LC_ArmStaleTimer(uint16 WatchIndex, uint32 Countdown)
+{
+    UT_GenStub_AddParam(LC_ArmStaleTimer, uint16, WatchIndex);
+    UT_GenStub_AddParam(LC_ArmStaleTimer, uint32, Countdown);
+
+    UT_GenStub_Execute(LC_ArmStaleTimer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_BuildPerfectHash()
+ * ----------------------------------------------------
+ */
+bool LC_BuildPerfectHash(void)
+{
+    UT_GenStub_SetupReturnBuffer(LC_BuildPerfectHash, bool);
+
+    UT_GenStub_Execute(LC_BuildPerfectHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_BuildPerfectHash, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_BuildStaleWheel()
+ * ----------------------------------------------------
+ */
+void LC_BuildStaleWheel(void)
+{
+    UT_GenStub_Execute(LC_BuildStaleWheel, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CheckIndexedMsgForWPs()
+ * ----------------------------------------------------
+ */
+void LC_CheckIndexedMsgForWPs(CFE_SB_MsgId_t MessageID, const LC_MessageList_t *MessageList,
+                              const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_AddParam(LC_CheckIndexedMsgForWPs, CFE_SB_MsgId_t, MessageID);
+    UT_GenStub_AddParam(LC_CheckIndexedMsgForWPs, const LC_MessageList_t *, MessageList);
+    UT_GenStub_AddParam(LC_CheckIndexedMsgForWPs, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(LC_CheckIndexedMsgForWPs, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CheckMsgDigest()
+ * ----------------------------------------------------
+ */
+bool LC_CheckMsgDigest(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CheckMsgDigest, bool);
+
+    UT_GenStub_AddParam(LC_CheckMsgDigest, const LC_MessageList_t *, MessageList);
+    UT_GenStub_AddParam(LC_CheckMsgDigest, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(LC_CheckMsgDigest, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CheckMsgDigest, bool);
 }
 
 /*
@@ -54,6 +146,164 @@ void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, const CFE_SB_Buffer_t *BufPtr)
     UT_GenStub_Execute(LC_CheckMsgForWPs, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CheckWatchCache()
+ * ----------------------------------------------------
+ */
+bool LC_CheckWatchCache(uint16 WatchIndex, uint64 MaskedWPData, uint8 *WPEvalResultPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CheckWatchCache, bool);
+
+    UT_GenStub_AddParam(LC_CheckWatchCache, uint16, WatchIndex);
+    UT_GenStub_AddParam(LC_CheckWatchCache, uint64, MaskedWPData);
+    UT_GenStub_AddParam(LC_CheckWatchCache, uint8 *, WPEvalResultPtr);
+
+    UT_GenStub_Execute(LC_CheckWatchCache, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CheckWatchCache, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompareCompiledRange()
+ * ----------------------------------------------------
+ */
+uint8 LC_CompareCompiledRange(uint8 Opcode, uint32 Value, uint32 Low, uint32 High, uint8 PreviousResult)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CompareCompiledRange, uint8);
+
+    UT_GenStub_AddParam(LC_CompareCompiledRange, uint8, Opcode);
+    UT_GenStub_AddParam(LC_CompareCompiledRange, uint32, Value);
+    UT_GenStub_AddParam(LC_CompareCompiledRange, uint32, Low);
+    UT_GenStub_AddParam(LC_CompareCompiledRange, uint32, High);
+    UT_GenStub_AddParam(LC_CompareCompiledRange, uint8, PreviousResult);
+
+    UT_GenStub_Execute(LC_CompareCompiledRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CompareCompiledRange, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompareCompiledValue()
+ * ----------------------------------------------------
+ */
+uint8 LC_CompareCompiledValue(uint8 Opcode, uint32 Value, uint32 CompareValue)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CompareCompiledValue, uint8);
+
+    UT_GenStub_AddParam(LC_CompareCompiledValue, uint8, Opcode);
+    UT_GenStub_AddParam(LC_CompareCompiledValue, uint32, Value);
+    UT_GenStub_AddParam(LC_CompareCompiledValue, uint32, CompareValue);
+
+    UT_GenStub_Execute(LC_CompareCompiledValue, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CompareCompiledValue, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompareWatchBatch()
+ * ----------------------------------------------------
+ */
+uint32 LC_CompareWatchBatch(uint8 Opcode, const uint32 *Values, const uint32 *Compare, uint32 Count, uint32 *NanMaskPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CompareWatchBatch, uint32);
+
+    UT_GenStub_AddParam(LC_CompareWatchBatch, uint8, Opcode);
+    UT_GenStub_AddParam(LC_CompareWatchBatch, const uint32 *, Values);
+    UT_GenStub_AddParam(LC_CompareWatchBatch, const uint32 *, Compare);
+    UT_GenStub_AddParam(LC_CompareWatchBatch, uint32, Count);
+    UT_GenStub_AddParam(LC_CompareWatchBatch, uint32 *, NanMaskPtr);
+
+    UT_GenStub_Execute(LC_CompareWatchBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CompareWatchBatch, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompareWatchBatchRange()
+ * ----------------------------------------------------
+ */
+uint32 LC_CompareWatchBatchRange(uint8 Opcode, const uint32 *Values, const uint32 *Low, const uint32 *High,
+                                 uint32 HoldMask, uint32 Count, uint32 *NanMaskPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CompareWatchBatchRange, uint32);
+
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, uint8, Opcode);
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, const uint32 *, Values);
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, const uint32 *, Low);
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, const uint32 *, High);
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, uint32, HoldMask);
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, uint32, Count);
+    UT_GenStub_AddParam(LC_CompareWatchBatchRange, uint32 *, NanMaskPtr);
+
+    UT_GenStub_Execute(LC_CompareWatchBatchRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CompareWatchBatchRange, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompareWatchBatchScalar()
+ * ----------------------------------------------------
+ */
+uint32 LC_CompareWatchBatchScalar(uint8 Opcode, const uint32 *Values, const uint32 *Compare, uint32 Count,
+                                  uint32 *NanMaskPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CompareWatchBatchScalar, uint32);
+
+    UT_GenStub_AddParam(LC_CompareWatchBatchScalar, uint8, Opcode);
+    UT_GenStub_AddParam(LC_CompareWatchBatchScalar, const uint32 *, Values);
+    UT_GenStub_AddParam(LC_CompareWatchBatchScalar, const uint32 *, Compare);
+    UT_GenStub_AddParam(LC_CompareWatchBatchScalar, uint32, Count);
+    UT_GenStub_AddParam(LC_CompareWatchBatchScalar, uint32 *, NanMaskPtr);
+
+    UT_GenStub_Execute(LC_CompareWatchBatchScalar, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CompareWatchBatchScalar, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileWatchpoint()
+ * ----------------------------------------------------
+ */
+void LC_CompileWatchpoint(uint32 Position)
+{
+    UT_GenStub_AddParam(LC_CompileWatchpoint, uint32, Position);
+
+    UT_GenStub_Execute(LC_CompileWatchpoint, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CompileWatchpoints()
+ * ----------------------------------------------------
+ */
+void LC_CompileWatchpoints(void)
+{
+    UT_GenStub_Execute(LC_CompileWatchpoints, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_CountWPError()
+ * ----------------------------------------------------
+ */
+bool LC_CountWPError(uint16 WatchIndex)
+{
+    UT_GenStub_SetupReturnBuffer(LC_CountWPError, bool);
+
+    UT_GenStub_AddParam(LC_CountWPError, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_CountWPError, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_CountWPError, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_CreateHashTable()
@@ -64,6 +314,102 @@ void LC_CreateHashTable(void)
     UT_GenStub_Execute(LC_CreateHashTable, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_DigestRange()
+ * ----------------------------------------------------
+ */
+uint64 LC_DigestRange(const uint8 *DataPtr, uint32 Length)
+{
+    UT_GenStub_SetupReturnBuffer(LC_DigestRange, uint64);
+
+    UT_GenStub_AddParam(LC_DigestRange, const uint8 *, DataPtr);
+    UT_GenStub_AddParam(LC_DigestRange, uint32, Length);
+
+    UT_GenStub_Execute(LC_DigestRange, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_DigestRange, uint64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_DisarmStaleTimer()
+ * ----------------------------------------------------
+ */
+void LC_DisarmStaleTimer(uint16 WatchIndex)
+{
+    UT_GenStub_AddParam(LC_DisarmStaleTimer, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_DisarmStaleTimer, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_DoubleCompare()
+ * ----------------------------------------------------
+ */
+uint8 LC_DoubleCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType)
+{
+    UT_GenStub_SetupReturnBuffer(LC_DoubleCompare, uint8);
+
+    UT_GenStub_AddParam(LC_DoubleCompare, uint16, WatchIndex);
+    UT_GenStub_AddParam(LC_DoubleCompare, LC_MultiType_t *, WPMultiType);
+    UT_GenStub_AddParam(LC_DoubleCompare, LC_MultiType_t *, CompareMultiType);
+
+    UT_GenStub_Execute(LC_DoubleCompare, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_DoubleCompare, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ExtractWPData()
+ * ----------------------------------------------------
+ */
+uint32 LC_ExtractWPData(uint8 Extract, const uint8 *WPDataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_ExtractWPData, uint32);
+
+    UT_GenStub_AddParam(LC_ExtractWPData, uint8, Extract);
+    UT_GenStub_AddParam(LC_ExtractWPData, const uint8 *, WPDataPtr);
+
+    UT_GenStub_Execute(LC_ExtractWPData, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_ExtractWPData, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_FindBuildSlot()
+ * ----------------------------------------------------
+ */
+uint32 LC_FindBuildSlot(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_SetupReturnBuffer(LC_FindBuildSlot, uint32);
+
+    UT_GenStub_AddParam(LC_FindBuildSlot, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(LC_FindBuildSlot, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_FindBuildSlot, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_FindMessageIndex()
+ * ----------------------------------------------------
+ */
+LC_MessageList_t *LC_FindMessageIndex(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_SetupReturnBuffer(LC_FindMessageIndex, LC_MessageList_t *);
+
+    UT_GenStub_AddParam(LC_FindMessageIndex, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(LC_FindMessageIndex, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_FindMessageIndex, LC_MessageList_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_FloatCompare()
@@ -98,91 +444,416 @@ uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID)
     return UT_GenStub_GetReturnValue(LC_GetHashTableIndex, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_GetPacketTime()
+ * ----------------------------------------------------
+ */
+CFE_TIME_SysTime_t LC_GetPacketTime(LC_PacketTime_t *PacketTime)
+{
+    UT_GenStub_SetupReturnBuffer(LC_GetPacketTime, CFE_TIME_SysTime_t);
+
+    UT_GenStub_AddParam(LC_GetPacketTime, LC_PacketTime_t *, PacketTime);
+
+    UT_GenStub_Execute(LC_GetPacketTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_GetPacketTime, CFE_TIME_SysTime_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_GetSizedWPData()
  * ----------------------------------------------------
  */
-bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint32 *SizedDataPtr)
+bool LC_GetSizedWPData(uint16 WatchIndex, const uint8 *WPDataPtr, uint64 *SizedDataPtr)
 {
     UT_GenStub_SetupReturnBuffer(LC_GetSizedWPData, bool);
 
     UT_GenStub_AddParam(LC_GetSizedWPData, uint16, WatchIndex);
     UT_GenStub_AddParam(LC_GetSizedWPData, const uint8 *, WPDataPtr);
-    UT_GenStub_AddParam(LC_GetSizedWPData, uint32 *, SizedDataPtr);
+    UT_GenStub_AddParam(LC_GetSizedWPData, uint64 *, SizedDataPtr);
 
     UT_GenStub_Execute(LC_GetSizedWPData, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(LC_GetSizedWPData, bool);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_GetWPDataSize()
+ * ----------------------------------------------------
+ */
+uint32 LC_GetWPDataSize(uint8 DataType)
+{
+    UT_GenStub_SetupReturnBuffer(LC_GetWPDataSize, uint32);
+
+    UT_GenStub_AddParam(LC_GetWPDataSize, uint8, DataType);
+
+    UT_GenStub_Execute(LC_GetWPDataSize, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_GetWPDataSize, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_GroupWatchpoints()
+ * ----------------------------------------------------
+ */
+void LC_GroupWatchpoints(void)
+{
+    UT_GenStub_Execute(LC_GroupWatchpoints, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_HandleUnreferencedMsg()
+ * ----------------------------------------------------
+ */
+void LC_HandleUnreferencedMsg(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_AddParam(LC_HandleUnreferencedMsg, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(LC_HandleUnreferencedMsg, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_HashMessageID()
+ * ----------------------------------------------------
+ */
+uint32 LC_HashMessageID(CFE_SB_MsgId_t MessageID, uint32 Seed)
+{
+    UT_GenStub_SetupReturnBuffer(LC_HashMessageID, uint32);
+
+    UT_GenStub_AddParam(LC_HashMessageID, CFE_SB_MsgId_t, MessageID);
+    UT_GenStub_AddParam(LC_HashMessageID, uint32, Seed);
+
+    UT_GenStub_Execute(LC_HashMessageID, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_HashMessageID, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_LoadBE16()
+ * ----------------------------------------------------
+ */
+uint16 LC_LoadBE16(const uint8 *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_LoadBE16, uint16);
+
+    UT_GenStub_AddParam(LC_LoadBE16, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(LC_LoadBE16, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_LoadBE16, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_LoadBE32()
+ * ----------------------------------------------------
+ */
+uint32 LC_LoadBE32(const uint8 *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_LoadBE32, uint32);
+
+    UT_GenStub_AddParam(LC_LoadBE32, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(LC_LoadBE32, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_LoadBE32, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_LoadBE64()
+ * ----------------------------------------------------
+ */
+uint64 LC_LoadBE64(const uint8 *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_LoadBE64, uint64);
+
+    UT_GenStub_AddParam(LC_LoadBE64, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(LC_LoadBE64, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_LoadBE64, uint64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_LoadLE16()
+ * ----------------------------------------------------
+ */
+uint16 LC_LoadLE16(const uint8 *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_LoadLE16, uint16);
+
+    UT_GenStub_AddParam(LC_LoadLE16, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(LC_LoadLE16, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_LoadLE16, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_LoadLE32()
+ * ----------------------------------------------------
+ */
+uint32 LC_LoadLE32(const uint8 *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_LoadLE32, uint32);
+
+    UT_GenStub_AddParam(LC_LoadLE32, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(LC_LoadLE32, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_LoadLE32, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_LoadLE64()
+ * ----------------------------------------------------
+ */
+uint64 LC_LoadLE64(const uint8 *DataPtr)
+{
+    UT_GenStub_SetupReturnBuffer(LC_LoadLE64, uint64);
+
+    UT_GenStub_AddParam(LC_LoadLE64, const uint8 *, DataPtr);
+
+    UT_GenStub_Execute(LC_LoadLE64, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_LoadLE64, uint64);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_MultiTypeCompare()
+ * ----------------------------------------------------
+ */
+bool LC_MultiTypeCompare(uint8 DataType, uint8 OperatorID, const LC_MultiType_t *Value, const LC_MultiType_t *Reference)
+{
+    UT_GenStub_SetupReturnBuffer(LC_MultiTypeCompare, bool);
+
+    UT_GenStub_AddParam(LC_MultiTypeCompare, uint8, DataType);
+    UT_GenStub_AddParam(LC_MultiTypeCompare, uint8, OperatorID);
+    UT_GenStub_AddParam(LC_MultiTypeCompare, const LC_MultiType_t *, Value);
+    UT_GenStub_AddParam(LC_MultiTypeCompare, const LC_MultiType_t *, Reference);
+
+    UT_GenStub_Execute(LC_MultiTypeCompare, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_MultiTypeCompare, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_OperatorCompare()
  * ----------------------------------------------------
  */
-uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData)
+uint8 LC_OperatorCompare(uint16 WatchIndex, uint64 ProcessedWPData)
 {
     UT_GenStub_SetupReturnBuffer(LC_OperatorCompare, uint8);
 
     UT_GenStub_AddParam(LC_OperatorCompare, uint16, WatchIndex);
-    UT_GenStub_AddParam(LC_OperatorCompare, uint32, ProcessedWPData);
+    UT_GenStub_AddParam(LC_OperatorCompare, uint64, ProcessedWPData);
 
     UT_GenStub_Execute(LC_OperatorCompare, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(LC_OperatorCompare, uint8);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ProcessCompiledWP()
+ * ----------------------------------------------------
+ */
+void LC_ProcessCompiledWP(uint32 Position, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime)
+{
+    UT_GenStub_AddParam(LC_ProcessCompiledWP, uint32, Position);
+    UT_GenStub_AddParam(LC_ProcessCompiledWP, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(LC_ProcessCompiledWP, LC_PacketTime_t *, PacketTime);
+
+    UT_GenStub_Execute(LC_ProcessCompiledWP, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_ProcessWP()
  * ----------------------------------------------------
  */
-void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, CFE_TIME_SysTime_t Timestamp)
+void LC_ProcessWP(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime)
 {
     UT_GenStub_AddParam(LC_ProcessWP, uint16, WatchIndex);
     UT_GenStub_AddParam(LC_ProcessWP, const CFE_SB_Buffer_t *, BufPtr);
-    UT_GenStub_AddParam(LC_ProcessWP, CFE_TIME_SysTime_t, Timestamp);
+    UT_GenStub_AddParam(LC_ProcessWP, LC_PacketTime_t *, PacketTime);
 
     UT_GenStub_Execute(LC_ProcessWP, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ProcessWatchBatch()
+ * ----------------------------------------------------
+ */
+void LC_ProcessWatchBatch(uint32 Position, uint32 Count, const CFE_SB_Buffer_t *BufPtr, LC_PacketTime_t *PacketTime)
+{
+    UT_GenStub_AddParam(LC_ProcessWatchBatch, uint32, Position);
+    UT_GenStub_AddParam(LC_ProcessWatchBatch, uint32, Count);
+    UT_GenStub_AddParam(LC_ProcessWatchBatch, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(LC_ProcessWatchBatch, LC_PacketTime_t *, PacketTime);
+
+    UT_GenStub_Execute(LC_ProcessWatchBatch, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_PublishIndex()
+ * ----------------------------------------------------
+ */
+void LC_PublishIndex(void)
+{
+    UT_GenStub_Execute(LC_PublishIndex, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_RangeCompare()
+ * ----------------------------------------------------
+ */
+uint8 LC_RangeCompare(uint16 WatchIndex, LC_MultiType_t *WPMultiType, LC_MultiType_t *CompareMultiType,
+                      LC_MultiType_t *SecondMultiType)
+{
+    UT_GenStub_SetupReturnBuffer(LC_RangeCompare, uint8);
+
+    UT_GenStub_AddParam(LC_RangeCompare, uint16, WatchIndex);
+    UT_GenStub_AddParam(LC_RangeCompare, LC_MultiType_t *, WPMultiType);
+    UT_GenStub_AddParam(LC_RangeCompare, LC_MultiType_t *, CompareMultiType);
+    UT_GenStub_AddParam(LC_RangeCompare, LC_MultiType_t *, SecondMultiType);
+
+    UT_GenStub_Execute(LC_RangeCompare, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_RangeCompare, uint8);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ResetChangedWatchpoints()
+ * ----------------------------------------------------
+ */
+uint16 LC_ResetChangedWatchpoints(void)
+{
+    UT_GenStub_SetupReturnBuffer(LC_ResetChangedWatchpoints, uint16);
+
+    UT_GenStub_Execute(LC_ResetChangedWatchpoints, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_ResetChangedWatchpoints, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_ReuseWatchResults()
+ * ----------------------------------------------------
+ */
+void LC_ReuseWatchResults(const LC_MessageList_t *MessageList, const CFE_SB_Buffer_t *BufPtr,
+                          LC_PacketTime_t *PacketTime)
+{
+    UT_GenStub_AddParam(LC_ReuseWatchResults, const LC_MessageList_t *, MessageList);
+    UT_GenStub_AddParam(LC_ReuseWatchResults, const CFE_SB_Buffer_t *, BufPtr);
+    UT_GenStub_AddParam(LC_ReuseWatchResults, LC_PacketTime_t *, PacketTime);
+
+    UT_GenStub_Execute(LC_ReuseWatchResults, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_SignedCompare()
  * ----------------------------------------------------
  */
-uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue)
+uint8 LC_SignedCompare(uint16 WatchIndex, int64 WPValue, int64 CompareValue)
 {
     UT_GenStub_SetupReturnBuffer(LC_SignedCompare, uint8);
 
     UT_GenStub_AddParam(LC_SignedCompare, uint16, WatchIndex);
-    UT_GenStub_AddParam(LC_SignedCompare, int32, WPValue);
-    UT_GenStub_AddParam(LC_SignedCompare, int32, CompareValue);
+    UT_GenStub_AddParam(LC_SignedCompare, int64, WPValue);
+    UT_GenStub_AddParam(LC_SignedCompare, int64, CompareValue);
 
     UT_GenStub_Execute(LC_SignedCompare, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(LC_SignedCompare, uint8);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_SyncStaleCountdowns()
+ * ----------------------------------------------------
+ */
+void LC_SyncStaleCountdowns(void)
+{
+    UT_GenStub_Execute(LC_SyncStaleCountdowns, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_TrackUnrefMsg()
+ * ----------------------------------------------------
+ */
+LC_UnrefMsg_t *LC_TrackUnrefMsg(CFE_SB_MsgId_t MessageID)
+{
+    UT_GenStub_SetupReturnBuffer(LC_TrackUnrefMsg, LC_UnrefMsg_t *);
+
+    UT_GenStub_AddParam(LC_TrackUnrefMsg, CFE_SB_MsgId_t, MessageID);
+
+    UT_GenStub_Execute(LC_TrackUnrefMsg, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_TrackUnrefMsg, LC_UnrefMsg_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_UnsignedCompare()
  * ----------------------------------------------------
  */
-uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue, uint32 CompareValue)
+uint8 LC_UnsignedCompare(uint16 WatchIndex, uint64 WPValue, uint64 CompareValue)
 {
     UT_GenStub_SetupReturnBuffer(LC_UnsignedCompare, uint8);
 
     UT_GenStub_AddParam(LC_UnsignedCompare, uint16, WatchIndex);
-    UT_GenStub_AddParam(LC_UnsignedCompare, uint32, WPValue);
-    UT_GenStub_AddParam(LC_UnsignedCompare, uint32, CompareValue);
+    UT_GenStub_AddParam(LC_UnsignedCompare, uint64, WPValue);
+    UT_GenStub_AddParam(LC_UnsignedCompare, uint64, CompareValue);
 
     UT_GenStub_Execute(LC_UnsignedCompare, Basic, NULL);
 
     return UT_GenStub_GetReturnValue(LC_UnsignedCompare, uint8);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_UpdateSubscriptions()
+ * ----------------------------------------------------
+ */
+void LC_UpdateSubscriptions(void)
+{
+    UT_GenStub_Execute(LC_UpdateSubscriptions, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_UpdateWatchResult()
+ * ----------------------------------------------------
+ */
+void LC_UpdateWatchResult(uint16 WatchIndex, uint8 WPEvalResult, uint64 MaskedWPData, LC_PacketTime_t *PacketTime)
+{
+    UT_GenStub_AddParam(LC_UpdateWatchResult, uint16, WatchIndex);
+    UT_GenStub_AddParam(LC_UpdateWatchResult, uint8, WPEvalResult);
+    UT_GenStub_AddParam(LC_UpdateWatchResult, uint64, MaskedWPData);
+    UT_GenStub_AddParam(LC_UpdateWatchResult, LC_PacketTime_t *, PacketTime);
+
+    UT_GenStub_Execute(LC_UpdateWatchResult, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for LC_ValidateWDT()
@@ -215,3 +886,19 @@ bool LC_WPOffsetValid(uint16 WatchIndex, const CFE_SB_Buffer_t *BufPtr)
 
     return UT_GenStub_GetReturnValue(LC_WPOffsetValid, bool);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for LC_WatchChangeOnly()
+ * ----------------------------------------------------
+ */
+bool LC_WatchChangeOnly(uint16 WatchIndex)
+{
+    UT_GenStub_SetupReturnBuffer(LC_WatchChangeOnly, bool);
+
+    UT_GenStub_AddParam(LC_WatchChangeOnly, uint16, WatchIndex);
+
+    UT_GenStub_Execute(LC_WatchChangeOnly, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(LC_WatchChangeOnly, bool);
+}
@@ -100,6 +100,16 @@ void LC_Test_Setup(void)
     memset(&WRTable, 0, sizeof(WRTable));
     memset(&ARTable, 0, sizeof(ARTable));
 
+    /* Treat every actionpoint as in use unless a test says otherwise */
+    LC_OperData.ActionHighWater = LC_MAX_ACTIONPOINTS;
+
+    /* Build helpers tested on their own work on the active index */
+    LC_OperData.MsgIndex        = &LC_OperData.MsgIndexBuf[0];
+    LC_OperData.HashBuild.Index = &LC_OperData.MsgIndexBuf[0];
+
+    /* Every CDS area is written on the first update, as after startup */
+    LC_OperData.CDSDirty = LC_CDS_DIRTY_ALL;
+
     memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
     memset(&context_CFE_ES_WriteToSysLog, 0, sizeof(context_CFE_ES_WriteToSysLog));
     memset(&UT_CmdBuf, 0, sizeof(UT_CmdBuf));